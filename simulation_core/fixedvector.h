@@ -0,0 +1,183 @@
+#ifndef FIXEDVECTOR_H
+#define FIXEDVECTOR_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+/**
+ * @brief The FixedVector class is a vector with compile-time dimension, the values are stored in place (no heap allocation).
+ * It is meant for the small state and control vectors (e.g. 2d positions), where every std::vector of VectorHelper
+ * costs one allocation. All operations are inline, the operators return by value on the stack,
+ * the in-place operators (+=, -=, *=) modify the vector itself.
+ */
+template <size_t Dim>
+class FixedVector
+{
+public:
+    /**
+     * @brief FixedVector initializes all components with 0
+     */
+    FixedVector() {
+        std::fill(m_values, m_values + Dim, 0.0);
+    }
+
+    /**
+     * @brief FixedVector takes the given components, missing components are 0
+     * @param values
+     */
+    FixedVector(std::initializer_list<double> values) {
+        std::fill(m_values, m_values + Dim, 0.0);
+        std::copy(values.begin(), values.begin() + std::min(values.size(), Dim), m_values);
+    }
+
+    /**
+     * @brief fromPointer copies Dim values, e.g. one step of a trajectory
+     * @param values
+     * @return
+     */
+    static FixedVector fromPointer(const double* values) {
+        FixedVector vec;
+        std::copy(values, values + Dim, vec.m_values);
+        return vec;
+    }
+
+    /**
+     * @brief fromVector copies the first Dim values of the vector, missing components are 0
+     * @param values
+     * @return
+     */
+    static FixedVector fromVector(const std::vector<double>& values) {
+        FixedVector vec;
+        std::copy(values.begin(), values.begin() + std::min(values.size(), Dim), vec.m_values);
+        return vec;
+    }
+
+    std::vector<double> toVector() const {
+        return std::vector<double>(m_values, m_values + Dim);
+    }
+
+    static constexpr size_t size() {
+        return Dim;
+    }
+
+    double& operator[](const size_t& i) {
+        return m_values[i];
+    }
+
+    const double& operator[](const size_t& i) const {
+        return m_values[i];
+    }
+
+    double* data() {
+        return m_values;
+    }
+
+    const double* data() const {
+        return m_values;
+    }
+
+    FixedVector& operator+=(const FixedVector& other) {
+        for (size_t i = 0; i < Dim; i++) {
+            m_values[i] += other.m_values[i];
+        }
+        return *this;
+    }
+
+    FixedVector& operator-=(const FixedVector& other) {
+        for (size_t i = 0; i < Dim; i++) {
+            m_values[i] -= other.m_values[i];
+        }
+        return *this;
+    }
+
+    FixedVector& operator*=(const double& scal) {
+        for (size_t i = 0; i < Dim; i++) {
+            m_values[i] *= scal;
+        }
+        return *this;
+    }
+
+    FixedVector operator+(const FixedVector& other) const {
+        FixedVector result(*this);
+        return result += other;
+    }
+
+    FixedVector operator-(const FixedVector& other) const {
+        FixedVector result(*this);
+        return result -= other;
+    }
+
+    FixedVector operator*(const double& scal) const {
+        FixedVector result(*this);
+        return result *= scal;
+    }
+
+    bool operator==(const FixedVector& other) const {
+        return std::equal(m_values, m_values + Dim, other.m_values);
+    }
+
+    /**
+     * @brief squaredNorm
+     * @return \f$||vec||^2\f$
+     */
+    double squaredNorm() const {
+        double norm = 0.0;
+        for (size_t i = 0; i < Dim; i++) {
+            norm += m_values[i] * m_values[i];
+        }
+        return norm;
+    }
+
+    /**
+     * @brief norm2
+     * @return \f$||vec||\f$, same as VectorHelper::norm2
+     */
+    double norm2() const {
+        return std::sqrt(squaredNorm());
+    }
+
+    /**
+     * @brief getInfinityNorm
+     * @return \f$||vec||_{\infty}\f$
+     */
+    double getInfinityNorm() const {
+        double norm = 0.0;
+        for (size_t i = 0; i < Dim; i++) {
+            norm = std::max(norm, std::abs(m_values[i]));
+        }
+        return norm;
+    }
+
+    /**
+     * @brief getMaxComponent
+     * @return index of the component with the maximum absolute value
+     */
+    size_t getMaxComponent() const {
+        size_t maxComp = 0;
+        for (size_t i = 1; i < Dim; i++) {
+            if (std::abs(m_values[i]) > std::abs(m_values[maxComp])) {
+                maxComp = i;
+            }
+        }
+        return maxComp;
+    }
+
+    /**
+     * @brief getDerivOfAbsValue same as VectorHelper::getDerivOfAbsValue
+     * @return -1 for negative components, otherwise 1
+     */
+    FixedVector getDerivOfAbsValue() const {
+        FixedVector deriv;
+        for (size_t i = 0; i < Dim; i++) {
+            deriv.m_values[i] = (m_values[i] < 0.0) ? -1.0 : 1.0;
+        }
+        return deriv;
+    }
+private:
+    double m_values[Dim];
+};
+
+#endif // FIXEDVECTOR_H
@@ -20,3 +20,32 @@ void VectorHelperTest::testShiftVector() {
    std::vector<double> result = VectorHelper::shiftStep(testVec, 1, 0.0);
    QCOMPARE(expected, result);
 }
+
+/**
+ * @brief VectorHelperTest::testKernels compares the allocation-free kernels and the fixed size vector
+ * with the allocating functions
+ */
+void VectorHelperTest::testKernels() {
+    std::vector<double> v1 = {1.0, -4.0};
+    std::vector<double> v2 = {3.0, 2.0};
+    std::vector<double> diff(2, 0.0);
+    VectorHelper::sub(v1.data(), v2.data(), diff.data(), diff.size());
+    QCOMPARE(diff, VectorHelper::sub(v1, v2));
+    QCOMPARE(VectorHelper::norm2(diff.data(), diff.size()), VectorHelper::norm2(VectorHelper::sub(v1, v2)));
+    QCOMPARE(VectorHelper::getInfinityDistance(v1.data(), v2.data(), v1.size()), 6.0);
+    FixedVector<2> fixedDiff = FixedVector<2>::fromVector(v1) - FixedVector<2>::fromVector(v2);
+    QCOMPARE(fixedDiff.toVector(), diff);
+    QCOMPARE(fixedDiff.norm2(), VectorHelper::norm2(diff));
+    QCOMPARE(fixedDiff.getInfinityNorm(), VectorHelper::getInfinityNorm(diff));
+    //trajectory with 3 steps of dimension 2: x_{i+1} = x_i + 0.5u_i
+    std::vector<double> u = {2.0, 0.0, 0.0, -2.0};
+    std::vector<double> x(6, 0.0);
+    VectorHelper::cumulativeSum(v1.data(), u.data(), 0.5, 3, 2, x.data());
+    std::vector<double> expected = {1.0, -4.0, 2.0, -4.0, 2.0, -5.0};
+    QCOMPARE(x, expected);
+    //transposed: the control u_0 influences x_1 and x_2, u_1 only x_2
+    std::vector<double> grad(4, 0.0);
+    VectorHelper::reverseCumulativeSum(expected.data(), 0.5, 3, 2, grad.data());
+    std::vector<double> expectedGrad = {2.0, -4.5, 1.0, -2.5};
+    QCOMPARE(grad, expectedGrad);
+}
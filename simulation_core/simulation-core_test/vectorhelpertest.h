@@ -4,6 +4,7 @@
 #include <QtTest/QtTest>
 
 #include "../vectorhelper.h"
+#include "../fixedvector.h"
 
 class VectorHelperTest : public QObject
 {
@@ -13,6 +14,7 @@ public:
 private slots:
     void initTestCase();
     void testShiftVector();
+    void testKernels();
 private:
 };
 
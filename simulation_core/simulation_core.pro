@@ -33,6 +33,7 @@ DEFINES += SIM_CORE_SHARED_LIB #shared core library
 TARGET = simulation_core
 TEMPLATE = lib
 QMAKE_CXXFLAGS += -fvisibility=hidden
+QMAKE_CXXFLAGS += -fopenmp-simd
 QMAKE_LFLAGS += -fopenmp
 LIBS += -fopenmp
 
@@ -65,7 +66,8 @@ HEADERS  += \
     simulationresourceobservernotifier.h \
     databasecore.h \
     enumvalues.h \
-    vectorhelper.h
+    vectorhelper.h \
+    fixedvector.h
 
 
 OTHER_FILES += \
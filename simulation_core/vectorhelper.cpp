@@ -1,6 +1,7 @@
 #include "vectorhelper.h"
 
 #include <QtCore/QDebug>
+#include <algorithm>
 #include <cmath>
 
 #include <typeinfo>
@@ -73,6 +74,7 @@ double VectorHelper::getInfinityNorm(const std::vector<double> &vec) {
  */
 std::vector<double> VectorHelper::sub(const std::vector<double> &v1, const std::vector<double> &v2) {
     std::vector<double> result;
+    result.reserve(v1.size());
     Q_ASSERT_X(v1.size() == v2.size(), typeid(VectorHelper).name(), "size not equal");
     if (v1.size() == v2.size()) {
         for (unsigned int i = 0; i < v1.size(); i++) {
@@ -90,6 +92,7 @@ std::vector<double> VectorHelper::sub(const std::vector<double> &v1, const std::
  */
 std::vector<double> VectorHelper::add(const std::vector<double> &v1, const std::vector<double> &v2) {
     std::vector<double> result;
+    result.reserve(v1.size());
     Q_ASSERT_X(v1.size() == v2.size(), typeid(VectorHelper).name(), "size not equal");
     if (v1.size() == v2.size()) {
         for (unsigned int i = 0; i < v1.size(); i++) {
@@ -106,6 +109,7 @@ std::vector<double> VectorHelper::add(const std::vector<double> &v1, const std::
  */
 std::vector<double> VectorHelper::ceil(const std::vector<double> &vec) {
     std::vector<double> ceiled;
+    ceiled.reserve(vec.size());
     for (auto& val : vec) {
         ceiled.emplace_back(std::ceil(val));
     }
@@ -119,6 +123,7 @@ std::vector<double> VectorHelper::ceil(const std::vector<double> &vec) {
  */
 std::vector<double> VectorHelper::floor(const std::vector<double> &vec) {
     std::vector<double> floored;
+    floored.reserve(vec.size());
     for (auto& val : vec) {
         floored.emplace_back(std::floor(val));
     }
@@ -146,6 +151,7 @@ double VectorHelper::norm2(const std::vector<double> &vec) {
  */
 std::vector<double> VectorHelper::getDerivOfAbsValue(const std::vector<double> &vec) {
     std::vector<double> derivAbs;
+    derivAbs.reserve(vec.size());
     for (const double& val : vec) {
         if (val < 0.0) {
             derivAbs.emplace_back(-1.0);
@@ -181,6 +187,7 @@ double VectorHelper::smaller(const std::vector<double>& vec1, const std::vector<
 std::vector<double> VectorHelper::mult(const std::vector<double> &vec1, const std::vector<double> &vec2) {
     Q_ASSERT_X(vec1.size() == vec2.size(), typeid(VectorHelper).name(), "size not equal");
    std::vector<double> result;
+   result.reserve(vec1.size());
    for (unsigned int i = 0; i < vec1.size(); i++) {
        result.emplace_back(vec1.at(i) * vec2.at(i));
    }
@@ -195,6 +202,7 @@ std::vector<double> VectorHelper::mult(const std::vector<double> &vec1, const st
  */
 std::vector<double> VectorHelper::mult(const std::vector<double> &vec1, const double &scal) {
    std::vector<double> result;
+   result.reserve(vec1.size());
    for (unsigned int i = 0; i < vec1.size(); i++) {
        result.emplace_back(vec1.at(i) * scal);
    }
@@ -304,3 +312,138 @@ std::vector<double> VectorHelper::setSubVector(const std::vector<double>& fullVe
     }
     return retVector;
 }
+
+/**
+ * @brief VectorHelper::sub writes \f$\vec{v1} - \vec{v2}\f$ to result without allocation
+ * @param v1
+ * @param v2
+ * @param result may be v1 or v2
+ * @param n length
+ */
+void VectorHelper::sub(const double* v1, const double* v2, double* result, const size_t& n) {
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++) {
+        result[i] = v1[i] - v2[i];
+    }
+}
+
+/**
+ * @brief VectorHelper::axpy adds \f$a\vec{x}\f$ to \f$\vec{y}\f$ in place
+ * @param a scalar
+ * @param x
+ * @param y
+ * @param n length
+ */
+void VectorHelper::axpy(const double& a, const double* x, double* y, const size_t& n) {
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++) {
+        y[i] += a * x[i];
+    }
+}
+
+/**
+ * @brief VectorHelper::norm2 gives back \f$||vec||\f$ without allocation
+ * @param vec
+ * @param n length
+ * @return normed value
+ */
+double VectorHelper::norm2(const double* vec, const size_t& n) {
+    double norm = 0.0;
+    #pragma omp simd reduction(+:norm)
+    for (size_t i = 0; i < n; i++) {
+        norm += vec[i] * vec[i];
+    }
+    return std::sqrt(norm);
+}
+
+/**
+ * @brief VectorHelper::getInfinityNorm gives back \f$||vec||_{\infty}\f$ without allocation
+ * @param vec
+ * @param n length
+ * @return maximum absolute value, 0 for n = 0
+ */
+double VectorHelper::getInfinityNorm(const double* vec, const size_t& n) {
+    double norm = 0.0;
+    #pragma omp simd reduction(max:norm)
+    for (size_t i = 0; i < n; i++) {
+        norm = std::max(norm, std::abs(vec[i]));
+    }
+    return norm;
+}
+
+/**
+ * @brief VectorHelper::getInfinityDistance gives back \f$||\vec{v1} - \vec{v2}||_{\infty}\f$ without the temporary of sub
+ * @param v1
+ * @param v2
+ * @param n length
+ * @return
+ */
+double VectorHelper::getInfinityDistance(const double* v1, const double* v2, const size_t& n) {
+    double norm = 0.0;
+    #pragma omp simd reduction(max:norm)
+    for (size_t i = 0; i < n; i++) {
+        norm = std::max(norm, std::abs(v1[i] - v2[i]));
+    }
+    return norm;
+}
+
+/**
+ * @brief VectorHelper::cumulativeSum batched over a whole trajectory of steps x dim values (row-wise):
+ * \f$x_0 = x0, x_{i+1} = x_i + scale \cdot u_i\f$, e.g. the trajectory of the holonomic model.
+ * The recursion is sequential along the steps, the dim independent components of a row are vectorised
+ * @param x0 start (dim values), may be the first row of x
+ * @param u increments (at least (steps-1) x dim values)
+ * @param scale
+ * @param steps number of rows of x
+ * @param dim length of one row
+ * @param x result (steps x dim values)
+ */
+void VectorHelper::cumulativeSum(const double* x0, const double* u, const double& scale, const size_t& steps, const size_t& dim, double* x) {
+    if (steps == 0) {
+        return;
+    }
+    if (x0 != x) {
+        std::copy(x0, x0 + dim, x);
+    }
+    for (size_t i = 1; i < steps; i++) {
+        const double* prev = x + (i - 1) * dim;
+        const double* inc = u + (i - 1) * dim;
+        double* cur = x + i * dim;
+        #pragma omp simd
+        for (size_t j = 0; j < dim; j++) {
+            cur[j] = prev[j] + scale * inc[j];
+        }
+    }
+}
+
+/**
+ * @brief VectorHelper::reverseCumulativeSum batched over a whole trajectory of steps x dim values (row-wise), it is the transposed
+ * operation of cumulativeSum: \f$result_{i-1} += scale \cdot \sum_{k \geq i} d_k\f$ for \f$i = 1, \dots, steps-1\f$.
+ * The sum is sequential along the steps, so the rows are walked backwards and the independent columns are vectorised,
+ * with the running sums of a block of columns on the stack
+ * @param d values (steps x dim)
+ * @param scale
+ * @param steps number of rows of d
+ * @param dim length of one row
+ * @param result values are added ((steps-1) x dim values)
+ */
+void VectorHelper::reverseCumulativeSum(const double* d, const double& scale, const size_t& steps, const size_t& dim, double* result) {
+    if (steps < 2) {
+        return;
+    }
+    const size_t blockSize = 8;
+    double cumulated[blockSize];
+    for (size_t j0 = 0; j0 < dim; j0 += blockSize) {
+        const size_t width = std::min(blockSize, dim - j0);
+        std::fill(cumulated, cumulated + width, 0.0);
+        for (size_t i = steps - 1; i > 0; i--) {
+            const double* row = d + i * dim + j0;
+            double* prev = result + (i - 1) * dim + j0;
+            #pragma omp simd
+            for (size_t j = 0; j < width; j++) {
+                cumulated[j] += row[j];
+                prev[j] += scale * cumulated[j];
+            }
+        }
+    }
+}
@@ -25,6 +25,14 @@ public:
     static std::vector<double> getVectorValues(const std::vector<double> &vec, const unsigned int &startPos, const unsigned int &length);
     static std::vector<double> shiftStep(const std::vector<double>& vec, const size_t &steps, const double& initVal);
     static std::vector<double> setSubVector(const std::vector<double>& fullVector, const std::vector<double>& subVector, const size_t& startPos);
+    //allocation-free kernels on raw arrays
+    static void sub(const double* v1, const double* v2, double* result, const size_t& n);
+    static void axpy(const double& a, const double* x, double* y, const size_t& n);
+    static double norm2(const double* vec, const size_t& n);
+    static double getInfinityNorm(const double* vec, const size_t& n);
+    static double getInfinityDistance(const double* v1, const double* v2, const size_t& n);
+    static void cumulativeSum(const double* x0, const double* u, const double& scale, const size_t& steps, const size_t& dim, double* x);
+    static void reverseCumulativeSum(const double* d, const double& scale, const size_t& steps, const size_t& dim, double* result);
 };
 
 #endif // VECTORHELPER_H
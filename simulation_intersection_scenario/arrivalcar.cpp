@@ -11,8 +11,13 @@
 ArrivalCar::ArrivalCar(const DistParam &distParam) :
     m_meanArrivalTime(distParam.meanArrivalTime)
 {
-    std::random_device rd;
-    m_merTwister = std::mt19937(rd());
+    if (distParam.seed == 0) {
+        std::random_device rd;
+        m_merTwister = std::mt19937(rd());
+    }
+    else {
+        m_merTwister = std::mt19937(distParam.seed);
+    }
     ///cars per minute
     if (distParam.distribFunc == DistributionFunction::EXP) {
         //m_distribution = std::exponential_distribution<double>(meanArrivalTime);
@@ -6,25 +6,31 @@
  * @param car
  * @param start
  * @param target
+ * @param N horizon, length of the space-time window (decentralized)
  * @param T sampling interval
  * @param pathCalc astar variant: PathCalculation::ASTARCENTRALIZED or PathCalculation::ASTARDECENTRALIZED
+ * @param context simulation, the car belongs to
  */
-AStarPathCalculation::AStarPathCalculation(const QString &car, const PathItem &start, const PathItem &target, const double &T, const PathAlgorithm &pathCalc) :
+AStarPathCalculation::AStarPathCalculation(const QString &car, const PathItem &start, const PathItem &target, const size_t &N, const double &T, const PathAlgorithm &pathCalc, const std::weak_ptr<SimulationContext>& context) :
     m_car(car),
     m_target(target),
     m_start(start),
-    m_astarType(pathCalc)
+    m_astarType(pathCalc),
+    m_n(N),
+    m_T(T)
 {
     //qDebug() << "First Constructor Called: ";
     std::cout<<" First constructor called hogya he"<<std::endl;
     //std::cout<<" Car Name: " << car <<std::endl;
     std::cout<<" Path Item Values: " << start.getX()<<" and "<<start.getY() <<std::endl;
-    m_systemFunc = std::make_shared<SystemFunction>(m_car,Path(start));
+    m_systemFunc = std::make_shared<SystemFunction>(m_car,Path(start), context);
 }
 
-AStarPathCalculation::AStarPathCalculation(const QString &car, const std::vector<double>& start, const std::vector<double>& target, const double &T, const PathAlgorithm &pathCalc):
+AStarPathCalculation::AStarPathCalculation(const QString &car, const std::vector<double>& start, const std::vector<double>& target, const size_t &N, const double &T, const PathAlgorithm &pathCalc, const std::weak_ptr<SimulationContext>& context):
     m_targetCont(target),
-    m_astarType(pathCalc)
+    m_astarType(pathCalc),
+    m_n(N),
+    m_T(T)
 {
     // qDebug() << "Second Constructor Called: ";
     std::cout<<"Second constructor Called: "<< std::endl;
@@ -61,9 +67,9 @@ std::shared_ptr<SystemFunction> AStarPathCalculation::getSystemFunction() const
  * @return
  */
 double AStarPathCalculation::estimateCost(const std::shared_ptr<InterSectionCell> &source, const std::shared_ptr<InterSectionCell> &target) const {
-    std::shared_ptr<InterSectionCell> targetP (target);
-    std::shared_ptr<InterSectionCell> sourceP (source);
-    return std::sqrt(std::pow(targetP->getX() - sourceP->getX(), 2) + std::pow(targetP->getY() - sourceP->getY(), 2));
+    const double dx = target->getX() - source->getX();
+    const double dy = target->getY() - source->getY();
+    return std::sqrt(dx * dx + dy * dy);
 
    // return 0;
 }
@@ -94,53 +100,32 @@ double AStarPathCalculation::estimateCost(const std::shared_ptr<InterSectionCell
 // for centralized case
 Path AStarPathCalculation::calculatePath(const std::shared_ptr<InterSection> grid, const std::shared_ptr<InterSectionCell> &source, const std::shared_ptr<InterSectionCell> &target){
     //Q_ASSERT_X(grid.expired() || source.expired() || target.expired(), typeid(this).name(), "expired grid or nodes");
+    const InterSectionGrid& cells = grid->getGrid();
+    const size_t sourceIndex = grid->getCellIndex(source->getX(), source->getY());
 
     if (m_astarType == PathAlgorithm::ASTARCENTRALIZED){
 
         m_startNode = source;
         m_targetNode = target;
+        m_targetDistances = grid->getDistanceField(grid->getCellIndex(target->getX(), target->getY()));
 
-        //remove these 3
-        //std::shared_ptr<InterSectionCell> sourceP(source);
-        //std::shared_ptr<InterSectionCell> targetP(target);
-        //std::shared_ptr<InterSection> gridP(grid);
-
-       // std::shared_ptr<InterSectionCell> node= make_shared<InterSectionCell>(1,2);
-        //QList<weak_ptr<InterSectionCell>> adu = gridP->getNeighbours(node,1);
-
-     std::shared_ptr<InterSectionCell> startPoint = grid->getInterSectionCell(m_start.getX(),m_start.getY());
-
-
-
-        //initializecost();
-        source -> setTentativeGCost(0.0);
-        source -> setFCost(estimateCost(source,target));// put weak pointers here
+        std::shared_ptr<InterSectionCell> startPoint = grid->getInterSectionCell(m_start.getX(),m_start.getY());
 
+        //the search state is kept in the scratch arrays, so the shared cells are not modified
+        m_search.reset(cells.size());
+        m_search.open(sourceIndex, 0.0, m_targetDistances->getDistance(sourceIndex), GridSearchState::noCell);
 
-        m_openList.append(source);
-        //PathItem temp= PathItem(sourceP->getX(),sourceP->getY(),static_cast<double>(m_systemFunc->getGlobalLiveTime()));// do i need conversion
-        // for global time ?
         Path m_pathint;
         double globalTime = m_systemFunc->getGlobalTime();
 
-
-        while (!m_openList.isEmpty()){
-
-
-            //std::shared_ptr<InterSectionCell> currentNode = getLowestCostNode(m_openList, sourceP);
-            //qSort(m_openList.begin(), m_openList.end(),  [](const InterSectionCell* a, const InterSectionCell* b) -> bool { return a->getFCost() < b->getFCost(); });
-            //qSort(m_openList.begin(), m_openList.end(), compare);
-            qSort(m_openList.begin(), m_openList.end(),[](const std::shared_ptr<InterSectionCell> a, const std::shared_ptr<InterSectionCell> b) -> bool { return a->getFCost() < b->getFCost(); });
-            std::shared_ptr<InterSectionCell> currentNode = m_openList.first();
-            //int64_t ad= m_systemFunc->getGlobalLiveTime();
-            //double time= static_cast<double>(ad);
-            //double nextFreeTimeLocal = currentNode->reserveNextFreeTimeForCar(m_car,time);
+        size_t currentIndex;
+        while (m_search.popMin(currentIndex)) {
+            const std::shared_ptr<InterSectionCell>& currentNode = cells[currentIndex];
 
             if (currentNode != startPoint){  // i dont want start point to be in parth
 
-                globalTime+= InterSectionParameters::T ;
-        //double nextFreeTimeLocal = currentNode->reserveNextFreeTimeForCar(m_car,i);
-        double nextFreeTimeLocal = m_systemFunc->getPossibleTimeForPrelimReservation(PathItem(currentNode->getX(), currentNode->getY(), globalTime));
+                globalTime+= m_T;
+                double nextFreeTimeLocal = m_systemFunc->getPossibleTimeForPrelimReservation(PathItem(currentNode->getX(), currentNode->getY(), globalTime));
 
                 //car is already in intersection
                 //if not, is has to wait
@@ -150,95 +135,128 @@ Path AStarPathCalculation::calculatePath(const std::shared_ptr<InterSection> gri
                         PathItem stayhere = m_pathint.back();
                         m_pathint.push_back(PathItem(stayhere.getX(), stayhere.getY(), globalTime));
                         m_systemFunc->prelimReserveCell(m_pathint.back());
-                        globalTime+= InterSectionParameters::T ;
+                        globalTime+= m_T;
                     }
                 }
 
-
                 m_pathint.push_back(PathItem(currentNode->getX(),currentNode->getY(),nextFreeTimeLocal));
                 m_systemFunc->prelimReserveCell(m_pathint.back());
 
             }
 
-        Q_ASSERT_X(currentNode, typeid(this).name(), "open list is not reachable");
-                   //target node is reached
-
-                   if (currentNode) {
-                       if (currentNode == target) {
-
-                           return m_pathint;
-                       }
-                       else {
-                           m_closedList.append(currentNode);
-                           m_openList.removeFirst();
-
-                           std::weak_ptr<InterSectionCell>currentNodeW(currentNode);// maybe do it before open and closed list
-                           expandNode(grid, currentNodeW);
-                       }
-
-        }
+            //target node is reached
+            if (currentNode == target) {
+                return m_pathint;
+            }
+            m_search.close(currentIndex);
+            expandNode(grid, currentIndex);
         }
         return m_pathint;
 
     }
     else{
 
-        //m_startNode = source;
         m_targetNode = target;
-        //std::shared_ptr<InterSectionCell> sourceP(source);
-        //std::shared_ptr<InterSectionCell> targetP(target);
-        //std::shared_ptr<InterSection> gridP(grid);
-
-        Path intpath;
-
-        std::shared_ptr<InterSectionCell> startPoint = grid->getInterSectionCell(m_start.getX(),m_start.getY());
-        std::weak_ptr<InterSectionCell> sourceWeak(source);
-
-        if(source == startPoint){
-
-            source -> setTentativeGCost(0.0); // not needed by the way, already 0
-            source -> setFCost(estimateCost(source,target));
-            //m_openList.append(source);
-            m_closedList.append(source);
-            expandNode(grid,sourceWeak);
-        }
-
-        else{
-            m_openList.removeFirst();
-            m_closedList.append(source);
-            expandNode(grid,sourceWeak);
+        const size_t targetIndex = grid->getCellIndex(target->getX(), target->getY());
+        const double t0 = m_systemFunc->getGlobalTime();
+
+        Path window = calculateSpaceTimePath(grid, sourceIndex, targetIndex, t0);
+        //the first step is the solution of this step, the rest of the window is reserved, so the next cars plan around it
+        for (size_t k = 0; k < window.size(); k++) {
+            if (k == 0) {
+                m_systemFunc->prelimReserveCell(window[k]);
+            }
+            else {
+                grid->tryReservePrelimTimeForCar(m_systemFunc->getCarId(), window[k].getX(), window[k].getY(), window[k].getTime());
+            }
         }
+        m_path.push_back(window.front());
 
-        qSort(m_openList.begin(), m_openList.end(),[](const std::shared_ptr<InterSectionCell> a, const std::shared_ptr<InterSectionCell> b) -> bool { return a->getFCost() < b->getFCost();});
-        std::shared_ptr<InterSectionCell> currentNode = m_openList.first();
-        double desiredtime= m_systemFunc->getGlobalTime() + InterSectionParameters::T;
-
-        //double nextFreeTimeLocal = currentNode->reserveNextFreeTimeForCar(m_car,static_cast<double>(m_systemFunc->getGlobalLiveTime()));
-        double nextFreeTimeLocal = m_systemFunc->getPossibleTimeForPrelimReservation(PathItem(currentNode->getX(), currentNode->getY(), currentNode->getNextFreeTime(desiredtime)));
-
-        if (desiredtime == nextFreeTimeLocal ){
-
-            PathItem ret = PathItem(currentNode->getX(),currentNode->getY(),nextFreeTimeLocal);
-            intpath.push_back(ret);
-            m_systemFunc->prelimReserveCell(intpath.back());
+        return window;
+    }
+}
 
-            m_path.push_back(ret);
+/**
+ * @brief AStarPathCalculation::calculateSpaceTimePath windowed cooperative A* over the states (cell, t0 + kT), k = 0..N with the horizon
+ * and the sampling interval of the car.
+ * In each step the car moves to a neighbour or waits, states which are preliminary reserved by other cars are skipped,
+ * as well as moves, which swap the cells with another car.
+ * The search ends at the target or at the end of the window, there the distance to the target is the remaining costs,
+ * the exact distances of the target's DistanceField are the heuristic.
+ * @param grid
+ * @param sourceIndex current cell of the car
+ * @param targetIndex
+ * @param t0 current time
+ * @return path items for t0 + T, ..., at most N steps, the car stays if no step is possible
+ */
+Path AStarPathCalculation::calculateSpaceTimePath(const std::shared_ptr<InterSection>& grid, const size_t& sourceIndex, const size_t& targetIndex, const double& t0) {
+    const InterSectionGrid& cells = grid->getGrid();
+    const size_t numCells = cells.size();
+    const size_t horizon = m_n;
+    const CarId car = m_systemFunc->getCarId();
+    m_targetDistances = grid->getDistanceField(targetIndex);
+    //state k * numCells + cell
+    m_search.reset(numCells * (horizon + 1));
+    m_search.open(sourceIndex, 0.0, m_targetDistances->getDistance(sourceIndex), GridSearchState::noCell);
+
+    size_t goalState = GridSearchState::noCell;
+    size_t state;
+    while (m_search.popMin(state)) {
+        const size_t cell = state % numCells;
+        const size_t k = state / numCells;
+        if (cell == targetIndex || k == horizon) {
+            goalState = state;
+            break;
         }
-        else{
-
-            PathItem ret = m_path.back();
-
-            PathItem stayhere = PathItem(ret.getX(), ret.getY(), desiredtime);
-            intpath.push_back(stayhere);
-            m_systemFunc->prelimReserveCell(intpath.back());
-
-            m_path.push_back(stayhere);
-
+        m_search.close(state);
+        const double currentTime = t0 + k * m_T;
+        const double nextTime = t0 + (k + 1) * m_T;
+        const int x = cells[cell]->getX();
+        const int y = cells[cell]->getY();
+        for (int i = x - 1; i <= x + 1; i++) {
+            for (int j = y - 1; j <= y + 1; j++) {
+                if (!grid->isInsideGrid(i, j)) {
+                    continue;
+                }
+                const size_t nextCell = grid->getCellIndex(i, j);
+                const size_t nextState = (k + 1) * numCells + nextCell;
+                if (m_search.isClosed(nextState) || cells[nextCell]->isPrelimTimeReservedByOtherCar(car, nextTime)) {
+                    continue;
+                }
+                //swap: the car in the next cell would move to this cell at the same time
+                if (nextCell != cell) {
+                    const CarId otherCar = cells[nextCell]->getPrelimCarForTime(currentTime);
+                    if (otherCar != noCarId && otherCar != car && cells[cell]->getPrelimCarForTime(nextTime) == otherCar) {
+                        continue;
+                    }
+                }
+                //waiting costs as much as a straight step
+                const double stepCosts = (nextCell == cell) ? 1.0 : estimateCost(cells[cell], cells[nextCell]);
+                const double gCost = m_search.getGCost(state) + stepCosts;
+                const double fCost = gCost + m_targetDistances->getDistance(nextCell);
+                if (!m_search.isOpen(nextState) || fCost < m_search.getFCost(nextState)) {
+                    m_search.open(nextState, gCost, fCost, state);
+                }
+            }
         }
+    }
 
-
-        return intpath;
-}
+    Path window;
+    if (goalState == GridSearchState::noCell || goalState == sourceIndex) {
+        //no free state or already at the target: stay
+        window.push_back(PathItem(cells[sourceIndex]->getX(), cells[sourceIndex]->getY(), t0 + m_T));
+        return window;
+    }
+    std::vector<size_t> states;
+    for (size_t current = goalState; current != sourceIndex; current = m_search.getParent(current)) {
+        states.push_back(current);
+    }
+    for (auto it = states.rbegin(); it != states.rend(); it++) {
+        const size_t cell = *it % numCells;
+        const size_t k = *it / numCells;
+        window.push_back(PathItem(cells[cell]->getX(), cells[cell]->getY(), t0 + k * m_T));
+    }
+    return window;
 }
 
 /**
@@ -247,69 +265,31 @@ Path AStarPathCalculation::calculatePath(const std::shared_ptr<InterSection> gri
  * - the found path generates lower costs
  * - TODO: get searchdirection (is defined as <left,right,diagonal>
  * is called recursive for each successor node
- * @param currentNode fron this and the neighbours all nodes will be expanded
- * @param target to get the right search direction
- * @return
+ * @param grid intersection, the cells are looked up by their index
+ * @param currentIndex cell index, from this the neighbours will be expanded
  */
-
-//make grid shared
-void AStarPathCalculation::expandNode(const std::weak_ptr<InterSection>& grid, std::weak_ptr<InterSectionCell> &currentNode) {
-    //Q_ASSERT_X(grid.expired() || currentNode.expired(), typeid(this).name(), "expired grid or nodes");
-    std::shared_ptr<InterSection> gridP(grid);
-    std::shared_ptr<InterSectionCell> currentNodeP(currentNode);
-
-    //TOBIAS: please indent the code to common standards (here, you may use Qt Creator suggestions)
-    if (currentNodeP.get()) {
-        //at first get list of neighbours
-        QList<std::weak_ptr<InterSectionCell> > neighbours = gridP->getNeighbours(currentNode, 1);// maybe get neighbours
-        //now iterate over neighbours
-        for (QList<std::weak_ptr<InterSectionCell> >::iterator itNeighbourList = neighbours.begin(); itNeighbourList != neighbours.end(); itNeighbourList++) {
-            std::shared_ptr<InterSectionCell> currentNeighbourP(*(itNeighbourList));// ??
-
-            double tentativeGSummedCosts;
-
-            /*if (m_astarType == PathAlgorithm::ASTARCENTRALIZED){
-
-             tentativeGSummedCosts = estimateCost(m_startNode, currentNodeP) + estimateCost(currentNodeP, currentNeighbourP);
-}
-            else{
-
-              tentativeGSummedCosts = estimateCost(currentNodeP, currentNeighbourP);
-            }*/
-            tentativeGSummedCosts = estimateCost(currentNodeP, currentNeighbourP);
-            double fCost = tentativeGSummedCosts + estimateCost(currentNeighbourP, m_targetNode);
-            //look, if closed list contains successor
-            bool isContained = containsSuccessor(m_closedList, currentNeighbourP);
-            //if closed list contains current nodes, no further examination
-            if (isContained) {
+void AStarPathCalculation::expandNode(const std::shared_ptr<InterSection>& grid, const size_t& currentIndex) {
+    const InterSectionGrid& cells = grid->getGrid();
+    const std::shared_ptr<InterSectionCell>& currentNode = cells[currentIndex];
+    const int x = currentNode->getX();
+    const int y = currentNode->getY();
+    //neighbourhood with radius 1 in the same order as InterSection::getNeighbours
+    for (int i = x - 1; i <= x + 1; i++) {
+        for (int j = y - 1; j <= y + 1; j++) {
+            if (!grid->isInsideGrid(i, j)) {
                 continue;
             }
-
-            //if successor-node is not in the open list
-            else if(!m_openList.contains(currentNeighbourP)){
-                currentNeighbourP ->setTentativeGCost(tentativeGSummedCosts);
-                currentNeighbourP ->setFCost(fCost);
-                currentNeighbourP->setParent(currentNode);
-                m_openList.append(currentNeighbourP);
-            }
-
-            // if successor node is int the open list but new gcost is not better
-            else if (m_openList.contains(currentNeighbourP) && fCost >= currentNeighbourP ->getFCost()) {
+            const size_t neighbourIndex = grid->getCellIndex(i, j);
+            //if closed list contains successor, no further examination
+            if (m_search.isClosed(neighbourIndex)) {
                 continue;
             }
-            // successor in the open list with better gcost available
-            else {
-                //successor-node is better
-                //check first, if reservation is possible
-                //TODO: give start time here, when it should be reserved (perhaps as start from calculatePath(...))
-                currentNeighbourP ->setTentativeGCost(tentativeGSummedCosts);
-                currentNeighbourP ->setFCost(fCost);
-                currentNeighbourP->setParent(currentNode);
-                int index = m_openList.indexOf(currentNeighbourP);
-                m_openList.replace(index,currentNeighbourP);
-                //double nextFreeTime = currentNeighbourP->getNextFreeTime();
-                //m_path.push_back(PathItem(currentNeighbourP->getX(), currentNeighbourP->getY(), nextFreeTime));
-
+            const std::shared_ptr<InterSectionCell>& currentNeighbourP = cells[neighbourIndex];
+            double tentativeGSummedCosts = estimateCost(currentNode, currentNeighbourP);
+            double fCost = tentativeGSummedCosts + m_targetDistances->getDistance(neighbourIndex);
+            //successor is found for the first time or the new path generates lower costs
+            if (!m_search.isOpen(neighbourIndex) || fCost < m_search.getFCost(neighbourIndex)) {
+                m_search.open(neighbourIndex, tentativeGSummedCosts, fCost, currentIndex);
             }
         }
     }
@@ -371,23 +351,6 @@ void AStarPathCalculation::expandNode(const std::weak_ptr<InterSection>& grid, s
     return cheapestNode;
 }*/
 
-/**
- * @brief AStarPathCalculation::containsSuccessor
- * @param list
- * @param cell
- * @return
- */
-bool AStarPathCalculation::containsSuccessor(QList<std::shared_ptr<InterSectionCell> > &list, std::shared_ptr<InterSectionCell>& cell) const {
-    bool isContained = false;
-    for (QList<std::shared_ptr<InterSectionCell> >::iterator itClosedList = list.begin(); itClosedList != list.end(); itClosedList++) {
-        if (cell == std::shared_ptr<InterSectionCell>(*(itClosedList))) {
-            isContained = true;
-
-        }
-    }
-    return isContained;
-}
-
 /*double AStarPathCalculation::getGcost() const
 {
 
@@ -428,7 +391,7 @@ void AStarPathCalculation::updateGcost(const std::weak_ptr<InterSectionCell>& ce
  */
 PathItem AStarPathCalculation::optimize(const PathItem &start) {
 
-    std::shared_ptr<InterSection> grid= InterSection::getInstance();
+    std::shared_ptr<InterSection> grid= m_systemFunc->getInterSection();
     //1. we want constant or non constant getintersectioncell ?
     //2. which way is correct?. second way is giving error. i dont know why
     std::shared_ptr<InterSectionCell> startNode= grid->getInterSectionCell(start.getX(),start.getY());
@@ -465,7 +428,7 @@ PathItem AStarPathCalculation::optimize(const PathItem &start) {
 
     }
     else {
-        return calculatePath(grid, startNode,targetNode).back();
+        return calculatePath(grid, startNode,targetNode).front();
 
     }
 
@@ -474,7 +437,7 @@ PathItem AStarPathCalculation::optimize(const PathItem &start) {
 // either we can make a global pointer of current node and set it before entering optimize
 /*std::shared_ptr<InterSectionCell> currentNode= make_shared<InterSectionCell> (start.getX(),start.getY());
     std::weak_ptr<InterSectionCell> currentNodeExpansion(currentNode); //necessary ?
-    std::shared_ptr<InterSection> grid= InterSection::getInstance();
+    std::shared_ptr<InterSection> grid= m_systemFunc->getInterSection();
 
     m_closedList.append(currentNode);
     m_openList.removeFirst();
@@ -483,7 +446,7 @@ PathItem AStarPathCalculation::optimize(const PathItem &start) {
     qSort(m_openList.begin(),m_openList.end());
 
     std::shared_ptr<InterSectionCell> desiredNode= m_openList.first();
-    double nextFreeTime = desiredNode->reserveNextFreeTimeForCar(m_car,static_cast<double>(m_systemFunc->getGlobalLiveTime()));
+    double nextFreeTime = desiredNode->reserveNextFreeTimeForCar(m_systemFunc->getCarId(),static_cast<double>(m_systemFunc->getGlobalLiveTime()));
     PathItem toReturn= PathItem(desiredNode->getX(),desiredNode->getY(),nextFreeTime);
     m_path.push_back(toReturn);// optional
 
@@ -494,7 +457,7 @@ PathItem AStarPathCalculation::optimize(const PathItem &start) {
 
     /*    qSort(m_openList.begin(), m_openList.end());
         std::shared_ptr<InterSectionCell> currentNode = m_openList.first();
-        double nextFreeTimeLocal = currentNode->reserveNextFreeTimeForCar(m_car,static_cast<double>(m_systemFunc->getGlobalLiveTime()));
+        double nextFreeTimeLocal = currentNode->reserveNextFreeTimeForCar(m_systemFunc->getCarId(),static_cast<double>(m_systemFunc->getGlobalLiveTime()));
         PathItem pathItemToBeReturned= PathItem(currentNode->getX(),currentNode->getY(),nextFreeTimeLocal);
         m_path.push_back(pathItemToBeReturned);
         Q_ASSERT_X(currentNode, typeid(this).name(), "open list is not reachable");
@@ -504,7 +467,7 @@ PathItem AStarPathCalculation::optimize(const PathItem &start) {
                 m_openList.removeFirst();
                 //TODO: dämlicher workaround, überlegen, ob generell die member als shared_ptr gespeichert werden
                 std::weak_ptr<InterSectionCell>currentNodeW(currentNode);
-                std::shared_ptr<InterSection> grid = InterSection::getInstance();
+                std::shared_ptr<InterSection> grid = m_systemFunc->getInterSection();
                 expandNode(grid, currentNodeW);
                 // recursive call to optimize method //optimize for source
            // }
@@ -538,11 +501,19 @@ double AStarPathCalculation::initializeCosts() {
  * @brief AStarPathCalculation::setCurrentConstraints sets here the obstacles
  * @param constraints
  */
-void AStarPathCalculation::setCurrentConstraints(const std::multimap<QString, Constraint> &constraints, const double &t0, const double &T) {
+void AStarPathCalculation::setCurrentConstraints(const std::vector<Constraint> &constraints, const double &t0, const double &T) {
     //
 
 }
 
+/**
+ * @brief AStarPathCalculation::setCurrentBoxConstraints
+ * @param constraints
+ */
+void AStarPathCalculation::setCurrentBoxConstraints(const std::vector<ConstraintBox> &constraints, const double& t0, const double& T) {
+    //
+}
+
 /**
  * @brief AStarPathCalculation::createGlobalConstraints
  * @param lb
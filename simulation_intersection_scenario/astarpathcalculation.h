@@ -3,6 +3,8 @@
 #include <memory>
 #include "systemfunction.h"
 #include "pathcalculation.h"
+#include "gridsearchstate.h"
+#include "distancefield.h"
 #include <QtCore/QMap>
 #include <QtCore/QPointer>
 #include <QtCore/QList>
@@ -15,8 +17,8 @@ class AStarPathCalculation : public PathCalculation
 {
 public:
 
-    AStarPathCalculation(const QString &car, const PathItem& start, const PathItem& target, const double& T, const PathAlgorithm& pathCalc);
-    AStarPathCalculation(const QString &car, const std::vector<double>& start, const std::vector<double>& target, const double& T, const PathAlgorithm &pathCalc);
+    AStarPathCalculation(const QString &car, const PathItem& start, const PathItem& target, const size_t& N, const double& T, const PathAlgorithm& pathCalc, const std::weak_ptr<SimulationContext>& context = std::weak_ptr<SimulationContext>());
+    AStarPathCalculation(const QString &car, const std::vector<double>& start, const std::vector<double>& target, const size_t& N, const double& T, const PathAlgorithm &pathCalc, const std::weak_ptr<SimulationContext>& context = std::weak_ptr<SimulationContext>());
     ~AStarPathCalculation();
     PathAlgorithm getAlg() const;
     std::vector<double> getTargetContinuous() const;
@@ -25,7 +27,8 @@ public:
     PathItem optimize(const PathItem &start);
     std::vector<std::vector<double> > optimizeContinous(const std::vector<double> &controlVec, const double &t0, const double &T);
     double initializeCosts();
-    void setCurrentConstraints(const std::multimap<QString, Constraint> &constraints, const double& t0, const double& T);
+    void setCurrentConstraints(const std::vector<Constraint> &constraints, const double& t0, const double& T);
+    void setCurrentBoxConstraints(const std::vector<ConstraintBox> &constraints, const double& t0, const double& T);
     void createGlobalConstraints(const std::vector<double>& lb, const std::vector<double>& ub);
     void initializeDirectionalConstraints(const unsigned int &interSectionWidth, const unsigned int &interSectionHeight, const double &cellSize,
                                           const double &t0, const int &N, const double &T, const double &dmin, const double &maxDynamics);
@@ -51,11 +54,14 @@ private:
     ///TODO: allow diagonal, first: yes
     //double calculateHCost(PathItem& source);
 
-    void expandNode(const std::weak_ptr<InterSection>& grid, std::weak_ptr<InterSectionCell> &currentNode) ;
+    void expandNode(const std::shared_ptr<InterSection>& grid, const size_t& currentIndex);
+    Path calculateSpaceTimePath(const std::shared_ptr<InterSection>& grid, const size_t& sourceIndex, const size_t& targetIndex, const double& t0);
     //std::shared_ptr<InterSectionCell> getLowestCostNode(QList<std::shared_ptr<InterSectionCell> > &list, std::shared_ptr<InterSectionCell>& source) const;
-    bool containsSuccessor(QList<std::shared_ptr<InterSectionCell> > &list, std::shared_ptr<InterSectionCell>& cell) const;
-    QList<std::shared_ptr<InterSectionCell> > m_openList;
-    QList<std::shared_ptr<InterSectionCell> > m_closedList;
+    ///open and closed list with the costs of this car's search, indexed by the cell index of the grid
+    ///(decentralized: by the space-time state k * number of cells + cell index)
+    GridSearchState m_search;
+    ///exact distances to the target cell, shared with the other cars heading for the same target
+    std::shared_ptr<const DistanceField> m_targetDistances;
     std::shared_ptr<InterSectionCell> m_startNode;
     std::shared_ptr<InterSectionCell> m_targetNode;
     Path m_path;
@@ -68,6 +74,10 @@ private:
     PathItem m_target;
     PathItem m_start;
     PathAlgorithm m_astarType;
+    ///horizon, length of the space-time window of the decentralized search
+    size_t m_n;
+    ///sampling interval, time step of the space-time window
+    double m_T;
     //std::vector<double> m_targetCont; // use in constructor to initialize
 
     ///constraint which are coming from the previous optimizing cars
@@ -0,0 +1,113 @@
+#include "simulationthread.h"
+#include "resultwriter.h"
+#include "intersectionparameters.h"
+#include "prioritysorter.h"
+#include "sweepengine.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QSettings>
+#include <QtCore/QFileInfo>
+
+#include <iostream>
+#include <memory>
+
+/**
+ * headless batch runner: runs one simulation without GUI and writes the results as CSV-files into the output directory,
+ * the parameters are taken from the command line, a config file (ini-format, same keys as the long options) could be
+ * given additionally, command line options overrule the config file.
+ * With --sweep, the grid of the sweep file is expanded into jobs, which are started as separate processes of this runner,
+ * the summaries of all jobs are collected in sweep.csv of the output directory
+ */
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("simulation_intersection_batch");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Headless simulation of the intersection scenario");
+    parser.addHelpOption();
+    parser.addOptions({
+        {"config", "config file (ini) with the parameters", "file"},
+        {"output", "output directory for the results", "dir", "results"},
+        {"width", "width of the intersection", "width", QString::number(InterSectionParameters::k)},
+        {"height", "height of the intersection", "height", QString::number(InterSectionParameters::m)},
+        {"cars", "maximum number of cars", "cars", QString::number(InterSectionParameters::maxCars)},
+        {"N", "prediction horizon", "N", QString::number(InterSectionParameters::N)},
+        {"T", "sampling step", "T", QString::number(InterSectionParameters::T)},
+        {"lambda", "weight of the control in the costs", "lambda", QString::number(InterSectionParameters::lambda)},
+        {"cellsize", "cell size of the grid", "cellsize", "0.5"},
+        {"radius", "robot diameter", "radius", QString::number(InterSectionParameters::robotDiameter)},
+        {"comm", "communication scheme (FULL, DIFFERENTIAL, MINMAXINTERVAL, MINMAXINTERVALMOVING, CONTINUOUS)", "scheme", "CONTINUOUS"},
+        {"priority", "priority criteria (e.g. FIXED, MINCLOSEDLOOPCOSTSWITHMEMORYTREE)", "criteria", "FIXED"},
+        {"workers", "threads for solving the OCPs of independent cars (0: ideal thread count)", "threads", QString::number(InterSectionParameters::ocpWorkerThreads)},
+        {"seed", "seed for the random arrival of cars (0: non-deterministic)", "seed", "0"},
+        {"sweep", "sweep file (ini) with the grid in section [sweep]: cellsize, comm, priority, N, cars, seed", "file"},
+        {"processes", "processes running in parallel for a sweep (0: ideal thread count)", "processes", "0"}
+    });
+    parser.process(app);
+
+    //config file gives the defaults, command line overrules them
+    std::unique_ptr<QSettings> config;
+    if (parser.isSet("config")) {
+        if (!QFileInfo(parser.value("config")).exists()) {
+            std::cerr << "config file not found: " << parser.value("config").toStdString() << std::endl;
+            return 1;
+        }
+        config.reset(new QSettings(parser.value("config"), QSettings::IniFormat));
+    }
+    auto value = [&](const QString& key) -> QString {
+        if (!parser.isSet(key) && config && config->contains(key)) {
+            return config->value(key).toString();
+        }
+        return parser.value(key);
+    };
+
+    //sweep: every job is a separate process with the remaining parameters as fixed arguments
+    if (parser.isSet("sweep")) {
+        SweepEngine sweep(QCoreApplication::applicationFilePath(), value("output"));
+        if (!sweep.loadGrid(parser.value("sweep"))) {
+            std::cerr << "cannot read sweep file: " << parser.value("sweep").toStdString() << std::endl;
+            return 1;
+        }
+        QStringList fixedArguments;
+        for (const QString& key : {"width", "height", "T", "lambda", "radius"}) {
+            fixedArguments << "--" + key << value(key);
+        }
+        sweep.setFixedArguments(fixedArguments);
+        sweep.setMaxProcesses(value("processes").toUInt());
+        QObject::connect(&sweep, SIGNAL(finished()), &app, SLOT(quit()));
+        QMetaObject::invokeMethod(&sweep, "start", Qt::QueuedConnection);
+        app.exec();
+        return (sweep.getFailedJobs() == 0) ? 0 : 1;
+    }
+
+    bool okComm = false, okPriority = false;
+    CommunicationScheme commScheme = SweepEngine::communicationSchemeFromText(value("comm"), &okComm);
+    PriorityCriteria priority = PrioritySorter::getCriteriaForText(value("priority"), &okPriority);
+    if (!okComm || !okPriority) {
+        std::cerr << "unknown communication scheme or priority criteria" << std::endl;
+        return 1;
+    }
+    std::shared_ptr<ResultWriter> writer = std::make_shared<ResultWriter>(value("output"));
+    if (!writer->isValid()) {
+        std::cerr << "cannot create output directory: " << value("output").toStdString() << std::endl;
+        return 1;
+    }
+    double cellSize = value("cellsize").toDouble();
+    SimulationThread* thread = new SimulationThread(value("width").toInt(), value("height").toInt(), value("cars").toInt(),
+                                                    value("N").toUInt(), value("T").toDouble(), value("lambda").toDouble(),
+                                                    {-1.0, 1.0}, {cellSize, cellSize}, nullptr, value("radius").toDouble(),
+                                                    priority, commScheme, PathAlgorithm::MPCCOBYLA);
+    thread->setOcpWorkerThreads(value("workers").toUInt());
+    thread->setRunMode(RunMode::FASTFORWARD);
+    thread->setSeed(value("seed").toUInt());
+    thread->setResultWriter(writer);
+    QObject::connect(thread, SIGNAL(simFinished()), &app, SLOT(quit()));
+    std::cout << "start headless simulation, results: " << writer->getOutputDir().toStdString() << std::endl;
+    thread->startSimulation();
+    int ret = app.exec();
+    thread->wait();
+    delete thread;
+    return ret;
+}
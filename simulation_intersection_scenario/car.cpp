@@ -5,10 +5,24 @@
 #include "dstarlite.h"
 #include "floydwarshallpathcalculation.h"
 #include "mpccontroller.h"
-#include "globalcarlist.h"
 
 #include <QtCore/QDebug>
 
+namespace {
+/**
+ * @brief registerName gets the ID of the car from the simulation, every car needs a live simulation,
+ * otherwise the IDs of different cars would collide
+ * @param name
+ * @param context
+ * @return
+ */
+CarId registerName(const QString& name, const std::weak_ptr<SimulationContext>& context) {
+    std::shared_ptr<SimulationContext> simulation = context.lock();
+    Q_ASSERT_X(simulation, "registerName", "car without simulation context");
+    return simulation->registerCarName(name);
+}
+}
+
 
 /**
  * @brief Car::Car constructs the car
@@ -19,30 +33,34 @@
  * @param lambda damping parameter for the control
  * @param pathAlgorithm chosen pathAlgorithm
  * @param T sampling interval
+ * @param context simulation, the car belongs to
  */
-Car::Car(const QString &name, const PathItem &start, const PathItem& target, const size_t &N, const double& lambda, const PathAlgorithm& pathAlgorithm, const double& T, const std::pair<double, double> &bounds) :
+Car::Car(const QString &name, const PathItem &start, const PathItem& target, const size_t &N, const double& lambda, const PathAlgorithm& pathAlgorithm, const double& T, const std::pair<double, double> &bounds,
+         const std::weak_ptr<SimulationContext>& context) :
     m_start(start),
     m_target(target),
     m_name(name),
+    m_id(registerName(name, context)),
     m_currentSolutionReserved(false),
     m_countNeighbourCars(0),
     m_countCommunicatedConstraints(0),
     m_differentConstraints(0),
     m_controlBounds(bounds),
     m_delta(0),
-    m_numberCellsReserved(0)
+    m_numberCellsReserved(0),
+    m_context(context)
 {
     if (pathAlgorithm == PathAlgorithm::ASTARCENTRALIZED || pathAlgorithm == PathAlgorithm::ASTARDECENTRALZED) {
-        m_pathCalc = std::make_shared<AStarPathCalculation>(name, start, target, T, pathAlgorithm);
+        m_pathCalc = std::make_shared<AStarPathCalculation>(name, start, target, N, T, pathAlgorithm, context);
     }
     else if (pathAlgorithm == PathAlgorithm::DSTAR) {
-        m_pathCalc = std::make_shared<DstarLite>(name, start, target, T);
+        m_pathCalc = std::make_shared<DstarLite>(name, start, target, T, context);
     }
     else if (pathAlgorithm == PathAlgorithm::FLOYDWARSHALL) {
-        m_pathCalc = std::make_shared<FloydWarshallPathCalculation>(name, start, target, T);
+        m_pathCalc = std::make_shared<FloydWarshallPathCalculation>(name, start, target, T, context);
     }
     else if (pathAlgorithm == PathAlgorithm::MPCCOBYLA) {
-        m_pathCalc = std::make_shared<MpcController>(name, start, target, N, lambda, bounds);
+        m_pathCalc = std::make_shared<MpcController>(name, start, target, N, lambda, bounds, context);
     }
 }
 
@@ -54,21 +72,25 @@ Car::Car(const QString &name, const PathItem &start, const PathItem& target, con
  * @param N horizon length to initialize controller
  * @param lambda fraction for control impact
  * @param pathAlgorithm chosen PathAlgorithm
+ * @param context simulation, the car belongs to
  */
-Car::Car(const QString& name, const std::vector<double>& start, const std::vector<double>& target, const size_t &N, const double &lambda, const PathAlgorithm &pathAlgorithm, const double& T, const std::pair<double, double> &bounds) :
+Car::Car(const QString& name, const std::vector<double>& start, const std::vector<double>& target, const size_t &N, const double &lambda, const PathAlgorithm &pathAlgorithm, const double& T, const std::pair<double, double> &bounds,
+         const std::weak_ptr<SimulationContext>& context) :
     m_start(PathItem()),
     m_target(PathItem()),
     m_name(name),
+    m_id(registerName(name, context)),
     m_currentSolutionReserved(false),
     m_countNeighbourCars(0),
     m_countCommunicatedConstraints(0),
     m_differentConstraints(0),
     m_delta(0),
-    m_numberCellsReserved(0)
+    m_numberCellsReserved(0),
+    m_context(context)
 {
     //m_mpcControl = std::make_shared<MpcController>(name, start, target, N, lambda);
     if (pathAlgorithm == PathAlgorithm::ASTARCENTRALIZED || pathAlgorithm == PathAlgorithm::ASTARDECENTRALZED) {
-        m_pathCalc = std::make_shared<AStarPathCalculation>(name, start, target, T, pathAlgorithm);
+        m_pathCalc = std::make_shared<AStarPathCalculation>(name, start, target, N, T, pathAlgorithm, context);
     }
     else if (pathAlgorithm == PathAlgorithm::DSTAR) {
         m_pathCalc = std::make_shared<DstarLite>(name, start, target);
@@ -77,7 +99,7 @@ Car::Car(const QString& name, const std::vector<double>& start, const std::vecto
         m_pathCalc = std::make_shared<FloydWarshallPathCalculation>(name, start, target);
     }
     else if (pathAlgorithm == PathAlgorithm::MPCCOBYLA) {
-        m_pathCalc = std::make_shared<MpcController>(name, start, target, N, lambda, bounds);
+        m_pathCalc = std::make_shared<MpcController>(name, start, target, N, lambda, bounds, context);
     }
 }
 
@@ -132,6 +154,14 @@ QString Car::getName() const {
     return m_name;
 }
 
+/**
+ * @brief Car::getId
+ * @return dense integer ID of the car, assigned at creation
+ */
+CarId Car::getId() const {
+    return m_id;
+}
+
 /**
  * @brief Car::calcOcpObjective calls the internal MPC-Controller and optimize in the <b>discrete setting</b>.
  * @param start  start position
@@ -161,7 +191,8 @@ bool Car::hasTargetReached() const {
         return (m_pathCalc->getSystemFunction()->getCurrentState() == m_target);
     }
     else if (InterSectionParameters::sysFuncUsage == SystemFunctionUsage::CONTINUOUS) {
-        return VectorHelper::norm2(VectorHelper::sub(m_pathCalc->getSystemFunction()->getCurrentContinuousState() , m_pathCalc->getTargetContinuous()) ) < 0.1;
+        return (Trajectory::StateVector::fromVector(m_pathCalc->getSystemFunction()->getCurrentContinuousState())
+                - Trajectory::StateVector::fromVector(m_pathCalc->getTargetContinuous())).norm2() < 0.1;
     }
 }
 
@@ -171,10 +202,36 @@ bool Car::hasTargetReached() const {
  * @return
  */
 bool Car::reservePrelimSolution() {
-    m_currentSolutionReserved = m_pathCalc->getSystemFunction()->reservePrelimSolution(m_pathCalc->getCurrentPrelimSolution());
+    return reserveSolution(m_pathCalc->getCurrentPrelimSolution());
+}
+
+/**
+ * @brief Car::reserveSolution reserves the given solution instead of the prelim. solution, e.g. a wait in the current cell
+ * @param solution cell and time of the next state
+ * @return true, if the solution is reserved and is applied in the next step
+ */
+bool Car::reserveSolution(const PathItem &solution) {
+    m_reservedSolution = solution;
+    m_currentSolutionReserved = m_pathCalc->getSystemFunction()->reservePrelimSolution(solution);
     return m_currentSolutionReserved;
 }
 
+/**
+ * @brief Car::rejectPrelimSolution marks the prelim. solution as not reserved without touching the reservations,
+ * the car stays in its state, if it is not reserved later
+ */
+void Car::rejectPrelimSolution() {
+    m_currentSolutionReserved = false;
+}
+
+/**
+ * @brief Car::getCurrentPrelimSolution
+ * @return calculated, but not applied next state
+ */
+PathItem Car::getCurrentPrelimSolution() const {
+    return m_pathCalc->getCurrentPrelimSolution();
+}
+
 //TODO: refactor Car::m_path, should only include Car::mpcFunction::systemState::m_path
 /**
  * @brief Car::applyNextState in <b>discrete scenarios</b> transfers the car to the next state if the solution can be applied
@@ -182,8 +239,8 @@ bool Car::reservePrelimSolution() {
 void Car::applyNextState() {
     //now take the new state
     if (m_currentSolutionReserved) {
-        m_pathCalc->getSystemFunction()->applyNextState(m_pathCalc->getCurrentPrelimSolution());
-        m_path.addPathItem(m_pathCalc->getCurrentPrelimSolution());
+        m_pathCalc->getSystemFunction()->applyNextState(m_reservedSolution);
+        m_path.addPathItem(m_reservedSolution);
     }
 }
 
@@ -293,7 +350,11 @@ std::vector<double> Car::getInitialControl(const double &t0, const double& T) {
 std::vector<std::shared_ptr<Car> > Car::getNeighbours(const unsigned int& distance) {
     std::vector<std::shared_ptr<Car> > neighbourList;
     PathItem& curPos = m_path.back();
-    for (const std::shared_ptr<Car> car : GlobalCarList::getInstance()) {
+    std::shared_ptr<SimulationContext> context = m_context.lock();
+    if (!context) {
+        return neighbourList;
+    }
+    for (const std::shared_ptr<Car> car : context->getCars()) {
         if (curPos.isNeighbouredTo(car->getCurrentState(), distance)) {
             //connect to neighbours - @TODO: not the best, as the Qt Macro cannot handle the shared ptr, therefore shared_ptr.get()
             connect(shared_from_this().get(), SIGNAL(sendMsg(std::shared_ptr<const Car>, const std::string)), car.get(), SLOT(getMsg(const std::string)));
@@ -429,12 +490,13 @@ std::vector<Constraint> Car::formulateConstraintsForNextCar(const std::vector<st
     m_occupiedCells.clear();
     std::vector<Constraint> constraintVec;
     //get the prediction with future states that the optimizer obtained
-    std::vector<std::vector<double> > x =
-            m_pathCalc->getSystemFunction()->getHolonomicSystemTrajectory(m_pathCalc->getSystemFunction()->getCurrentContinuousState(), u, t0, T, N);
+    Trajectory x =
+            m_pathCalc->getSystemFunction()->getHolonomicSystemTrajectory(m_pathCalc->getSystemFunction()->getCurrentContinuousState(), Trajectory::fromXd(u), t0, T, N);
     //get the cells which the trajectory should map to
     if (commScheme == CommunicationScheme::FULL || commScheme == CommunicationScheme::DIFFERENTIAL
             || commScheme == CommunicationScheme::MINMAXINTERVAL || commScheme == CommunicationScheme::MINMAXINTERVALMOVING) {
         Path cellToReserve = m_pathCalc->getSystemFunction()->mapPredictionToCells(x, t0, T);
+        const double cellSize = m_pathCalc->getSystemFunction()->getInterSection()->getCellSize();
         for (PathItem& pathItem : cellToReserve) {
             m_occupiedCells.insert(pathItem.getX(), pathItem.getY());
         }
@@ -443,28 +505,28 @@ std::vector<Constraint> Car::formulateConstraintsForNextCar(const std::vector<st
         for (const PathItem &pathItem : cellToReserve) {
             //construct the constraint with the middlepoint of the cell as center point
             //and make the constraint timedependant
-            constraintVec.emplace_back(Constraint({InterSection::getInstance()->getCellSize() * ((double)pathItem.getX() + 0.5),
-                                                   InterSection::getInstance()->getCellSize() * ((double)pathItem.getY() + 0.5)},
+            constraintVec.emplace_back(Constraint({cellSize * ((double)pathItem.getX() + 0.5),
+                                                   cellSize * ((double)pathItem.getY() + 0.5)},
                                                   pathItem.getTime(), SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin, m_controlBounds.second));
             step++;
             //m_occupiedCells.insert(pathItem.getX(), pathItem.getY());
         }
         if (!firstCar) {
-            constraintVec.emplace_back(Constraint({InterSection::getInstance()->getCellSize() * ((double)cellToReserve.back().getX() + 0.5),
-                                                   InterSection::getInstance()->getCellSize() * ((double)cellToReserve.back().getY() + 0.5)},
+            constraintVec.emplace_back(Constraint({cellSize * ((double)cellToReserve.back().getX() + 0.5),
+                                                   cellSize * ((double)cellToReserve.back().getY() + 0.5)},
                                                   cellToReserve.back().getTime() + T, SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin, m_controlBounds.second ) );
         }
     }//--SpacialSet::Quantised
     else if (commScheme == CommunicationScheme::CONTINUOUS) {
         double timePred = t0;
-        for (const std::vector<double> contPredStep : x) {
-            constraintVec.emplace_back(Constraint({contPredStep.at(0), contPredStep.at(1)},
+        for (size_t i = 0; i < x.size(); i++) {
+            constraintVec.emplace_back(Constraint({x.x(i), x.y(i)},
                                                   timePred, SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin, m_controlBounds.second));
             timePred +=T;
         }
         if (!firstCar) {
             timePred += T;
-            constraintVec.emplace_back(Constraint({x.back().at(0), x.back().at(1)}, timePred, SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin, m_controlBounds.second ) );
+            constraintVec.emplace_back(Constraint({x.back()[0], x.back()[1]}, timePred, SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin, m_controlBounds.second ) );
         }
     }//--SpacialSet::Continuous
 
@@ -578,12 +640,12 @@ std::vector<Constraint> Car::calculateMinMaxConstraintForNextCar(const std::vect
  */
 std::pair<double, double> Car::getDirectionOfTrajectory(const std::vector<double>& currentState, const std::vector<std::vector<double> >& u, const double &t0, const double& T, const size_t& N) const {
     std::pair<double, double> signs = {1.0, 1.0};
-    std::vector<std::vector<double> > x =
-            m_pathCalc->getSystemFunction()->getHolonomicSystemTrajectory(currentState, u, t0, T, N);
-    if (x.front().at(0) > x.back().at(0)) {
+    Trajectory x =
+            m_pathCalc->getSystemFunction()->getHolonomicSystemTrajectory(currentState, Trajectory::fromXd(u), t0, T, N);
+    if (x.front()[0] > x.back()[0]) {
         signs.first = -1.0;
     }
-    if (x.front().at(1) < x.back().at(1)) {
+    if (x.front()[1] < x.back()[1]) {
         signs.second = -1.0;
     }
     return signs;
@@ -599,19 +661,15 @@ std::pair<double, double> Car::getDirectionOfTrajectory(const std::vector<double
  * @param radius
  * @param dmin
  */
-void Car::constructConstraintFromMinMaxConstraints(const std::multimap<QString, Constraint> &constraints, const double& t0, const double& T, const size_t& N,
+void Car::constructConstraintFromMinMaxConstraints(const ConstraintStore &constraints, const double& t0, const double& T, const size_t& N,
                                                    const double& radius, const double& dmin, const CommunicationScheme& scheme) {
-    std::multimap<QString, Constraint> constructedConstraints;
-    //iterate over the full constraints vector, which includes the min-max constraints
-    for (auto itConstraint = constraints.begin(); itConstraint != constraints.end();) {
-        if (itConstraint->first != this->m_name) {
-            std::vector<Constraint> minMaxConstraints;
-            //now, get the range for min-max constraints for each car
-            //with the range, get all constraints from one car
-            auto itConstraintRange = constraints.equal_range(itConstraint->first);
-            for (auto itCarConstraint = itConstraintRange.first; itCarConstraint != itConstraintRange.second; ++itCarConstraint) {
-                minMaxConstraints.push_back(itCarConstraint->second);
-            }
+    std::vector<Constraint> constructedConstraints;
+    std::vector<ConstraintBox> boxConstraints;
+    //iterate over the cars of the store, which communicated the min-max constraints
+    for (const CarId& otherCar : constraints.getCars()) {
+        if (otherCar != m_id) {
+            //now, get all constraints from one car
+            std::vector<Constraint> minMaxConstraints = constraints.getConstraints(otherCar);
             //now evaluate, which is min and which is max constraint
             //std::pair<double, double> signs = {1.0, 1.0};
             std::vector<double> minPoint = {0.0, 0.0}, maxPoint = {0.0, 0.0};
@@ -671,25 +729,29 @@ void Car::constructConstraintFromMinMaxConstraints(const std::multimap<QString,
                 size_t minTimeNeeded = getMinimumTimeStepsForDistance(startPoint, endPoint, uMax, t0, T, N);
                 //delta is the time, when the car has to move
                 size_t delta = N - minTimeNeeded;
-                /*if (itConstraint->first == getName()) {
+                /*if (otherCar == m_id) {
                     m_delta = delta;
                 }*/
                 size_t constraintSkipped = 0;
+                //distance of one step and of the grid point to the end point do not depend on the time step
+                const Trajectory::StateVector end = Trajectory::StateVector::fromVector(endPoint);
+                const double stepDistance = (Trajectory::StateVector::fromVector(startPoint) - Trajectory::StateVector::fromVector(xNext)).norm2();
                 for (double x = minPoint.at(0); x <= maxPoint.at(0); x+= radius) {
                     for (double y = minPoint.at(1); y <= maxPoint.at(1); y += radius) {
+                        const double distanceToEnd = (end - Trajectory::StateVector({x, y})).norm2();
                         double t = t0;
                         for (size_t i = 0; i < N; i++) {
                             if (i > delta) {
                                 //distance of end point to the point to levae out has to be bigger then the time interval, the robot needs * (N-i) for the needed steps
-                                if (VectorHelper::norm2(VectorHelper::sub(endPoint, {x, y})) < (N - i) * VectorHelper::norm2(VectorHelper::sub(startPoint, xNext))) {
-                                    constructedConstraints.insert(std::pair<QString, Constraint>(itConstraint->first, Constraint({x, y}, t, SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin)));
+                                if (distanceToEnd < (N - i) * stepDistance) {
+                                    constructedConstraints.push_back(Constraint({x, y}, t, SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin));
                                 }
                                 else {
                                     constraintSkipped++;
                                 }
                             }
                             else {
-                                constructedConstraints.insert(std::pair<QString, Constraint>(itConstraint->first, Constraint({x, y}, t, SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin)));
+                                constructedConstraints.push_back(Constraint({x, y}, t, SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin));
                             }
                             t += T;
                         }
@@ -702,7 +764,7 @@ void Car::constructConstraintFromMinMaxConstraints(const std::multimap<QString,
                 if (minPoint.at(0) == maxPoint.at(0) && minPoint.at(1) == maxPoint.at(1)) {
                     t = t0;
                     for (size_t i = 0; i < N; i++) {
-                        constructedConstraints.insert(std::pair<QString, Constraint>(itConstraint->first, Constraint({minPoint.at(0), minPoint.at(1)}, t, SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin)));
+                        constructedConstraints.push_back(Constraint({minPoint.at(0), minPoint.at(1)}, t, SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin));
                         t += T;
                     }
                 }
@@ -712,7 +774,7 @@ void Car::constructConstraintFromMinMaxConstraints(const std::multimap<QString,
                         //the interval is constant over time interval [n, n+N]
                         t = t0;
                         for (size_t i = 0; i < N; i++) {
-                            constructedConstraints.insert(std::pair<QString, Constraint>(itConstraint->first, Constraint({minPoint.at(0), y}, t, SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin)));
+                            constructedConstraints.push_back(Constraint({minPoint.at(0), y}, t, SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin));
                             t += T;
                         }
                     }
@@ -723,7 +785,7 @@ void Car::constructConstraintFromMinMaxConstraints(const std::multimap<QString,
                         if (minPoint.at(1) == maxPoint.at(1)) {
                             t = t0;
                             for (size_t i = 0; i < N; i++) {
-                                constructedConstraints.insert(std::pair<QString, Constraint>(itConstraint->first, Constraint({x, minPoint.at(1)}, t, SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin)));
+                                constructedConstraints.push_back(Constraint({x, minPoint.at(1)}, t, SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin));
                                 t += T;
                             }
                         }
@@ -731,29 +793,43 @@ void Car::constructConstraintFromMinMaxConstraints(const std::multimap<QString,
                             //the interval is constant over time interval [n, n+N]
                             t = t0;
                             for (size_t i = 0; i < N; i++) {
-                                constructedConstraints.insert(std::pair<QString, Constraint>(itConstraint->first, Constraint({x, y}, t, SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin)));
+                                constructedConstraints.push_back(Constraint({x, y}, t, SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin));
                                 t += T;
                             }
                         }
                     }
                 }*/
-                for (double x = minPoint.at(0); x <= maxPoint.at(0); x+= radius) {
-                    for (double y = minPoint.at(1); y <= maxPoint.at(1); y += radius) {
-                        double t = t0;
-                        for (size_t i = 0; i < N; i++) {
-                            constructedConstraints.insert(std::pair<QString, Constraint>(itConstraint->first, Constraint({x, y}, t, SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin)));
-                            t += T;
+                if (InterSectionParameters::aggregateIntervalConstraints == 1) {
+                    //the point constraints would be set on the grid points min + k * radius <= max for all steps,
+                    //so one box from min to the last grid point covers all of them
+                    std::vector<double> lastPoint = minPoint;
+                    bool hasGridPoint = true;
+                    for (unsigned int j = 0; j < minPoint.size(); j++) {
+                        hasGridPoint = hasGridPoint && minPoint.at(j) <= maxPoint.at(j);
+                        for (double x = minPoint.at(j); x <= maxPoint.at(j); x+= radius) {
+                            lastPoint[j] = x;
+                        }
+                    }
+                    if (hasGridPoint) {
+                        boxConstraints.push_back(ConstraintBox(minPoint, lastPoint, t0, N, T, radius, dmin));
+                    }
+                }
+                else {
+                    for (double x = minPoint.at(0); x <= maxPoint.at(0); x+= radius) {
+                        for (double y = minPoint.at(1); y <= maxPoint.at(1); y += radius) {
+                            double t = t0;
+                            for (size_t i = 0; i < N; i++) {
+                                constructedConstraints.push_back(Constraint({x, y}, t, SystemFunctionUsage::CONTINUOUS, N, T, radius, dmin));
+                                t += T;
+                            }
                         }
                     }
                 }
             }
-            itConstraint = itConstraintRange.second;
         }//not the own constraints
-        else {
-            itConstraint++;
-        }
     }
-    setCurrentConstraints(constructedConstraints, t0, T);
+    m_pathCalc->setCurrentConstraints(constructedConstraints, t0, T);
+    m_pathCalc->setCurrentBoxConstraints(boxConstraints, t0, T);
 }
 
 /**
@@ -769,12 +845,15 @@ size_t Car::getNumberOfMovingIntervalConstraints(const size_t &minTimeMove, cons
     std::vector<double> uMax = {m_pathCalc->getControlBounds().second, m_pathCalc->getControlBounds().second};
     std::vector<double> xNext = m_pathCalc->getSystemFunction()->getHolonomicSystem(startPoint, uMax, t0, t0 + T);
     size_t constraintSkipped = 0;
+    const Trajectory::StateVector end = Trajectory::StateVector::fromVector(endPoint);
+    const double stepDistance = (Trajectory::StateVector::fromVector(startPoint) - Trajectory::StateVector::fromVector(xNext)).norm2();
     for (double x = minPoint.at(0); x <= maxPoint.at(0); x+= radius) {
         for (double y = minPoint.at(1); y <= maxPoint.at(1); y += radius) {
+            const double distanceToEnd = (end - Trajectory::StateVector({x, y})).norm2();
             for (size_t i = 0; i < N; i++) {
                 if (i > minTimeMove) {
                     //distance of end point to the point to levae out has to be bigger then the time interval, the robot needs * (N-i) for the needed steps
-                    if (VectorHelper::norm2(VectorHelper::sub(endPoint, {x, y})) >= (N - i) * VectorHelper::norm2(VectorHelper::sub(startPoint, xNext))) {
+                    if (distanceToEnd >= (N - i) * stepDistance) {
                         constraintSkipped++;
                     }
                 }
@@ -797,18 +876,19 @@ size_t Car::getNumberOfMovingIntervalConstraints(const size_t &minTimeMove, cons
 size_t Car::getMinimumTimeStepsForDistance(const std::vector<double>& start, const std::vector<double>& end, const std::vector<double>& uMax,
                                            const double &t0, const double &T, const size_t &N) const {
     std::vector<double> xNext = m_pathCalc->getSystemFunction()->getHolonomicSystem(start, uMax, t0, t0 + T);
-    double distOnce = VectorHelper::norm2(VectorHelper::sub(xNext, start));
-    double distStartEnd = VectorHelper::norm2(VectorHelper::sub(start, end));
+    const Trajectory::StateVector startState = Trajectory::StateVector::fromVector(start);
+    double distOnce = (Trajectory::StateVector::fromVector(xNext) - startState).norm2();
+    double distStartEnd = (startState - Trajectory::StateVector::fromVector(end)).norm2();
     size_t minSteps = std::floor(distStartEnd / distOnce);
     return minSteps;
 }
 
 /**
- * @brief Car::setCurrentConstraints
+ * @brief Car::setCurrentConstraints sets the constraints of all other cars
  * @param constraints
  */
-void Car::setCurrentConstraints(const std::multimap<QString, Constraint> &constraints, const double& t0, const double& T){
-   m_pathCalc->setCurrentConstraints(constraints, t0, T);
+void Car::setCurrentConstraints(const ConstraintStore &constraints, const double& t0, const double& T){
+   m_pathCalc->setCurrentConstraints(constraints.getConstraintsExcept(m_id), t0, T);
 }
 
 /**
@@ -841,20 +921,10 @@ void Car::createDirectionalConstraints(const unsigned int& interSectionWidth, co
 
 /**
  * @brief Car::removeOldPredictions removes the old prediction before starting the new optimization
- * @param constraintMap constraint Map with all predictions
- * @return
+ * @param constraints store with all predictions, the own ones are removed
  */
-std::multimap<QString, Constraint> Car::removeOldPredictions(const std::multimap<QString, Constraint>& constraints) const {
-    std::multimap<QString, Constraint> constraintMap = constraints;
-    for (auto it = constraintMap.begin(); it != constraintMap.end(); ) {
-        if (it->first == getName()) {
-            it = constraintMap.erase(it);
-        }
-        else {
-            it++;
-        }
-    }
-    return constraintMap;
+void Car::removeOldPredictions(ConstraintStore& constraints) const {
+    constraints.removeCar(m_id);
 }
 
 /**
@@ -934,12 +1004,29 @@ void Car::setControlRange(const double& lb, const double& ub) {
  * @return
  */
 std::vector<std::vector<double> > Car::getPredictedTrajectory(const std::vector<double>& currentState, const std::vector<double> &prediction, const double& t0, const double& T, const size_t& N) const {
-    std::vector<std::vector<double> > predictedTraject = m_pathCalc->getSystemFunction()->getHolonomicSystemTrajectory(currentState, VectorHelper::reshapeXd(prediction), t0, T, N);
+    return getPredictedStates(currentState, prediction, t0, T, N).toXd();
+}
+
+/**
+ * @brief Car::getPredictedStates same as getPredictedTrajectory in contiguous storage, the prediction is integrated without reshaping
+ * @return
+ */
+Trajectory Car::getPredictedStates(const std::vector<double>& currentState, const std::vector<double> &prediction, const double& t0, const double& T, const size_t& N) const {
+    Trajectory predictedTraject(N, currentState.size());
+    if (N == 0 || prediction.size() >= (N - 1) * currentState.size()) {
+        m_pathCalc->getSystemFunction()->getHolonomicSystemTrajectory(currentState, prediction.data(), t0, T, N, predictedTraject);
+    }
+    else {
+        //prediction too short, same as reshaping with zero control for the missing steps
+        std::vector<double> u(prediction);
+        u.resize(N * currentState.size(), 0.0);
+        m_pathCalc->getSystemFunction()->getHolonomicSystemTrajectory(currentState, u.data(), t0, T, N, predictedTraject);
+    }
     return predictedTraject;
 }
 
 Path Car::getPredictedTrajectoryCells(const std::vector<double> &currentState, const std::vector<double>& prediction, const double &t0, const double &T, const size_t &N, const double& radius) const {
-    return m_pathCalc->getSystemFunction()->mapPredictionToCells(getPredictedTrajectory(currentState, prediction, t0, T, N), t0, T, radius);
+    return m_pathCalc->getSystemFunction()->mapPredictionToCells(getPredictedStates(currentState, prediction, t0, T, N), t0, T, radius);
 }
 
 /**
@@ -1004,18 +1091,10 @@ size_t Car::getDelta() const {
   * @brief Car::setConstraintsFromPredecessors sets the constraints from all predecessors
   * @param constraints
   */
-void Car::setConstraintsFromPredecessors(std::multimap<QString, Constraint>& constraints, std::list<std::shared_ptr<Car> >& predecessors, const double& t0, const double& T) {
-     std::multimap<QString, Constraint> constraintsPred;
+void Car::setConstraintsFromPredecessors(const ConstraintStore& constraints, std::list<std::shared_ptr<Car> >& predecessors, const double& t0, const double& T) {
+     std::vector<Constraint> constraintsPred;
      for (auto itPred = predecessors.begin(); itPred != predecessors.end(); itPred++) {
-         std::shared_ptr<Car> carPred = (*itPred);
-         auto itRange = constraints.equal_range((*itPred)->getName());
-         //DEBUG
-         /*for (auto it = itRange.first; it != itRange.second; it++) {
-             std::pair<QString, Constraint> constrPair = *(it);
-             qDebug() << "car " << (*itPred)->getName() << ": (" << constrPair.second.getCenterPoint().front() << ", " << constrPair.second.getCenterPoint().back() << ")" << endl;
-         }*/
-         //--DEBUG
-         constraintsPred.insert(itRange.first, itRange.second);
+         constraints.appendConstraints((*itPred)->getId(), constraintsPred);
      }
      m_pathCalc->setCurrentConstraints(constraintsPred, t0, T);
 }
@@ -2,6 +2,8 @@
 #define CAR_H
 #include "pathcalculation.h"
 #include "costfunction.h"
+#include "carid.h"
+#include "constraintstore.h"
 #include "messages.pb.h"
 #include "../simulation-core/vectorhelper.h"
 #include "../simulation-core/simulationobject.h"
@@ -15,12 +17,17 @@ class Car : public SimulationObject, public std::enable_shared_from_this<Car>
 {
     Q_OBJECT
 public:
-    Car(const QString& name, const PathItem& start, const PathItem &target, const size_t& N, const double &lambda, const PathAlgorithm& pathAlgorithm, const double& T, const std::pair<double, double> &bounds = {-1.0, 1.0});
-    Car(const QString& name, const std::vector<double>& start, const std::vector<double> &target, const size_t &N, const double& lambda, const PathAlgorithm& pathAlgorithm, const double& T, const std::pair<double, double> &bounds = {-1.0, 1.0});
+    Car(const QString& name, const PathItem& start, const PathItem &target, const size_t& N, const double &lambda, const PathAlgorithm& pathAlgorithm, const double& T, const std::pair<double, double> &bounds = {-1.0, 1.0},
+        const std::weak_ptr<SimulationContext>& context = std::weak_ptr<SimulationContext>());
+    Car(const QString& name, const std::vector<double>& start, const std::vector<double> &target, const size_t &N, const double& lambda, const PathAlgorithm& pathAlgorithm, const double& T, const std::pair<double, double> &bounds = {-1.0, 1.0},
+        const std::weak_ptr<SimulationContext>& context = std::weak_ptr<SimulationContext>());
     PathItem calcOcpObjective(const PathItem &start);
     std::vector<std::vector<double> > calcOcpObjectiveContinuous(const std::vector<double> &start, const double &t0, const double &T);
     bool reservePrelimSolution();
+    bool reserveSolution(const PathItem& solution);
+    void rejectPrelimSolution();
     bool isCurrentPrelimSolutionValid() const;
+    PathItem getCurrentPrelimSolution() const;
     double getCurrentAbsDistance() const;
     double getOpenLoopCosts() const;
     double getClosedLoopCosts() const;
@@ -29,6 +36,7 @@ public:
 
     bool hasTargetReached() const;
     QString getName() const;
+    CarId getId() const;
     PathItem getStart() const;
     PathItem getCurrentState() const;
     std::vector<double> getCurrentStateContinuous() const;
@@ -53,14 +61,15 @@ public:
                                                            const size_t &N, const bool& firstCar, const double& radius = 1.1, const double& dmin = 0.5, const CommunicationScheme &commScheme = CommunicationScheme::FULL);
     std::vector<Constraint> calculateMinMaxConstraintForNextCar(const std::vector<std::vector<double> > &u, const double& t0, const double& T, const size_t &N,
                                                                      const bool& firstCar, const double& radius, const double& dmin, const CommunicationScheme &scheme);
-    void setCurrentConstraints(const std::multimap<QString, Constraint> &constraints, const double &t0, const double &T);
-    void constructConstraintFromMinMaxConstraints(const std::multimap<QString, Constraint> &constraints, const double& t0, const double& T, const size_t& N,
+    void setCurrentConstraints(const ConstraintStore &constraints, const double &t0, const double &T);
+    void constructConstraintFromMinMaxConstraints(const ConstraintStore &constraints, const double& t0, const double& T, const size_t& N,
                                                   const double &radius, const double &dmin, const CommunicationScheme& scheme);
     void createGlobalConstraints(const std::vector<double>& lb = {0.0, 0.0}, const std::vector<double>& ub = {(double)InterSectionParameters::k, (double)InterSectionParameters::m});
-    std::multimap<QString, Constraint> removeOldPredictions(const std::multimap<QString, Constraint>& constraints) const;
+    void removeOldPredictions(ConstraintStore& constraints) const;
     std::vector<double> getCurrentPrediction() const;
     void clearPrediction(std::vector<std::vector<double> > &pred);
     std::vector<std::vector<double> > getPredictedTrajectory(const std::vector<double> &currentState, const std::vector<double>& prediction, const double &t0, const double &T, const size_t &N) const;
+    Trajectory getPredictedStates(const std::vector<double> &currentState, const std::vector<double>& prediction, const double &t0, const double &T, const size_t &N) const;
     Path getPredictedTrajectoryCells(const std::vector<double> &currentState, const std::vector<double>& prediction, const double &t0, const double &T, const size_t &N, const double &radius) const;
     std::pair<double, double> getDirectionOfTrajectory(const std::vector<double>& currentState, const std::vector<std::vector<double> > &u, const double &t0, const double& T, const size_t& N) const;
     size_t getMinimumTimeStepsForDistance(const std::vector<double>& start, const std::vector<double>& end, const std::vector<double>& uMax, const double &t0, const double &T, const size_t &N) const;
@@ -75,7 +84,7 @@ public:
     bool testValidityConstraints(std::vector<Constraint> &constraints, const std::vector<double>& controlVector) const;
     bool testActiveConstraints(const std::vector<Constraint> &constraints, const std::vector<double>& prediction, const double& t0, const double& T, const double& N) const;
     std::shared_ptr<PathCalculation> getPathCalculator() const;
-    void setConstraintsFromPredecessors(std::multimap<QString, Constraint> &constraints, std::list<std::shared_ptr<Car> > &predecessors, const double &t0, const double &T);
+    void setConstraintsFromPredecessors(const ConstraintStore &constraints, std::list<std::shared_ptr<Car> > &predecessors, const double &t0, const double &T);
     size_t getNumberOfMovingIntervalConstraints(const size_t& minTimeMove, const std::vector<double> &minPoint, const std::vector<double> &maxPoint, const std::vector<double> &startPoint, const std::vector<double> &endPoint, const double &radius, const double &t0, const double &T, const size_t &N) const;
 
     size_t getDelta() const;
@@ -91,10 +100,14 @@ private:
     PathItem m_target;
     ///contains the path for the intersection (TODO: decide, whether this should be here or leave it in Systemfunction)
     Path m_path;
-    ///unique name of the car
+    ///unique name of the car, only for display and output
     QString m_name;
+    ///dense integer ID of the car, index of the per-car data
+    CarId m_id;
     ///current preliminary solution for this time is applied
     bool m_currentSolutionReserved;
+    ///reserved solution, which is applied in the next step (the preliminary solution or a wait)
+    PathItem m_reservedSolution;
     ///stores pointers to neighboured cars, is updated in every time step
     std::vector<std::shared_ptr<Car> > m_neighbourCars;
     ///number of neighboured cars
@@ -119,6 +132,8 @@ private:
     size_t m_delta;
     ///number of constraints / cells reserved
     size_t m_numberCellsReserved;
+    ///simulation, the car belongs to (intersection and the other cars)
+    std::weak_ptr<SimulationContext> m_context;
 };
 
 #endif // CAR_H
@@ -18,6 +18,7 @@ CarGroupQueue::CarGroupQueue(const std::vector<std::vector<std::shared_ptr<Car>
     m_cars(cars)
 {
     for (const std::shared_ptr<Car>& car : getOrderSeq()) {
+        indexCar(car);
         m_carTreeSuccessors.insert(std::pair<std::shared_ptr<Car>, std::list<std::shared_ptr<Car> > >(car, std::list<std::shared_ptr<Car> >()));
         m_carTreePredecessors.insert(std::pair<std::shared_ptr<Car>, std::list<std::shared_ptr<Car> > >(car, std::list<std::shared_ptr<Car> >()));
     }
@@ -32,6 +33,7 @@ CarGroupQueue::CarGroupQueue(const std::vector<std::shared_ptr<Car> >& cars) :
 {
     for (const std::shared_ptr<Car>& car : cars) {
         m_cars.at(0).push_back(car);
+        indexCar(car);
     }
     for (const std::shared_ptr<Car>& car : cars) {
         m_carTreeSuccessors.insert(std::pair<std::shared_ptr<Car>, std::list<std::shared_ptr<Car> > >(car, std::list<std::shared_ptr<Car> >()));
@@ -45,6 +47,7 @@ void CarGroupQueue::setType(const CarGroupQueueType& type) {
 
 void CarGroupQueue::appendCar(const std::shared_ptr<Car>& car) {
     m_cars.at(0).push_back(car);
+    indexCar(car);
 }
 
 /**
@@ -57,18 +60,20 @@ void CarGroupQueue::appendCar(const std::shared_ptr<Car>& car, const size_t& pos
         m_cars.push_back(std::vector<std::shared_ptr<Car> >());
     }
     m_cars.at(pos).push_back(car);
+    indexCar(car);
 }
 
 /**
- * @brief CarGroupQueue::storeOrder
+ * @brief CarGroupQueue::storeOrder appends the cars to row pos, missing rows are created
  * @param cars
  */
 void CarGroupQueue::storeOrder(const std::vector<std::shared_ptr<Car> >& cars, const size_t& pos) {
-    while (m_cars.size() < pos) {
+    while (m_cars.size() <= pos) {
         m_cars.push_back(std::vector<std::shared_ptr<Car> >());
     }
     for (const std::shared_ptr<Car>& car : cars) {
         m_cars.at(pos).push_back(car);
+        indexCar(car);
     }
 }
 
@@ -125,6 +130,7 @@ void CarGroupQueue::push_back(const std::shared_ptr<Car>& car) {
         m_cars.push_back(std::vector<std::shared_ptr<Car> >());
     }
     m_cars.at(0).push_back(car);
+    indexCar(car);
     m_carTreeSuccessors.insert(std::pair<std::shared_ptr<Car>, std::list<std::shared_ptr<Car> > >(car, std::list<std::shared_ptr<Car> >()));
     m_carTreePredecessors.insert(std::pair<std::shared_ptr<Car>, std::list<std::shared_ptr<Car> > >(car, std::list<std::shared_ptr<Car> >()));
 }
@@ -159,6 +165,7 @@ std::vector<std::shared_ptr<Car> >::iterator CarGroupQueue::removeCar(std::vecto
     while (itElemCar != vec.end() && !deleted) {
         if (*itElemCar == car) {
             col = vec.erase(itElemCar);
+            unindexCar(car);
             deleted = true;
             break;
         }
@@ -184,6 +191,7 @@ std::vector<std::shared_ptr<Car> >::iterator CarGroupQueue::removeCar(const std:
         while (itElemCar != (*itElemCol).end() && !deleted) {
             if (*itElemCar == car) {
                 col = (*itElemCol).erase(itElemCar);
+                unindexCar(car);
                 deleted = true;
                 break;
             }
@@ -226,6 +234,7 @@ void CarGroupQueue::clear() {
         (*itRow).clear();
         itRow++;
     }
+    m_carsById.clear();
 }
 
 /**
@@ -613,19 +622,13 @@ bool CarGroupQueue::contains(std::list<std::shared_ptr<Car> >& list, const std::
 }
 
 /**
- * @brief CarGroupQueue::getCarById get the car by the id
+ * @brief CarGroupQueue::getCarById get the car by the id from the index of the queue
  * @param id
- * @return
+ * @return car, nullptr if it is not in the queue
  */
-std::shared_ptr<Car> CarGroupQueue::getCarById(const QString& id) {
-    std::shared_ptr<Car> carFound = nullptr;
-    for (const std::shared_ptr<Car>& car : getOrderSeq()) {
-        if (car->getName() == id) {
-            carFound = car;
-            break;
-        }
-    }
-    return carFound;
+std::shared_ptr<Car> CarGroupQueue::getCarById(const CarId& id) const {
+    auto itCar = m_carsById.find(id);
+    return itCar != m_carsById.end() ? itCar->second : nullptr;
 }
 
 /**
@@ -647,6 +650,23 @@ void CarGroupQueue::insertCar(const std::shared_ptr<Car>& car, const size_t& row
     else if (itRow == m_cars.at(row).end()) {
         m_cars.at(row).push_back(car);
     }
+    indexCar(car);
+}
+
+/**
+ * @brief CarGroupQueue::indexCar adds the car to the index by ID
+ * @param car
+ */
+void CarGroupQueue::indexCar(const std::shared_ptr<Car>& car) {
+    m_carsById[car->getId()] = car;
+}
+
+/**
+ * @brief CarGroupQueue::unindexCar removes the car from the index by ID
+ * @param car
+ */
+void CarGroupQueue::unindexCar(const std::shared_ptr<Car>& car) {
+    m_carsById.erase(car->getId());
 }
 
 void CarGroupQueue::swap(const int& row1, const int& col1, const int& row2, const int& col2) {
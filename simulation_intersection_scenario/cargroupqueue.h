@@ -8,6 +8,7 @@
 #include <memory>
 
 #include <list>
+#include <unordered_map>
 
 /**
  * @brief The CargroupQueueType enum
@@ -74,7 +75,7 @@ public:
     std::shared_ptr<Car> getRoot(const std::shared_ptr<Car>& car);
     void showCarGroupTree(const std::shared_ptr<Car>& car);
     bool contains(std::list<std::shared_ptr<Car> >& list, const std::shared_ptr<Car>& car) const;
-    std::shared_ptr<Car> getCarById(const QString& id);
+    std::shared_ptr<Car> getCarById(const CarId& id) const;
     void insertCar(const std::shared_ptr<Car>& car, const size_t& row, const size_t& pos);
 private:
     ///CarGroupQueueType
@@ -84,8 +85,12 @@ private:
     ///map of tree-based priority order (predecessors, successor)
     std::map<std::shared_ptr<Car>, std::list<std::shared_ptr<Car> > > m_carTreeSuccessors;
     std::map<std::shared_ptr<Car>, std::list<std::shared_ptr<Car> > > m_carTreePredecessors;
+    ///all cars of the queue by their ID
+    std::unordered_map<CarId, std::shared_ptr<Car> > m_carsById;
 
     ///helper methods for getting correct order (hierarchy)
+    void indexCar(const std::shared_ptr<Car>& car);
+    void unindexCar(const std::shared_ptr<Car>& car);
 
 
 };
@@ -0,0 +1,89 @@
+#ifndef CARID_H
+#define CARID_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+///dense integer ID of a car, assigned at creation by the SimulationContext in the order 0, 1, 2, ...
+typedef size_t CarId;
+
+///marks the absence of a car, e.g. the owner of a free time slot
+constexpr CarId noCarId = static_cast<CarId>(-1);
+
+/**
+ * @brief The CarIndexed class stores one value per car in a flat vector indexed by the CarId, so the per-car data
+ * is read without map lookup or comparison of the names. It has the subset of the std::map interface used for
+ * the per-car data: operator[] creates the value, at() throws std::out_of_range for cars without a value.
+ */
+template <typename T>
+class CarIndexed
+{
+public:
+    /**
+     * @brief operator [] returns the value of the car, a default value is created if the car has none
+     * @param id
+     * @return
+     */
+    T& operator[](const CarId& id) {
+        if (id >= m_values.size()) {
+            m_values.resize(id + 1);
+            m_hasValue.resize(id + 1, 0);
+        }
+        m_hasValue[id] = 1;
+        return m_values[id];
+    }
+
+    const T& at(const CarId& id) const {
+        if (!contains(id)) {
+            throw std::out_of_range("CarIndexed::at: car has no value");
+        }
+        return m_values[id];
+    }
+
+    T& at(const CarId& id) {
+        if (!contains(id)) {
+            throw std::out_of_range("CarIndexed::at: car has no value");
+        }
+        return m_values[id];
+    }
+
+    bool contains(const CarId& id) const {
+        return id < m_hasValue.size() && m_hasValue[id];
+    }
+
+    /**
+     * @brief erase removes the value of the car, the slot is kept
+     * @param id
+     */
+    void erase(const CarId& id) {
+        if (contains(id)) {
+            m_values[id] = T();
+            m_hasValue[id] = 0;
+        }
+    }
+
+    void clear() {
+        m_values.clear();
+        m_hasValue.clear();
+    }
+
+    bool empty() const {
+        for (const char& hasValue : m_hasValue) {
+            if (hasValue) {
+                return false;
+            }
+        }
+        return true;
+    }
+private:
+    ///values indexed by the ID of the car
+    std::vector<T> m_values;
+    ///1, if the car has a value
+    std::vector<char> m_hasValue;
+};
+
+///controls of the horizon of each car (continuous setting)
+typedef CarIndexed<std::vector<std::vector<double> > > CarControls;
+
+#endif // CARID_H
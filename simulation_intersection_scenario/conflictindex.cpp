@@ -0,0 +1,174 @@
+#include "conflictindex.h"
+
+#include "car.h"
+#include "intersectionparameters.h"
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief ConflictIndex::ConflictIndex
+ * @param T width of a time slot, if T <= 0, the sampling time of the simulation is taken
+ */
+ConflictIndex::ConflictIndex(const double &T) :
+    m_T(T > 0.0 ? T : InterSectionParameters::T)
+{
+}
+
+/**
+ * @brief ConflictIndex::build maps the prediction of every car to the cells and inserts them to the index,
+ * cars without a solution are skipped
+ * @param cars cars to index
+ * @param continSol solution for the cars
+ * @param t0 start time
+ * @param T sampling step
+ * @param N horizon
+ * @param radius radius for one robot car
+ */
+void ConflictIndex::build(const std::vector<std::shared_ptr<Car> > &cars, const CarControls &continSol,
+                          const double &t0, const double &T, const size_t &N, const double &radius) {
+    clear();
+    for (const std::shared_ptr<Car>& car : cars) {
+        if (continSol.contains(car->getId())) {
+            insert(car, car->getPredictedTrajectoryCells(car->getCurrentStateContinuous(), VectorHelper::reshapeXdTo1d(continSol.at(car->getId())), t0, T, N, radius));
+        }
+    }
+}
+
+/**
+ * @brief ConflictIndex::getKey
+ * @param item cell with time
+ * @return key of the occupancy index
+ */
+CellTimeSlot ConflictIndex::getKey(const PathItem &item) const {
+    return CellTimeSlot{item.getX(), item.getY(), static_cast<int64_t>(std::llround(item.getTime() / m_T))};
+}
+
+/**
+ * @brief ConflictIndex::insert adds the occupied cells of the car, a car which is already indexed is ignored
+ * @param car
+ * @param cells predicted cells of the car
+ */
+void ConflictIndex::insert(const std::shared_ptr<Car> &car, const Path &cells) {
+    if (contains(car)) {
+        return;
+    }
+    const size_t index = m_cars.size();
+    m_cars.push_back(car);
+    if (car->getId() >= m_carIndex.size()) {
+        m_carIndex.resize(car->getId() + 1, -1);
+    }
+    m_carIndex[car->getId()] = static_cast<int>(index);
+    m_carKeys.push_back(std::vector<CellTimeSlot>());
+    std::vector<CellTimeSlot>& keys = m_carKeys.back();
+    keys.reserve(cells.size());
+    for (const PathItem& item : cells) {
+        const CellTimeSlot key = getKey(item);
+        std::vector<size_t>& bucket = m_occupancy[key];
+        //the cars are inserted one after another, so a duplicate of this car can only be the last one
+        if (bucket.empty() || bucket.back() != index) {
+            bucket.push_back(index);
+            keys.push_back(key);
+        }
+    }
+}
+
+/**
+ * @brief ConflictIndex::getCarIndex
+ * @param car
+ * @return index of the car, -1 if the car is not indexed
+ */
+int ConflictIndex::getCarIndex(const std::shared_ptr<Car> &car) const {
+    const CarId id = car->getId();
+    if (id >= m_carIndex.size()) {
+        return -1;
+    }
+    return m_carIndex[id];
+}
+
+/**
+ * @brief ConflictIndex::contains
+ * @param car
+ * @return true, if the prediction of the car is indexed
+ */
+bool ConflictIndex::contains(const std::shared_ptr<Car> &car) const {
+    return getCarIndex(car) != -1;
+}
+
+/**
+ * @brief ConflictIndex::hasConflict tests, if the two cars occupy the same cell at the same time
+ * @param car
+ * @param otherCar
+ * @return true, if there is a conflict
+ */
+bool ConflictIndex::hasConflict(const std::shared_ptr<Car> &car, const std::shared_ptr<Car> &otherCar) const {
+    const int index = getCarIndex(car);
+    const int otherIndex = getCarIndex(otherCar);
+    if (index == -1 || otherIndex == -1 || index == otherIndex) {
+        return false;
+    }
+    //look up the buckets of the car with less cells
+    const bool swapCars = m_carKeys[otherIndex].size() < m_carKeys[index].size();
+    const size_t lookUp = static_cast<size_t>(swapCars ? otherIndex : index);
+    const size_t search = static_cast<size_t>(swapCars ? index : otherIndex);
+    for (const CellTimeSlot& key : m_carKeys[lookUp]) {
+        const std::vector<size_t>& bucket = m_occupancy.at(key);
+        if (std::find(bucket.begin(), bucket.end(), search) != bucket.end()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief ConflictIndex::getConflictingIndices
+ * @param index index of the car
+ * @return indices of all cars in conflict with the car, in insertion order
+ */
+std::vector<size_t> ConflictIndex::getConflictingIndices(const size_t &index) const {
+    std::vector<size_t> conflicts;
+    for (const CellTimeSlot& key : m_carKeys[index]) {
+        for (const size_t& other : m_occupancy.at(key)) {
+            if (other != index) {
+                conflicts.push_back(other);
+            }
+        }
+    }
+    std::sort(conflicts.begin(), conflicts.end());
+    conflicts.erase(std::unique(conflicts.begin(), conflicts.end()), conflicts.end());
+    return conflicts;
+}
+
+/**
+ * @brief ConflictIndex::getConflictingCars
+ * @param car
+ * @return all cars which are in conflict with the car
+ */
+std::vector<std::shared_ptr<Car> > ConflictIndex::getConflictingCars(const std::shared_ptr<Car> &car) const {
+    std::vector<std::shared_ptr<Car> > conflictingCars;
+    const int index = getCarIndex(car);
+    if (index != -1) {
+        for (const size_t& other : getConflictingIndices(index)) {
+            conflictingCars.push_back(m_cars[other]);
+        }
+    }
+    return conflictingCars;
+}
+
+/**
+ * @brief ConflictIndex::size
+ * @return number of indexed cars
+ */
+size_t ConflictIndex::size() const {
+    return m_cars.size();
+}
+
+/**
+ * @brief ConflictIndex::clear removes all cars from the index
+ */
+void ConflictIndex::clear() {
+    m_cars.clear();
+    m_carIndex.clear();
+    m_carKeys.clear();
+    m_occupancy.clear();
+}
@@ -0,0 +1,74 @@
+#ifndef CONFLICTINDEX_H
+#define CONFLICTINDEX_H
+
+#include "path.h"
+#include "carid.h"
+
+#include <QtCore/QString>
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+class Car;
+
+/**
+ * @brief The CellTimeSlot struct is the key of the occupancy index, a cell (x, y) at the discretized time slot round(t / T)
+ */
+struct CellTimeSlot {
+    int64_t x;
+    int64_t y;
+    int64_t slot;
+    bool operator==(const CellTimeSlot& other) const {
+        return x == other.x && y == other.y && slot == other.slot;
+    }
+};
+
+/**
+ * @brief The CellTimeSlotHash struct combines the three coordinates of the key
+ */
+struct CellTimeSlotHash {
+    size_t operator()(const CellTimeSlot& key) const {
+        uint64_t h = static_cast<uint64_t>(key.x) * 0x9E3779B97F4A7C15ull;
+        h ^= static_cast<uint64_t>(key.y) + 0x7F4A7C159E3779B9ull + (h << 6) + (h >> 2);
+        h ^= static_cast<uint64_t>(key.slot) + 0x9E3779B97F4A7C15ull + (h << 6) + (h >> 2);
+        return static_cast<size_t>(h);
+    }
+};
+
+/**
+ * @brief The ConflictIndex class is a spatio-temporal occupancy index of the predicted cells of all cars.
+ * Every prediction is mapped to the cells only once, each (cell, time slot) holds the cars occupying it.
+ * Two cars are in conflict, if they share a cell at the same time (same as Path::findSimilarities),
+ * so a query only looks up the buckets of the cells of one car instead of comparing all pairs of paths.
+ */
+class ConflictIndex
+{
+public:
+    ConflictIndex(const double& T);
+    void build(const std::vector<std::shared_ptr<Car> >& cars, const CarControls& continSol,
+               const double& t0, const double& T, const size_t& N, const double& radius);
+    void insert(const std::shared_ptr<Car>& car, const Path& cells);
+    bool contains(const std::shared_ptr<Car>& car) const;
+    bool hasConflict(const std::shared_ptr<Car>& car, const std::shared_ptr<Car>& otherCar) const;
+    std::vector<std::shared_ptr<Car> > getConflictingCars(const std::shared_ptr<Car>& car) const;
+    size_t size() const;
+    void clear();
+private:
+    CellTimeSlot getKey(const PathItem& item) const;
+    int getCarIndex(const std::shared_ptr<Car>& car) const;
+    std::vector<size_t> getConflictingIndices(const size_t& index) const;
+    ///width of a time slot
+    double m_T;
+    ///indexed cars in insertion order
+    std::vector<std::shared_ptr<Car> > m_cars;
+    ///index of the car in m_cars by the ID of the car, -1 if the car is not indexed
+    std::vector<int> m_carIndex;
+    ///occupied (cell, time slot) of every car, without duplicates
+    std::vector<std::vector<CellTimeSlot> > m_carKeys;
+    ///cars (index in m_cars) occupying the (cell, time slot)
+    std::unordered_map<CellTimeSlot, std::vector<size_t>, CellTimeSlotHash> m_occupancy;
+};
+
+#endif // CONFLICTINDEX_H
@@ -0,0 +1,112 @@
+#include "conflictresolver.h"
+
+#include <cmath>
+#include <map>
+#include <numeric>
+#include <set>
+#include <unordered_set>
+#include <utility>
+
+/**
+ * @brief ConflictResolver::ConflictResolver
+ * @param T sampling time, width of a time slot
+ * @param maxRounds max. number of re-optimization rounds, after them the remaining cars wait
+ */
+ConflictResolver::ConflictResolver(const double &T, const unsigned int &maxRounds) :
+    m_T(T),
+    m_maxRounds(maxRounds)
+{
+}
+
+/**
+ * @brief ConflictResolver::assign reserves the solutions of one batch by priority
+ * @param requests requests of all cars
+ * @param batch indices of the requests of this round in descending priority
+ * @param reserve reserves a solution
+ * @return rejected indices in descending priority
+ */
+std::vector<size_t> ConflictResolver::assign(const std::vector<ReservationRequest> &requests, const std::vector<size_t> &batch,
+                                             const ReserveFunction &reserve) const {
+    //every car of the batch holds its current cell, until it is reserved to leave it
+    std::map<std::pair<int64_t, int64_t>, size_t> holders;
+    for (const size_t& index : batch) {
+        holders[std::make_pair(requests.at(index).current.getX(), requests.at(index).current.getY())] = index;
+    }
+    std::set<size_t> leaving;
+    std::unordered_set<CellTimeSlot, CellTimeSlotHash> taken;
+    std::vector<size_t> rejected;
+    for (const size_t& index : batch) {
+        const ReservationRequest& request = requests.at(index);
+        const CellTimeSlot key = getKey(request.solution);
+        const bool moves = request.solution.getX() != request.current.getX() || request.solution.getY() != request.current.getY();
+        bool blocked = taken.count(key) > 0;
+        if (!blocked && moves) {
+            auto holder = holders.find(std::make_pair(request.solution.getX(), request.solution.getY()));
+            blocked = holder != holders.end() && leaving.count(holder->second) == 0;
+        }
+        if (!blocked && reserve(index, request.solution)) {
+            taken.insert(key);
+            if (moves) {
+                leaving.insert(index);
+            }
+        }
+        else {
+            rejected.push_back(index);
+        }
+    }
+    return rejected;
+}
+
+/**
+ * @brief ConflictResolver::resolve reserves the solutions of all requests. The rejected requests are re-optimized together
+ * and assigned again, until all are reserved or the max. number of rounds is reached. The remaining requests get the wait
+ * in the current cell as solution, which is reserved as well, so the time of the car goes on.
+ * @param requests requests in descending priority, the solutions are replaced by the re-optimized solutions or the waits
+ * @param reserve reserves a solution
+ * @param reoptimize calculates new solutions once per round
+ * @param rounds number of re-optimization rounds, 0 if the first solutions were free of conflicts
+ * @return indices of the requests, which wait
+ */
+std::vector<size_t> ConflictResolver::resolve(std::vector<ReservationRequest> &requests, const ReserveFunction &reserve,
+                                              const ReoptimizeFunction &reoptimize, unsigned int &rounds) const {
+    rounds = 0;
+    std::vector<size_t> batch(requests.size());
+    std::iota(batch.begin(), batch.end(), 0);
+    std::vector<size_t> unresolved = assign(requests, batch, reserve);
+    while (!unresolved.empty() && rounds < m_maxRounds) {
+        rounds++;
+        reoptimize(requests, unresolved);
+        unresolved = assign(requests, unresolved, reserve);
+    }
+    for (const size_t& index : unresolved) {
+        requests.at(index).solution = getWait(requests.at(index));
+        reserve(index, requests.at(index).solution);
+    }
+    return unresolved;
+}
+
+/**
+ * @brief ConflictResolver::getWait
+ * @param request
+ * @return current cell of the car at the next time step
+ */
+PathItem ConflictResolver::getWait(const ReservationRequest &request) const {
+    return PathItem(request.current.getX(), request.current.getY(), request.current.getTime() + m_T);
+}
+
+/**
+ * @brief ConflictResolver::getMaxRounds
+ * @return max. number of re-optimization rounds
+ */
+unsigned int ConflictResolver::getMaxRounds() const {
+    return m_maxRounds;
+}
+
+/**
+ * @brief ConflictResolver::getKey
+ * @param item cell with time
+ * @return cell at the discretized time slot
+ */
+CellTimeSlot ConflictResolver::getKey(const PathItem &item) const {
+    return CellTimeSlot{item.getX(), item.getY(), static_cast<int64_t>(std::llround(item.getTime() / m_T))};
+}
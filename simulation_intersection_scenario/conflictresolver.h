@@ -0,0 +1,50 @@
+#ifndef CONFLICTRESOLVER_H
+#define CONFLICTRESOLVER_H
+
+#include "pathitem.h"
+#include "conflictindex.h"
+
+#include <functional>
+#include <vector>
+
+/**
+ * @brief The ReservationRequest struct is the solution of one car for the next step together with its current cell
+ */
+struct ReservationRequest {
+    ///current cell of the car
+    PathItem current;
+    ///preliminary solution for the next step
+    PathItem solution;
+};
+
+/**
+ * @brief The ConflictResolver class assigns the cells of the next step to the cars by priority in rounds.
+ * In each round the solutions of the remaining cars are reserved as one batch: a car is rejected, if a car of higher
+ * priority has taken its (cell, time slot) before, or if it moves into the cell of a car, which is not reserved to leave it.
+ * So every car holds its own cell at t+T as a wait, until its move is reserved. The rejected cars are re-optimized
+ * and requested again, after the last round the remaining cars wait in their cell.
+ */
+class ConflictResolver
+{
+public:
+    ///reserves the given cell and time for the request with the index, true if the reservation succeeds
+    typedef std::function<bool(const size_t&, const PathItem&)> ReserveFunction;
+    ///calculates new solutions for the requests with the given indices
+    typedef std::function<void(std::vector<ReservationRequest>&, const std::vector<size_t>&)> ReoptimizeFunction;
+
+    ConflictResolver(const double& T, const unsigned int& maxRounds);
+    std::vector<size_t> assign(const std::vector<ReservationRequest>& requests, const std::vector<size_t>& batch,
+                               const ReserveFunction& reserve) const;
+    std::vector<size_t> resolve(std::vector<ReservationRequest>& requests, const ReserveFunction& reserve,
+                                const ReoptimizeFunction& reoptimize, unsigned int& rounds) const;
+    PathItem getWait(const ReservationRequest& request) const;
+    unsigned int getMaxRounds() const;
+private:
+    CellTimeSlot getKey(const PathItem& item) const;
+    ///width of a time slot
+    double m_T;
+    ///max. number of re-optimization rounds
+    unsigned int m_maxRounds;
+};
+
+#endif // CONFLICTRESOLVER_H
@@ -22,7 +22,8 @@ Constraint::Constraint(const double &lowerBound, const double &upperBound, const
     m_N(N),
     m_t0(0.0),
     m_maxDynamics(0.0),
-    m_dmin(0.0)
+    m_dmin(0.0),
+    m_smoothed(false)
 {
     if (m_funcType == SystemFunctionUsage::DISCRETE) {
         m_validValues.reserve(upperBound - lowerBound);
@@ -49,7 +50,8 @@ Constraint::Constraint(const SystemFunctionUsage &funcType) :
     m_N(InterSectionParameters::N),
     m_t0(0.0),
     m_maxDynamics(0.0),
-    m_dmin(0.0)
+    m_dmin(0.0),
+    m_smoothed(false)
 {
 
 }
@@ -76,7 +78,8 @@ Constraint::Constraint(const std::vector<double> &centerPoint, const double& t0,
     m_N(N),
     m_t0(0.0),
     m_maxDynamics(maxDynamics),
-    m_dmin(dmin)
+    m_dmin(dmin),
+    m_smoothed(false)
 {
     m_gridSize += getSafetyMarginForRadius();
 }
@@ -85,7 +88,8 @@ Constraint::Constraint(const std::vector<double> &centerPoint, const double& t0,
  * @brief Constraint::Constraint
  * @param constraintVector assumed as std::vector<double> which contains the valid control values
  */
-Constraint::Constraint(std::vector<double>& constraintVector)
+Constraint::Constraint(std::vector<double>& constraintVector) :
+    m_smoothed(false)
 {
     m_validValues = constraintVector;
 }
@@ -94,7 +98,8 @@ Constraint::Constraint(std::vector<double>& constraintVector)
  * @brief Constraint::Constraint Default-Constructor
  */
 Constraint::Constraint() :
-m_funcType(SystemFunctionUsage::DISCRETE)
+m_funcType(SystemFunctionUsage::DISCRETE),
+m_smoothed(false)
 {
     //
 }
@@ -128,7 +133,9 @@ std::vector<double> &Constraint::getValidValues() {
 /**
  * @brief <b>discrete scenario</b>: Constraint::operator () encapsulate for NLOpt looks up if values of x are valid, returns -1 if it is found
  * otherwise 1 if not found and therefore the constraints are violated
- * <b>continuous scenario</b>: constraints are defined in the form \f$(-1)||\cdot||_{\infty}\f$-norm + m\_radius \leq 0\f$
+ * <b>continuous scenario</b>: constraints are defined in the form \f$(-1)||\cdot||_{\infty}\f$-norm + m\_radius \leq 0\f$,
+ * for the gradient-based algorithms the max-norm is smoothed by log-sum-exp (InterSectionParameters::constraintSmoothing),
+ * so the gradient is continuous, otherwise the exact max-norm is taken (see setSmoothed)
  * @param x vector with control values
  * @param grad
  * @param f_data
@@ -157,7 +164,7 @@ double Constraint::operator()(const std::vector<double> &u, std::vector<double>
         }
     }
     else if (m_funcType == SystemFunctionUsage::CONTINUOUS) {
-        std::vector<std::vector<double> > x = m_actualSystemFunc->getHolonomicSystemTrajectory(m_actualSystemFunc->getCurrentContinuousState(), VectorHelper::reshapeXd(u), m_t0, m_T, m_N);
+        const Trajectory& x = m_actualSystemFunc->getCachedHolonomicSystemTrajectory(u, m_t0, m_T, m_N);
         //std::vector<double> x = m_actualSystemFunc->getHolonomicSystem(m_actualSystemFunc->getCurrentContinuousState().back(), VectorHelper::reshape2d(u), m_t0, m_T);
         double maxNorm = 0.0;
         //for (unsigned int i = 0; i < x.size(); i++) {
@@ -169,28 +176,53 @@ double Constraint::operator()(const std::vector<double> &u, std::vector<double>
         int position = (int)pos;
             Q_ASSERT_X(position >= 0, typeid(this).name(), "position < 0");
         double kMaxNorm = 0.0;
+        std::vector<double> weights(m_centerPoint.size(), 0.0);
         if (position >= 0 && position < x.size()) {
-            kMaxNorm = VectorHelper::getInfinityNorm(VectorHelper::sub(x.at(position), m_centerPoint));
-            kMaxNorm = (-1.0)*kMaxNorm + m_gridSize;
+            const double* xp = x.at(position);
+            double maxAbs = 0.0;
+            //component with the maximum absolute difference to the center point
+            unsigned int maxComp = 0;
+            for (unsigned int j = 0; j < m_centerPoint.size(); j++) {
+                if (std::abs(xp[j] - m_centerPoint[j]) > maxAbs) {
+                    maxAbs = std::abs(xp[j] - m_centerPoint[j]);
+                    maxComp = j;
+                }
+            }
+            double norm = maxAbs;
+            if (m_smoothed) {
+                //the max-norm is smoothed by log-sum-exp over +-(x_p(j)-c(j)), shifted by its upper bound log(2*dim)/beta,
+                //so the smoothed constraint is never weaker than -||x_p-c||_inf + r and is differentiable everywhere
+                const double beta = InterSectionParameters::constraintSmoothing;
+                double sum = 0.0;
+                for (unsigned int j = 0; j < m_centerPoint.size(); j++) {
+                    const double diff = xp[j] - m_centerPoint[j];
+                    const double plus = std::exp(beta * (diff - maxAbs));
+                    const double minus = std::exp(beta * (-diff - maxAbs));
+                    sum += plus + minus;
+                    weights[j] = plus - minus;
+                }
+                norm = maxAbs + std::log(sum) / beta - getSmoothingGap(m_centerPoint.size());
+                for (double& weight : weights) {
+                    weight /= sum;
+                }
+            }
+            else if (maxAbs > 0.0) {
+                //subgradient of the exact max-norm: only the component with the maximum absolute value contributes
+                weights[maxComp] = (xp[maxComp] > m_centerPoint[maxComp]) ? 1.0 : -1.0;
+            }
+            kMaxNorm = (-1.0)*norm + m_gridSize;
         }
         maxNorm = kMaxNorm;
-        if (maxNorm > 0.0) {
-            //qDebug() << "Constraint at: (" << this->getCenterPoint().at(0) << "," << this->getCenterPoint().at(1) << ") not valid: " << kMaxNorm;
-        }
-        else {
-            //qDebug() << "Constraint at: (" << this->getCenterPoint().at(0) << "," << this->getCenterPoint().at(1) << ") valid: " << kMaxNorm;
-        }
         //}
-        //derivative here is the absolute value of the maximum of the vector (x_pi-c), therefore -1 or 1
+        //derivative with respect to x_p(j) is -weight(j), this is propagated to all controls applied before step p
         if (!grad.empty()) {
-            int gradPos = 0;
-            for (unsigned int i = 0; i < x.size(); i++) {
-                std::vector<double> diff = VectorHelper::sub(x.at(i), m_centerPoint);
-                std::vector<double> absDeriv = VectorHelper::getDerivOfAbsValue(diff);
-                for (unsigned int j = 0; j < absDeriv.size(); j++) {
-                    grad[gradPos] = absDeriv.at(j);
-                    gradPos++;
+            std::fill(grad.begin(), grad.end(), 0.0);
+            if (position >= 0 && position < x.size()) {
+                Trajectory dStates(x.size(), x.dimension());
+                for (unsigned int j = 0; j < weights.size(); j++) {
+                    dStates(position, j) = -weights[j];
                 }
+                m_actualSystemFunc->propagateStateGradientToControl(dStates, m_T, grad);
             }
         }
         return maxNorm;
@@ -213,6 +245,33 @@ void Constraint::setActualSystem(const std::shared_ptr<SystemFunction> &systemFu
     m_N = N;
 }
 
+/**
+ * @brief Constraint::setSmoothed selects the form of the continuous constraint, the smoothed max-norm for the gradient-based
+ * algorithms or the exact max-norm for the derivative-free ones
+ * @param smoothed true, if the max-norm should be smoothed by log-sum-exp
+ */
+void Constraint::setSmoothed(const bool& smoothed) {
+    m_smoothed = smoothed;
+}
+
+/**
+ * @brief Constraint::isSmoothed
+ * @return true, if the max-norm is smoothed by log-sum-exp
+ */
+bool Constraint::isSmoothed() const {
+    return m_smoothed;
+}
+
+/**
+ * @brief Constraint::getSmoothingGap maximal difference between the exact and the smoothed max-norm,
+ * the smoothed max-norm lies in \f$[||\cdot||_{\infty} - \frac{\log(2 dim)}{\beta}, ||\cdot||_{\infty}]\f$
+ * @param dimension dimension of the state
+ * @return \f$\frac{\log(2 dim)}{\beta}\f$ with \f$\beta\f$ = InterSectionParameters::constraintSmoothing
+ */
+double Constraint::getSmoothingGap(const size_t& dimension) {
+    return std::log(2.0 * dimension) / InterSectionParameters::constraintSmoothing;
+}
+
 /**
  * @brief Constraint::getConstraintTime get the timestamp for which this constraint holds
  * @return timestamp as double
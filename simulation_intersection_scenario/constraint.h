@@ -28,6 +28,9 @@ public:
     std::vector<double>& getValidValues();
     void setActualSystem(const std::shared_ptr<SystemFunction> &systemFunc, const double& curTime, const double &T, const size_t& N);
     double getConstraintTime() const;
+    void setSmoothed(const bool& smoothed);
+    bool isSmoothed() const;
+    static double getSmoothingGap(const size_t& dimension);
     std::vector<double> getCenterPoint() const;
     double getSafetyMarginForRadius() const;
     double getCurrentGridSize() const;
@@ -58,6 +61,8 @@ private:
     double m_maxDynamics;
     ///minimum distance between two cars
     double m_dmin;
+    ///true, if the max-norm is smoothed by log-sum-exp (gradient-based algorithms), otherwise the exact max-norm is taken
+    bool m_smoothed;
 };
 
 #endif // CONSTRAINT_H
@@ -0,0 +1,179 @@
+#include "constraintbox.h"
+#include "constraint.h"
+
+#include <algorithm>
+#include <limits>
+
+/**
+ * @brief ConstraintBox::ConstraintBox
+ * @param lb lower left grid point of the interval
+ * @param ub upper right grid point of the interval
+ * @param t0 time of the first step, the box holds for the steps t0 until t0 + (N-1)T
+ * @param N horizon
+ * @param T step
+ * @param gridSize radius of one point constraint
+ * @param dmin minimum distance between two cars
+ * @param maxDynamics upper boundary for dynamics
+ */
+ConstraintBox::ConstraintBox(const std::vector<double>& lb, const std::vector<double>& ub, const double& t0, const size_t& N, const double& T,
+                             const double& gridSize, const double& dmin, const double& maxDynamics) :
+    m_lb(lb),
+    m_ub(ub),
+    m_tConstraint(t0),
+    m_N(N),
+    m_T(T),
+    m_t0(0.0),
+    m_gridSize(Constraint::getOverallMargin(gridSize, dmin, maxDynamics, T)),
+    m_actualSystemFunc(nullptr)
+{
+}
+
+/**
+ * @brief ConstraintBox::wrapConstraintObject encapsulate for NLOpt the function as function object (nlopt::mfunc)
+ * @param m number of constraints (one for each step)
+ * @param result constraint values
+ * @param n dimension of the control
+ * @param u control
+ * @param grad gradient (m x n), nullptr if not needed
+ * @param data
+ */
+void ConstraintBox::wrapConstraintObject(unsigned m, double* result, unsigned n, const double* u, double* grad, void* data) {
+    (*reinterpret_cast<ConstraintBox*>(data)) (m, result, n, u, grad);
+}
+
+/**
+ * @brief ConstraintBox::operator () evaluates \f$-d_{\infty}(x_p, [lb, ub]) + r\f$ for all steps p at once. The derivative is
+ * \f$\mp 1\f$ in the component which determines the distance, with \f$x_p = x_0 + T\sum_{k<p}u_k\f$ it is the same for all controls before p
+ * @param m number of constraints (one for each step)
+ * @param result constraint values
+ * @param n dimension of the control
+ * @param u control
+ * @param grad gradient (m x n), nullptr if not needed
+ */
+void ConstraintBox::operator()(unsigned m, double* result, unsigned n, const double* u, double* grad) {
+    const size_t dim = m_lb.size();
+    if (grad) {
+        std::fill(grad, grad + m * n, 0.0);
+    }
+    if (!m_actualSystemFunc) {
+        std::fill(result, result + m, -m_gridSize);
+        return;
+    }
+    m_control.assign(u, u + n);
+    const Trajectory& x = m_actualSystemFunc->getCachedHolonomicSystemTrajectory(m_control, m_t0, m_T, m_N);
+    //same step as in the point constraints
+    double pos = m_tConstraint*1/m_T - m_t0*1/m_T;
+    const int first = (int)pos;
+    for (size_t p = 0; p < m; p++) {
+        if ((int)p < first || p >= x.size()) {
+            //step is not covered by the box
+            result[p] = -m_gridSize;
+            continue;
+        }
+        const double* xp = x.at(p);
+        double distance = -std::numeric_limits<double>::max();
+        size_t maxComp = 0;
+        double deriv = 0.0;
+        for (size_t j = 0; j < dim; j++) {
+            if (m_lb[j] - xp[j] > distance) {
+                distance = m_lb[j] - xp[j];
+                maxComp = j;
+                deriv = 1.0;
+            }
+            if (xp[j] - m_ub[j] > distance) {
+                distance = xp[j] - m_ub[j];
+                maxComp = j;
+                deriv = -1.0;
+            }
+        }
+        result[p] = (-1.0)*distance + m_gridSize;
+        if (grad) {
+            //u_k influences all states from x_{k+1}
+            double* row = grad + p * n;
+            for (size_t k = 0; k < p && (k * dim + maxComp) < n; k++) {
+                row[k * dim + maxComp] = m_T * deriv;
+            }
+        }
+    }
+}
+
+/**
+ * @brief ConstraintBox::setActualSystem sets the actual system for which the constraint should be applied
+ * @param systemFunc the current system, this should obey this constraint
+ * @param t0 current simulation time
+ * @param T step
+ * @param N horizon
+ */
+void ConstraintBox::setActualSystem(const std::shared_ptr<SystemFunction> &systemFunc, const double& t0, const double& T, const size_t& N) {
+    m_actualSystemFunc = systemFunc;
+    m_t0 = t0;
+    m_T = T;
+    m_N = N;
+}
+
+/**
+ * @brief ConstraintBox::getSignedDistance
+ * @param x state
+ * @return signed distance of x to the box in \f$||\cdot||_{\infty}\f$-norm, negative inside the box
+ */
+double ConstraintBox::getSignedDistance(const std::vector<double>& x) const {
+    double distance = -std::numeric_limits<double>::max();
+    for (size_t j = 0; j < m_lb.size() && j < x.size(); j++) {
+        distance = std::max(distance, std::max(m_lb[j] - x[j], x[j] - m_ub[j]));
+    }
+    return distance;
+}
+
+/**
+ * @brief ConstraintBox::getMaxViolation
+ * @param controlVector
+ * @return maximum constraint value over all steps, the constraint is valid if it is <= 0
+ */
+double ConstraintBox::getMaxViolation(const std::vector<double>& controlVector) {
+    if (m_N == 0) {
+        return -m_gridSize;
+    }
+    std::vector<double> result(m_N, 0.0);
+    operator()(m_N, result.data(), controlVector.size(), controlVector.data(), nullptr);
+    return *std::max_element(result.begin(), result.end());
+}
+
+/**
+ * @brief ConstraintBox::getLowerBound
+ * @return
+ */
+const std::vector<double>& ConstraintBox::getLowerBound() const {
+    return m_lb;
+}
+
+/**
+ * @brief ConstraintBox::getUpperBound
+ * @return
+ */
+const std::vector<double>& ConstraintBox::getUpperBound() const {
+    return m_ub;
+}
+
+/**
+ * @brief ConstraintBox::getConstraintTime
+ * @return time of the first step for which the box holds
+ */
+double ConstraintBox::getConstraintTime() const {
+    return m_tConstraint;
+}
+
+/**
+ * @brief ConstraintBox::getCurrentGridSize
+ * @return radius + safety margin
+ */
+double ConstraintBox::getCurrentGridSize() const {
+    return m_gridSize;
+}
+
+/**
+ * @brief ConstraintBox::getDimension
+ * @return number of constraint values, one for each step of the horizon
+ */
+size_t ConstraintBox::getDimension() const {
+    return m_N;
+}
@@ -0,0 +1,52 @@
+#ifndef CONSTRAINTBOX_H
+#define CONSTRAINTBOX_H
+
+#include "systemfunction.h"
+
+#include <memory>
+#include <vector>
+
+/**
+ * @brief The ConstraintBox class aggregates the interval (min/max) constraints of one car into a single vector-valued constraint.
+ * The point constraints of the grid points inside \f$[lb, ub]\f$ with margin \f$r\f$ cover the box \f$[lb - r, ub + r]\f$,
+ * so for each step p of the horizon one component \f$-d_{\infty}(x_p, [lb, ub]) + r \leq 0\f$ is evaluated,
+ * where \f$d_{\infty}\f$ is the signed distance in the \f$||\cdot||_{\infty}\f$-norm (negative inside the box).
+ * All N components are given to NLopt as one mconstraint with one trajectory evaluation.
+ */
+class ConstraintBox
+{
+public:
+    ConstraintBox(const std::vector<double>& lb, const std::vector<double>& ub, const double& t0, const size_t& N, const double& T,
+                  const double& gridSize, const double& dmin, const double& maxDynamics = 1.0);
+    static void wrapConstraintObject(unsigned m, double* result, unsigned n, const double* u, double* grad, void* data);
+    void operator()(unsigned m, double* result, unsigned n, const double* u, double* grad);
+    void setActualSystem(const std::shared_ptr<SystemFunction> &systemFunc, const double& t0, const double& T, const size_t& N);
+    double getSignedDistance(const std::vector<double>& x) const;
+    double getMaxViolation(const std::vector<double>& controlVector);
+    const std::vector<double>& getLowerBound() const;
+    const std::vector<double>& getUpperBound() const;
+    double getConstraintTime() const;
+    double getCurrentGridSize() const;
+    size_t getDimension() const;
+private:
+    ///lower left corner of the box
+    std::vector<double> m_lb;
+    ///upper right corner of the box
+    std::vector<double> m_ub;
+    ///time of the first step for which the box holds
+    double m_tConstraint;
+    ///horizon length
+    size_t m_N;
+    ///step
+    double m_T;
+    ///current simulation time
+    double m_t0;
+    ///radius + safety margin, same as for the point constraints
+    double m_gridSize;
+    ///actual system which has to obey the states
+    std::shared_ptr<SystemFunction> m_actualSystemFunc;
+    ///control given by NLopt as vector for the trajectory cache
+    std::vector<double> m_control;
+};
+
+#endif // CONSTRAINTBOX_H
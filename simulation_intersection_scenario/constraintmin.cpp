@@ -3,6 +3,8 @@
 
 #include <QtCore/QDebug>
 
+#include <algorithm>
+
 /**
  * @brief ConstraintMin::ConstraintMin solves $\f x(pos) \geq lb\f$
  * @param lb lower bound
@@ -45,17 +47,13 @@ double ConstraintMin::operator()(const std::vector<double> &u, std::vector<doubl
     }
     else if (m_funcType == SystemFunctionUsage::CONTINUOUS) {
         if (m_actualSystemFunc) {
-            std::vector<std::vector<double> > x = m_actualSystemFunc->getHolonomicSystemTrajectory(m_actualSystemFunc->getCurrentContinuousState(), VectorHelper::reshapeXd(u), m_t0, m_T, m_N);
-            std::vector<double> x1d = VectorHelper::reshapeXdTo1d(x);
+            const std::vector<double>& x1d = m_actualSystemFunc->getCachedHolonomicSystemTrajectory1d(u, m_t0, m_T, m_N);
             if (!grad.empty()) {
-                for (unsigned int i = 0; i < x1d.size(); i++) {
-                    if (x1d.at(0)*(-1) < 0) {
-                        grad[i] = -1.0;
-                    }
-                    else {
-                        grad[i] = 1.0;
-                    }
-                }
+                //x(pos) is the state pos / dim in component pos % dim, depending on all previous controls
+                std::fill(grad.begin(), grad.end(), 0.0);
+                Trajectory dStates(m_N, InterSectionParameters::vectorDimension);
+                dStates(m_pos / InterSectionParameters::vectorDimension, m_pos % InterSectionParameters::vectorDimension) = -1.0;
+                m_actualSystemFunc->propagateStateGradientToControl(dStates, m_T, grad);
             }
             double min = (-1)*x1d.at(m_pos) + m_lb /*+ 0.5*/; //TODO: tight constraints
             if (min > 0.0) {
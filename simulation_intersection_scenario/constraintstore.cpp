@@ -0,0 +1,229 @@
+#include "constraintstore.h"
+
+#include <algorithm>
+
+/**
+ * @brief ConstraintStore::ConstraintStore
+ */
+ConstraintStore::ConstraintStore() :
+    m_size(0)
+{
+}
+
+/**
+ * @brief ConstraintStore::insert adds the constraint for the owner car, constraints with the same time are kept
+ * @param car owner of the constraint
+ * @param constraint
+ */
+void ConstraintStore::insert(const CarId& car, const Constraint& constraint) {
+    if (car >= m_buckets.size()) {
+        m_buckets.resize(car + 1);
+    }
+    m_buckets[car][constraint.getConstraintTime()].push_back(constraint);
+    m_size++;
+}
+
+/**
+ * @brief ConstraintStore::replace removes the constraints of the car with the same time and inserts the constraint,
+ * so each car has at most one constraint per time instant
+ * @param car owner of the constraint
+ * @param constraint
+ */
+void ConstraintStore::replace(const CarId& car, const Constraint& constraint) {
+    removeTimeSlot(car, constraint.getConstraintTime());
+    insert(car, constraint);
+}
+
+/**
+ * @brief ConstraintStore::removeTimeSlot removes all constraints of the car for the time
+ * @param car
+ * @param time
+ * @return true, if constraints were removed
+ */
+bool ConstraintStore::removeTimeSlot(const CarId& car, const double& time) {
+    if (car >= m_buckets.size()) {
+        return false;
+    }
+    auto itSlot = m_buckets[car].find(time);
+    if (itSlot == m_buckets[car].end()) {
+        return false;
+    }
+    m_size -= itSlot->second.size();
+    m_buckets[car].erase(itSlot);
+    return true;
+}
+
+/**
+ * @brief ConstraintStore::removeCar removes all constraints of the car
+ * @param car
+ * @return number of removed constraints
+ */
+size_t ConstraintStore::removeCar(const CarId& car) {
+    if (car >= m_buckets.size()) {
+        return 0;
+    }
+    size_t removed = 0;
+    for (const auto& slot : m_buckets[car]) {
+        removed += slot.second.size();
+    }
+    m_buckets[car].clear();
+    m_size -= removed;
+    return removed;
+}
+
+/**
+ * @brief ConstraintStore::removeBefore removes the constraints with a smaller time than the given one,
+ * as the buckets are sorted by time only the first slots of each car are touched
+ * @param time
+ * @return number of removed constraints
+ */
+size_t ConstraintStore::removeBefore(const double& time) {
+    size_t removed = 0;
+    for (TimeBuckets& buckets : m_buckets) {
+        auto itEnd = buckets.lower_bound(time);
+        for (auto itSlot = buckets.begin(); itSlot != itEnd; ++itSlot) {
+            removed += itSlot->second.size();
+        }
+        buckets.erase(buckets.begin(), itEnd);
+    }
+    m_size -= removed;
+    return removed;
+}
+
+/**
+ * @brief ConstraintStore::merge inserts all constraints of the other store
+ * @param other
+ */
+void ConstraintStore::merge(const ConstraintStore& other) {
+    if (other.m_buckets.size() > m_buckets.size()) {
+        m_buckets.resize(other.m_buckets.size());
+    }
+    for (size_t car = 0; car < other.m_buckets.size(); car++) {
+        for (const auto& slot : other.m_buckets[car]) {
+            std::vector<Constraint>& bucket = m_buckets[car][slot.first];
+            bucket.insert(bucket.end(), slot.second.begin(), slot.second.end());
+        }
+    }
+    m_size += other.m_size;
+}
+
+/**
+ * @brief ConstraintStore::contains looks up the constraint (same center and time, see Constraint::operator==) for any car
+ * @param constraint
+ * @return true, if an equal constraint is stored
+ */
+bool ConstraintStore::contains(const Constraint& constraint) const {
+    for (size_t car = 0; car < m_buckets.size(); car++) {
+        if (contains(car, constraint)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief ConstraintStore::contains looks up the constraint in the time slot of the car
+ * @param car
+ * @param constraint
+ * @return true, if the car has an equal constraint
+ */
+bool ConstraintStore::contains(const CarId& car, const Constraint& constraint) const {
+    if (car >= m_buckets.size()) {
+        return false;
+    }
+    auto itSlot = m_buckets[car].find(constraint.getConstraintTime());
+    if (itSlot == m_buckets[car].end()) {
+        return false;
+    }
+    return std::find(itSlot->second.begin(), itSlot->second.end(), constraint) != itSlot->second.end();
+}
+
+/**
+ * @brief ConstraintStore::hasConstraints
+ * @param car
+ * @return true, if the car has at least one constraint
+ */
+bool ConstraintStore::hasConstraints(const CarId& car) const {
+    return car < m_buckets.size() && !m_buckets[car].empty();
+}
+
+/**
+ * @brief ConstraintStore::getCars
+ * @return IDs of the cars with constraints in ascending order
+ */
+std::vector<CarId> ConstraintStore::getCars() const {
+    std::vector<CarId> cars;
+    for (size_t car = 0; car < m_buckets.size(); car++) {
+        if (!m_buckets[car].empty()) {
+            cars.push_back(car);
+        }
+    }
+    return cars;
+}
+
+/**
+ * @brief ConstraintStore::getConstraints
+ * @param car
+ * @return constraints of the car sorted by time
+ */
+std::vector<Constraint> ConstraintStore::getConstraints(const CarId& car) const {
+    std::vector<Constraint> constraints;
+    appendConstraints(car, constraints);
+    return constraints;
+}
+
+/**
+ * @brief ConstraintStore::getConstraintsExcept gives the constraints a car has to obey
+ * @param car receiving car
+ * @return constraints of all other cars
+ */
+std::vector<Constraint> ConstraintStore::getConstraintsExcept(const CarId& car) const {
+    std::vector<Constraint> constraints;
+    constraints.reserve(m_size);
+    for (size_t owner = 0; owner < m_buckets.size(); owner++) {
+        if (owner != car) {
+            appendConstraints(owner, constraints);
+        }
+    }
+    return constraints;
+}
+
+/**
+ * @brief ConstraintStore::appendConstraints appends the constraints of the car sorted by time
+ * @param car
+ * @param constraints
+ */
+void ConstraintStore::appendConstraints(const CarId& car, std::vector<Constraint>& constraints) const {
+    if (car >= m_buckets.size()) {
+        return;
+    }
+    for (const auto& slot : m_buckets[car]) {
+        constraints.insert(constraints.end(), slot.second.begin(), slot.second.end());
+    }
+}
+
+/**
+ * @brief ConstraintStore::size
+ * @return number of stored constraints
+ */
+size_t ConstraintStore::size() const {
+    return m_size;
+}
+
+/**
+ * @brief ConstraintStore::empty
+ * @return
+ */
+bool ConstraintStore::empty() const {
+    return m_size == 0;
+}
+
+/**
+ * @brief ConstraintStore::clear removes all constraints, the buckets of the cars are kept
+ */
+void ConstraintStore::clear() {
+    for (TimeBuckets& buckets : m_buckets) {
+        buckets.clear();
+    }
+    m_size = 0;
+}
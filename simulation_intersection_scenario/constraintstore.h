@@ -0,0 +1,46 @@
+#ifndef CONSTRAINTSTORE_H
+#define CONSTRAINTSTORE_H
+
+#include "carid.h"
+#include "constraint.h"
+
+#include <map>
+#include <vector>
+
+/**
+ * @brief The ConstraintStore class holds the constraints communicated by the cars, bucketed by the owner car (CarId)
+ * and inside of each car by the constraint time. All operations work in place: inserting and replacing a time slot
+ * only touches the bucket of the car, expiry removes the first time slots of each car, a duplicate is found in the
+ * bucket of its time. A receiving car gets the constraints of the other cars or of its predecessors gathered
+ * directly from the buckets, without copying the whole store.
+ */
+class ConstraintStore
+{
+public:
+    ConstraintStore();
+    void insert(const CarId& car, const Constraint& constraint);
+    void replace(const CarId& car, const Constraint& constraint);
+    bool removeTimeSlot(const CarId& car, const double& time);
+    size_t removeCar(const CarId& car);
+    size_t removeBefore(const double& time);
+    void merge(const ConstraintStore& other);
+    bool contains(const Constraint& constraint) const;
+    bool contains(const CarId& car, const Constraint& constraint) const;
+    bool hasConstraints(const CarId& car) const;
+    std::vector<CarId> getCars() const;
+    std::vector<Constraint> getConstraints(const CarId& car) const;
+    std::vector<Constraint> getConstraintsExcept(const CarId& car) const;
+    void appendConstraints(const CarId& car, std::vector<Constraint>& constraints) const;
+    size_t size() const;
+    bool empty() const;
+    void clear();
+private:
+    ///constraints of one car by time, in the order of insertion for the same time
+    typedef std::map<double, std::vector<Constraint> > TimeBuckets;
+    ///buckets indexed by the ID of the owner car
+    std::vector<TimeBuckets> m_buckets;
+    ///number of stored constraints
+    size_t m_size;
+};
+
+#endif // CONSTRAINTSTORE_H
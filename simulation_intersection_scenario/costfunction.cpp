@@ -2,6 +2,7 @@
 #include "pathcontrolmap.h"
 #include "costcriteria.h"
 #include "intersectionparameters.h"
+#include "intersection.h"
 #include "../simulation-core/vectorhelper.h"
 
 #include <cmath>
@@ -25,7 +26,7 @@ CostFunction::CostFunction(const PathItem &start, const PathItem &target, const
     m_T(0.0)
 {
     //u initialize with start value and rest with 0;
-
+    updateTargetDistances();
 }
 
 CostFunction::CostFunction(const std::vector<double> &x0, std::vector<double> &target, const double& t0, const double &T, const size_t &N,
@@ -40,7 +41,12 @@ CostFunction::CostFunction(const std::vector<double> &x0, std::vector<double> &t
     m_t0(t0),
     m_T(T)
 {
-
+    //the terminal costs read the distance field of the cell, which contains the continuous target
+    std::shared_ptr<InterSection> interSect = m_systemFunc ? m_systemFunc->getInterSection() : nullptr;
+    if (interSect && m_targetCont.size() >= 2) {
+        m_target = PathItem(std::floor(m_targetCont[0] / interSect->getCellSize()), std::floor(m_targetCont[1] / interSect->getCellSize()), 0.0);
+        updateTargetDistances();
+    }
 }
 
 /**
@@ -71,6 +77,24 @@ double CostFunction::wrapCostFunctionObject(const std::vector<double>& u, std::v
  */
 void CostFunction::setTarget(const PathItem &x) {
     m_target = x;
+    updateTargetDistances();
+}
+
+/**
+ * @brief CostFunction::updateTargetDistances looks up the distance field of the target, if the terminal costs are switched on,
+ * so the evaluations of the cost function do not need to lock the cache of the intersection
+ */
+void CostFunction::updateTargetDistances() {
+    m_targetDistances.reset();
+    m_interSection.reset();
+    if (InterSectionParameters::terminalCosts == 0 || !m_systemFunc) {
+        return;
+    }
+    std::shared_ptr<InterSection> interSect = m_systemFunc->getInterSection();
+    if (interSect && interSect->isInsideGrid(m_target.getX(), m_target.getY())) {
+        m_targetDistances = interSect->getDistanceField(interSect->getCellIndex(m_target.getX(), m_target.getY()));
+        m_interSection = interSect;
+    }
 }
 
 PathItem CostFunction::getTarget() const {
@@ -187,6 +211,10 @@ double CostFunction::operator() (const std::vector<double> &u, std::vector<doubl
             PathItem controlDiff(controlPath.at(i+1));
             costs += getStageCosts(xPath.at(i), controlDiff - controlPath.at(i));
         }
+        //remaining path length from the end of the horizon to the target
+        if (InterSectionParameters::terminalCosts == 1 && !xPath.empty()) {
+            costs += getTerminalCosts(xPath.back());
+        }
         //getting the cost function more continous for the optimizer
         //a tendency is given for the next better neighbour which is more cost decreasing
         //this is calculated for the whole path and for each cell the better neighbour is calculated
@@ -202,49 +230,123 @@ double CostFunction::operator() (const std::vector<double> &u, std::vector<doubl
         m_openLoopCosts = costs;
     }
     else if (m_systemFunc->getSystemFunctionType() == SystemFunctionUsage::CONTINUOUS) {
-        std::vector<std::vector<double> > x;
-        //reshape the control to [1 2;3 4;];
-        std::vector<std::vector<double> > uReshaped = VectorHelper::reshapeXd(u);
-        x = m_systemFunc->getHolonomicSystemTrajectory(m_x0, uReshaped, m_t0, m_T, m_n);
+        //the control u_i is read in place from the 1d-vector [u_0(0), u_1(0), u_0(1), ...]
+        const size_t dim = InterSectionParameters::vectorDimension;
+        //the trajectory is shared with the constraints evaluated for the same control,
+        //only integrate separately, if the cost function starts from another state than the system
+        const Trajectory* x = nullptr;
+        if (m_x0 != m_systemFunc->getCurrentContinuousState()) {
+            m_systemFunc->getHolonomicSystemTrajectory(m_x0, u.data(), m_t0, m_T, m_n, m_ownTrajectory);
+            x = &m_ownTrajectory;
+        }
+        else {
+            x = &m_systemFunc->getCachedHolonomicSystemTrajectory(u, m_t0, m_T, m_n);
+        }
         double costs = 0.0;
         for (unsigned int i = 0; i < m_n; i++) {
-            costs += getStageCostsQuartic(x.at(i), uReshaped.at(i));
+            costs += getStageCostsQuartic(x->at(i), u.data() + i * dim);
+        }
+        //remaining path length from the last predicted state to the target
+        if (m_targetDistances && x->size() > 0) {
+            costs += getTerminalCostsContinuous(x->at(x->size() - 1));
         }
         m_openLoopCosts = costs;
-        m_closedLoopCosts = getStageCostsQuartic(x.at(0), uReshaped.at(0));
-        //derivative from cost function
-        //derived to x
+        m_closedLoopCosts = getStageCostsQuartic(x->at(0), u.data());
+        //derivative from cost function, derived to u over the trajectory
         if (!grad.empty()) {
-            //std::vector<double> x1d = VectorHelper::reshape2d1d(x);
-            /*for (unsigned int i = 0; i < x1d.size(); i++) {
-                unsigned int targetContPos = i % m_targetCont.size();
-                grad[i] = getDerivativeCosts(x1d.at(i), m_targetCont.at(targetContPos));
-            }*/
-            grad = getDerivativeCosts(x, m_targetCont);
+            getDerivativeCosts(*x, u.data(), grad);
         }
     }
     return m_openLoopCosts;
 }
 
 /**
- * @brief CostFunction::getDerivativeCosts derives $\f \frac{dl}{dx}l\left(x,u) = \frac{x}{||x_p-x^{\astar}||}\f$
- * which will be
- * @param x
- * @param u
- * @return
+ * @brief CostFunction::getDerivativeCosts derives the open loop costs \f$J(u) = \sum_{i=0}^{N-1} l(x_i(u), u_i)\f$ with respect to the control u,
+ * including the terminal costs of the last state, the state derivatives are propagated through the trajectory by the system function
+ * @param x state trajectory for u
+ * @param u control as 1d-array of size N*dim
+ * @param grad gradient as 1d-vector of size N*dim
  */
-std::vector<double> CostFunction::getDerivativeCosts(const std::vector<std::vector<double> > &x, const std::vector<double> &xTarget) const {
-    std::vector<double> grad;
-    //Q_ASSERT_X(x.size() == xTarget.size(), typeid(this).name(), "unequal size");
+void CostFunction::getDerivativeCosts(const Trajectory &x, const double* u, std::vector<double>& grad) const {
+    const size_t dim = x.dimension();
+    std::fill(grad.begin(), grad.end(), 0.0);
+    for (unsigned int i = 0; i < m_n && (i + 1) * dim <= grad.size(); i++) {
+        getDerivativeStageCostsQuarticControl(u + i * dim, grad.data() + i * dim);
+    }
+    m_dStates.resize(x.size());
     for (unsigned int i = 0; i < x.size(); i++) {
-        std::vector<double> curRow = x.at(i);
-        double targeti = 0.0;
-        targeti = xTarget.at(i % 2);
-        for (unsigned int j = 0; j < curRow.size(); j++) {
-            grad.push_back(curRow.at(j) / VectorHelper::norm2(VectorHelper::sub(curRow, xTarget)) );
+        getDerivativeStageCostsQuarticState(x.at(i), m_dStates.at(i));
+    }
+    if (m_targetDistances && x.size() > 0) {
+        std::vector<double> dTerminal(dim, 0.0);
+        getTerminalCostsContinuous(x.at(x.size() - 1), dTerminal.data());
+        for (unsigned int j = 0; j < dim; j++) {
+            m_dStates(x.size() - 1, j) += dTerminal[j];
         }
     }
-    return grad;
+    m_systemFunc->propagateStateGradientToControl(m_dStates, m_T, grad);
+}
+
+/**
+ * @brief CostFunction::getDerivativeStageCostsQuarticState derives getStageCostsQuartic with respect to the state,
+ * with \f$a = (x_0-x^\ast_0)^2, b = 5(x_1-x^\ast_1)\f$ it is \f$\frac{1}{\sqrt{a^2+b^2}}(2a(x_0-x^\ast_0), 5b)\f$,
+ * in the target (non differentiable) 0 is returned
+ * @param x state
+ * @return partial derivatives
+ */
+std::vector<double> CostFunction::getDerivativeStageCostsQuarticState(const std::vector<double> &x) const {
+    std::vector<double> dx(2, 0.0);
+    getDerivativeStageCostsQuarticState(x.data(), dx.data());
+    return dx;
+}
+
+/**
+ * @brief CostFunction::getDerivativeStageCostsQuarticState same as above, written to dx
+ * @param x state
+ * @param dx partial derivatives
+ */
+void CostFunction::getDerivativeStageCostsQuarticState(const double* x, double* dx) const {
+    double diff0 = x[0] - m_targetCont[0];
+    double a = diff0 * diff0;
+    double b = 5*(x[1] - m_targetCont[1]);
+    double norm = std::sqrt(a * a + b * b);
+    if (norm <= 0.0) {
+        dx[0] = 0.0;
+        dx[1] = 0.0;
+        return;
+    }
+    dx[0] = 2.0 * a * diff0 / norm;
+    dx[1] = 5.0 * b / norm;
+}
+
+/**
+ * @brief CostFunction::getDerivativeStageCostsQuarticControl derives the control part \f$\lambda||(u_0^2,u_1^2)||_2\f$ of getStageCostsQuartic
+ * to \f$\frac{2\lambda}{||(u_0^2,u_1^2)||_2}(u_0^3, u_1^3)\f$, for u = 0 the derivative 0 is returned
+ * @param u control
+ * @return partial derivatives
+ */
+std::vector<double> CostFunction::getDerivativeStageCostsQuarticControl(const std::vector<double> &u) const {
+    std::vector<double> du(2, 0.0);
+    getDerivativeStageCostsQuarticControl(u.data(), du.data());
+    return du;
+}
+
+/**
+ * @brief CostFunction::getDerivativeStageCostsQuarticControl same as above, written to du
+ * @param u control
+ * @param du partial derivatives
+ */
+void CostFunction::getDerivativeStageCostsQuarticControl(const double* u, double* du) const {
+    double u0Square = u[0] * u[0];
+    double u1Square = u[1] * u[1];
+    double norm = std::sqrt(u0Square * u0Square + u1Square * u1Square);
+    if (norm <= 0.0) {
+        du[0] = 0.0;
+        du[1] = 0.0;
+        return;
+    }
+    du[0] = 2.0 * m_lambda * u0Square * u[0] / norm;
+    du[1] = 2.0 * m_lambda * u1Square * u[1] / norm;
 }
 
 
@@ -278,9 +380,9 @@ double CostFunction::getStageCosts(const PathItem& x, const PathItem& u) const {
  */
 double CostFunction::getStageCosts(const std::vector<double> &x, const std::vector<double> &u) const {
     double costs = 0.0;
-    //euclidian norm without time
-    costs += VectorHelper::norm2(VectorHelper::sub(x, m_targetCont));
-    double normedControl = VectorHelper::norm2(u);
+    //euclidian norm without time, the difference is formed on the stack
+    costs += (Trajectory::StateVector::fromVector(x) - Trajectory::StateVector::fromVector(m_targetCont)).norm2();
+    double normedControl = VectorHelper::norm2(u.data(), u.size());
     costs += m_lambda * normedControl;
     return costs;
 }
@@ -292,12 +394,25 @@ double CostFunction::getStageCosts(const std::vector<double> &x, const std::vect
  * @return
  */
 double CostFunction::getStageCostsQuartic(const std::vector<double> &x, const std::vector<double> &u) const {
+    return getStageCostsQuartic(x.data(), u.data());
+}
+
+/**
+ * @brief CostFunction::getStageCostsQuartic same as above for one step of a trajectory and of the control
+ * @param x state
+ * @param u control
+ * @return
+ */
+double CostFunction::getStageCostsQuartic(const double* x, const double* u) const {
     double costs = 0.0;
     //euclidian norm without time
     //l(x,u) = ||(xp(t)-xp)^4 + 20*y-y_p^2 ||_2 + 0.2||u^2||_2
-    costs += VectorHelper::norm2({std::pow(x.at(0) - m_targetCont.at(0), 2), 5*(x.at(1) - m_targetCont.at(1))});
+    const double diff0 = x[0] - m_targetCont[0];
+    const double a = diff0 * diff0;
+    const double b = 5*(x[1] - m_targetCont[1]);
+    costs += std::sqrt(a * a + b * b);
     //costs += VectorHelper::norm2(VectorHelper::sub(x, m_targetCont));
-    double normedControl = VectorHelper::norm2({std::pow(u.at(0), 2), std::pow(u.at(1), 2)});
+    double normedControl = std::sqrt(std::pow(u[0], 4) + std::pow(u[1], 4));
     costs += m_lambda * normedControl;
     return costs;
 }
@@ -332,6 +447,70 @@ double CostFunction::getCurrentAbsDistance(const PathItem& x) const {
         + std::pow(m_target.getY() - x.getY(), 2));
 }
 
+/**
+ * @brief CostFunction::getTerminalCosts returns the length of the shortest path from x to the target on the grid,
+ * read from the distance field of the target, which is shared with the planners of the other cars.
+ * Without a distance field or for cells outside the grid the euklidian distance is returned
+ * @param x last state of the horizon
+ * @return remaining path length
+ */
+double CostFunction::getTerminalCosts(const PathItem& x) const {
+    if (!m_targetDistances || !m_interSection->isInsideGrid(x.getX(), x.getY())) {
+        return getCurrentAbsDistance(x);
+    }
+    return m_targetDistances->getDistance(m_interSection->getCellIndex(x.getX(), x.getY()));
+}
+
+/**
+ * @brief CostFunction::getTerminalCostsContinuous returns the length of the shortest path from the continuous state x to the target,
+ * interpolated bilinearly between the distances of the four surrounding cell centres, so the costs are continuous and
+ * differentiable between the centre lines. On the centre lines the derivative of the adjacent patch is taken (subgradient).
+ * Within half a cell of the border the state is clamped to the outer centres, there the derivative in the clamped direction is 0.
+ * If a surrounding cell cannot reach the target, the euklidian distance to the target is taken
+ * @param x last state of the horizon, the distance field has to be set
+ * @param dx partial derivatives with respect to x, if not nullptr
+ * @return remaining path length
+ */
+double CostFunction::getTerminalCostsContinuous(const double* x, double* dx) const {
+    const double cellSize = m_interSection->getCellSize();
+    const unsigned int gridSize[2] = {m_targetDistances->getGridWidth(), m_targetDistances->getGridHeight()};
+    unsigned int lower[2], upper[2];
+    double frac[2];
+    bool clamped[2];
+    for (unsigned int j = 0; j < 2; j++) {
+        //position in cells relative to the centre of the first cell
+        const double maxPos = (double)gridSize[j] - 1.0;
+        const double pos = x[j] / cellSize - 0.5;
+        clamped[j] = pos < 0.0 || pos > maxPos;
+        const double posClamped = std::min(std::max(pos, 0.0), maxPos);
+        lower[j] = std::min((unsigned int)std::floor(posClamped), (gridSize[j] > 1) ? gridSize[j] - 2 : 0u);
+        upper[j] = std::min(lower[j] + 1, gridSize[j] - 1);
+        frac[j] = posClamped - lower[j];
+    }
+    const double d00 = m_targetDistances->getDistance(m_interSection->getCellIndex(lower[0], lower[1]));
+    const double d10 = m_targetDistances->getDistance(m_interSection->getCellIndex(upper[0], lower[1]));
+    const double d01 = m_targetDistances->getDistance(m_interSection->getCellIndex(lower[0], upper[1]));
+    const double d11 = m_targetDistances->getDistance(m_interSection->getCellIndex(upper[0], upper[1]));
+    if (!std::isfinite(d00) || !std::isfinite(d10) || !std::isfinite(d01) || !std::isfinite(d11)) {
+        const double diff0 = x[0] - m_targetCont[0];
+        const double diff1 = x[1] - m_targetCont[1];
+        const double norm = std::sqrt(diff0 * diff0 + diff1 * diff1);
+        if (dx) {
+            dx[0] = (norm > 0.0) ? diff0 / norm : 0.0;
+            dx[1] = (norm > 0.0) ? diff1 / norm : 0.0;
+        }
+        return norm;
+    }
+    //the distances are given in cells, the interpolation is scaled by the cell size, so the derivative with respect to x is
+    //the derivative with respect to the fraction
+    if (dx) {
+        dx[0] = clamped[0] ? 0.0 : (1.0 - frac[1]) * (d10 - d00) + frac[1] * (d11 - d01);
+        dx[1] = clamped[1] ? 0.0 : (1.0 - frac[0]) * (d01 - d00) + frac[0] * (d11 - d10);
+    }
+    return cellSize * ((1.0 - frac[0]) * (1.0 - frac[1]) * d00 + frac[0] * (1.0 - frac[1]) * d10
+                       + (1.0 - frac[0]) * frac[1] * d01 + frac[0] * frac[1] * d11);
+}
+
 /**
  * @brief CostFunction::getCurrentCosts returns the last open loop costs
  * @return
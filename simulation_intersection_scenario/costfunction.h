@@ -4,6 +4,7 @@
 #include "path.h"
 #include "pathitem.h"
 #include "systemfunction.h"
+#include "distancefield.h"
 #include "dlib/optimization.h"
 
 typedef dlib::matrix<double,0,1> column_vector;
@@ -29,8 +30,13 @@ public:
     double getStageCosts(const PathItem& x, const PathItem& u) const;
     double getStageCosts(const std::vector<double> &x, const std::vector<double> &u) const;
     double getStageCostsQuartic(const std::vector<double> &x, const std::vector<double> &u) const;
+    double getStageCostsQuartic(const double* x, const double* u) const;
     double operator()(const std::vector<double> &u, std::vector<double> &grad, void* f_data = nullptr);
-    std::vector<double> getDerivativeCosts(const std::vector<std::vector<double> > &x, const std::vector<double> &xTarget) const;
+    void getDerivativeCosts(const Trajectory &x, const double* u, std::vector<double>& grad) const;
+    std::vector<double> getDerivativeStageCostsQuarticState(const std::vector<double> &x) const;
+    void getDerivativeStageCostsQuarticState(const double* x, double* dx) const;
+    std::vector<double> getDerivativeStageCostsQuarticControl(const std::vector<double> &u) const;
+    void getDerivativeStageCostsQuarticControl(const double* u, double* du) const;
     PathItem getTarget() const;
     static double wrapCostFunctionObject(const std::vector<double>& u, std::vector<double>& grad, void* data);
     static double calcCurrentStateCosts(const PathItem& x, const PathItem& u, const PathItem& target, const double& lambda);
@@ -38,16 +44,23 @@ public:
     double getCurrentOpenLoopCosts() const;
     double getCurrentClosedLoopCosts() const;
     double getCurrentAbsDistance(const PathItem& x) const;
+    double getTerminalCosts(const PathItem& x) const;
+    double getTerminalCostsContinuous(const double* x, double* dx = nullptr) const;
     Path getBetterNeighbours(const std::vector<double>& path) const;
     std::vector<double> round(const std::vector<double>& v, const ROUND& round) const;
     ///cost map of neighboured cars
     std::map<std::string, double> calcCostsForNeighbours();
     double addWeightedFunctionsQuadratic() const;
 private:
+    void updateTargetDistances();
     ///current position
     PathItem m_start;
     ///target
     PathItem m_target;
+    ///distances to the discrete target on the grid, looked up once when the target is set
+    std::shared_ptr<const DistanceField> m_targetDistances;
+    ///grid of the distance field, for the cell indices and the cell size
+    std::shared_ptr<const InterSection> m_interSection;
     ///continuous target
     std::vector<double> m_targetCont;
     ///horizon N
@@ -72,6 +85,10 @@ private:
     double m_t0;
     ///sampling step
     double m_T;
+    ///trajectory, if the cost function starts from another state than the system
+    Trajectory m_ownTrajectory;
+    ///partial derivatives of the costs with respect to the states, reused for each gradient
+    mutable Trajectory m_dStates;
 
 };
 
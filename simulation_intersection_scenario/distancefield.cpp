@@ -0,0 +1,88 @@
+#include "distancefield.h"
+#include "indexedminheap.h"
+
+#include <cmath>
+#include <limits>
+
+/**
+ * @brief DistanceField::DistanceField computes the field for a grid with gridWidth x gridHeight cells
+ * @param gridWidth number of cells in k-direction
+ * @param gridHeight number of cells in m-direction
+ * @param targetIndex cell index of the target
+ */
+DistanceField::DistanceField(const unsigned int& gridWidth, const unsigned int& gridHeight, const size_t& targetIndex) :
+    m_gridWidth(gridWidth),
+    m_gridHeight(gridHeight),
+    m_targetIndex(targetIndex),
+    m_distance((size_t)gridWidth * gridHeight, std::numeric_limits<double>::infinity())
+{
+    computeDistances();
+}
+
+/**
+ * @brief DistanceField::getGridWidth
+ * @return
+ */
+unsigned int DistanceField::getGridWidth() const {
+    return m_gridWidth;
+}
+
+/**
+ * @brief DistanceField::getGridHeight
+ * @return
+ */
+unsigned int DistanceField::getGridHeight() const {
+    return m_gridHeight;
+}
+
+/**
+ * @brief DistanceField::getTargetIndex
+ * @return
+ */
+size_t DistanceField::getTargetIndex() const {
+    return m_targetIndex;
+}
+
+/**
+ * @brief DistanceField::getDistance
+ * @param cell cell index
+ * @return length of the shortest path from the cell to the target, infinity if there is none
+ */
+double DistanceField::getDistance(const size_t& cell) const {
+    return m_distance[cell];
+}
+
+/**
+ * @brief DistanceField::computeDistances Dijkstra search from the target, the step costs are symmetric,
+ * so the distances to the target are the distances from the target
+ */
+void DistanceField::computeDistances() {
+    if (m_targetIndex >= m_distance.size()) {
+        return;
+    }
+    IndexedMinHeap<double> openList;
+    openList.reset(m_distance.size());
+    m_distance[m_targetIndex] = 0.0;
+    openList.push(m_targetIndex, 0.0);
+    while (!openList.empty()) {
+        const size_t current = openList.top();
+        openList.pop();
+        const int k = (int)(current / m_gridHeight);
+        const int m = (int)(current % m_gridHeight);
+        for (int dk = -1; dk <= 1; dk++) {
+            for (int dm = -1; dm <= 1; dm++) {
+                const int nk = k + dk;
+                const int nm = m + dm;
+                if ((dk == 0 && dm == 0) || nk < 0 || nm < 0 || nk >= (int)m_gridWidth || nm >= (int)m_gridHeight) {
+                    continue;
+                }
+                const size_t neighbour = (size_t)nk * m_gridHeight + nm;
+                const double distance = m_distance[current] + std::sqrt((double)(dk * dk + dm * dm));
+                if (distance < m_distance[neighbour]) {
+                    m_distance[neighbour] = distance;
+                    openList.push(neighbour, distance);
+                }
+            }
+        }
+    }
+}
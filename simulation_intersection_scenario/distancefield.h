@@ -0,0 +1,34 @@
+#ifndef DISTANCEFIELD_H
+#define DISTANCEFIELD_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief The DistanceField class holds the exact distances of all cells of the intersection grid to one target cell
+ * (8-neighbourhood, euclidian step costs), computed once by a Dijkstra search backwards from the target. The cells are numbered
+ * like InterSection::getCellIndex. The cars share a few targets (the exits), so the InterSection keeps one field per target and
+ * the planners use it as perfect heuristic, a lookup costs O(1).
+ * Memory: V distances for V cells.
+ */
+class DistanceField
+{
+public:
+    DistanceField(const unsigned int& gridWidth, const unsigned int& gridHeight, const size_t& targetIndex);
+    unsigned int getGridWidth() const;
+    unsigned int getGridHeight() const;
+    size_t getTargetIndex() const;
+    double getDistance(const size_t& cell) const;
+private:
+    void computeDistances();
+    ///number of cells in k-direction
+    unsigned int m_gridWidth;
+    ///number of cells in m-direction
+    unsigned int m_gridHeight;
+    ///cell index of the target
+    size_t m_targetIndex;
+    ///distance of each cell to the target, infinity if the target is not reachable
+    std::vector<double> m_distance;
+};
+
+#endif // DISTANCEFIELD_H
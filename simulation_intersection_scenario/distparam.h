@@ -29,6 +29,8 @@ struct DistParam {
     double meanArrivalTime;
     TimeMetric metric;
     double samplingTime;
+    ///seed of the random number generator, 0 for a non-deterministic seed
+    unsigned int seed;
 };
 
 
@@ -4,32 +4,26 @@
 
 #include <QDebug>
 
+#include <limits>
+
 /**
  * @brief DstarLite::DstarLite
  * @param car
  * @param start
  * @param target
  * @param T sampling interval
+ * @param context simulation, the car belongs to
  */
-DstarLite::DstarLite(const QString &car, const PathItem &start, const PathItem &target, const double &T) :
+DstarLite::DstarLite(const QString &car, const PathItem &start, const PathItem &target, const double &T, const std::weak_ptr<SimulationContext>& context) :
     m_car(car),
     m_start(start),
-    m_target(target)
-
+    m_target(target),
+    m_km(0.0),
+    m_startIndex(0),
+    m_lastStartIndex(0),
+    m_targetIndex(0)
 {
-    m_sysFunc= std::make_shared<SystemFunction> (m_car,Path(start));
-    for (int i = 0; i < InterSection::getInstance()->getWidth(); i++) {
-        for (int j = 0; j < InterSection::getInstance()->getWidth(); j++) {
-            DStarParam param;
-            param.g = 5000;
-            param.key = std::make_tuple(100,100);
-            param.rhs = 5000;
-            m_dStarMap.insert(InterSection::getInstance()->getInterSectionCell(i,j), param);
-        }
-    }
-    //DStarParam currentParam = m_dStarMap.value(source);
-    //currentParam.gCost = 5000.0;
-    //m_dStarMap.insert(source, currentParam);
+    m_sysFunc= std::make_shared<SystemFunction> (m_car,Path(start), context);
 }
 
 DstarLite::DstarLite(const QString &car, const std::vector<double>& start, const std::vector<double>& target) {
@@ -52,126 +46,214 @@ std::shared_ptr<SystemFunction> DstarLite::getSystemFunction() const {
     return m_sysFunc;
 }
 
-double DstarLite::estimateCost(const std::shared_ptr<InterSectionCell> &first, const std::shared_ptr<InterSectionCell> &second)
-{
-    return std::sqrt(std::pow(second->getX() - first->getX(), 2) + std::pow(second->getY() - first->getY(), 2));
+/**
+ * @brief DstarLite::estimateCost heuristic
+ * @param grid
+ * @param first cell index
+ * @param second cell index
+ * @return euclidian distance between the cells
+ */
+double DstarLite::estimateCost(const std::shared_ptr<InterSection> &grid, const size_t& first, const size_t& second) const {
+    const InterSectionGrid& cells = grid->getGrid();
+    const double dx = cells[second]->getX() - cells[first]->getX();
+    const double dy = cells[second]->getY() - cells[first]->getY();
+    return std::sqrt(dx * dx + dy * dy);
 }
 
 /**
- * @brief DstarLite::calculatePath
+ * @brief DstarLite::getEdgeCost
  * @param grid
- * @param source
- * @param target
- * @return
+ * @param first cell index
+ * @param second neighboured cell index
+ * @return costs of the step between the neighboured cells, infinity if one of them is blocked
  */
-Path DstarLite::calculatePath(const std::shared_ptr<InterSection> grid, const std::shared_ptr<InterSectionCell> &source, const std::shared_ptr<InterSectionCell> &target) {
-
-    m_targetnode= target;
-    m_startnode = grid->getInterSectionCell(m_start.getX(),m_start.getY());
-    m_source = source;
-    //std::shared_ptr<InterSectionCell> here = grid->getInterSectionCell(12,0);
-
-    // if (m_source == m_startnode){  // calculate the initial complete path
-
-
-    //target->setRhs(0.0);
-    setrhs(target,0);
-    //target->setG(5000);
-    //double min = std::min(target->getG() , target->getRhs());
-    double min = std::min(getG(target) , getrhs(target));
-    //target->setKey(min + estimateCost(target,m_source));
-    double k1 = min + estimateCost(target,m_source);
-    std::tuple<double,double> first(k1,min);
-
-    setKey(target , first);
-
-
-
-    m_openList.append(target);
-    // sortedOpenList.insert(m_dStarMap.value(target), target);
-
-    //while((m_openList.first()->getKey() < source->getKey()) || source->getG() != source->getRhs()) {
-    while((getKey(m_openList.first()) < getKey(source)) || getG(source) != getrhs(source)){
-
-
+double DstarLite::getEdgeCost(const std::shared_ptr<InterSection> &grid, const size_t& first, const size_t& second) const {
+    if (m_blocked[first] || m_blocked[second]) {
+        return std::numeric_limits<double>::infinity();
+    }
+    return estimateCost(grid, first, second);
+}
 
-        //double b = std::get<1> (getKey(InterSection::getInstance()->getInterSectionCell(12,0)));
-        std::shared_ptr<InterSectionCell> currentNode = m_openList.first();
-        m_openList.removeFirst();
-        // int a = m_openList.indexOf(currentNode);
-        //m_openList.removeAt(a);
+/**
+ * @brief DstarLite::getNeighbourIndices writes the indices of the neighbours (radius 1, without the cell itself)
+ * @param grid
+ * @param cell
+ * @param neighbours array with space for 8 indices
+ * @return number of neighbours
+ */
+size_t DstarLite::getNeighbourIndices(const std::shared_ptr<InterSection> &grid, const size_t& cell, size_t* neighbours) const {
+    const std::shared_ptr<InterSectionCell>& cellP = grid->getGrid()[cell];
+    const int x = cellP->getX();
+    const int y = cellP->getY();
+    size_t count = 0;
+    for (int i = x - 1; i <= x + 1; i++) {
+        for (int j = y - 1; j <= y + 1; j++) {
+            if ((i != x || j != y) && grid->isInsideGrid(i, j)) {
+                neighbours[count++] = grid->getCellIndex(i, j);
+            }
+        }
+    }
+    return count;
+}
 
-        // decide when to remove the element. at start or end
+/**
+ * @brief DstarLite::initializeSearch sets all cells to unknown costs and puts the target into the open list
+ * @param grid
+ * @param startIndex
+ * @param targetIndex
+ */
+void DstarLite::initializeSearch(const std::shared_ptr<InterSection> &grid, const size_t& startIndex, const size_t& targetIndex) {
+    const size_t numCells = grid->getGrid().size();
+    m_g.assign(numCells, std::numeric_limits<double>::infinity());
+    m_rhs.assign(numCells, std::numeric_limits<double>::infinity());
+    m_blocked.assign(numCells, 0);
+    m_blockedCells.clear();
+    m_openList.reset(numCells);
+    m_km = 0.0;
+    m_startIndex = startIndex;
+    m_lastStartIndex = startIndex;
+    m_targetIndex = targetIndex;
+    m_rhs[targetIndex] = 0.0;
+    m_openList.push(targetIndex, calculateKey(grid, targetIndex));
+}
 
-        if (currentNode){
+/**
+ * @brief DstarLite::calculateKey
+ * @param grid
+ * @param cell
+ * @return DStarKey of the cell with respect to the current start
+ */
+DStarKey DstarLite::calculateKey(const std::shared_ptr<InterSection> &grid, const size_t& cell) const {
+    const double minCost = std::min(m_g[cell], m_rhs[cell]);
+    return DStarKey(minCost + estimateCost(grid, m_startIndex, cell) + m_km, minCost);
+}
 
-            //if (currentNode->getG() > currentNode->getRhs()){ // over-consistent ?
-            if(getG(currentNode) > getrhs(currentNode)){
-                //currentNode->setG(currentNode->getRhs());
-                setG(currentNode,getrhs(currentNode));
-                std::weak_ptr<InterSectionCell> currentNodeW(currentNode);
-                expandNode(grid,currentNodeW,source);
+/**
+ * @brief DstarLite::updateVertex recalculates rhs of the cell from its neighbours and puts the cell into the open list, if it is inconsistent
+ * @param grid
+ * @param cell
+ */
+void DstarLite::updateVertex(const std::shared_ptr<InterSection> &grid, const size_t& cell) {
+    if (cell != m_targetIndex) {
+        size_t neighbours[8];
+        const size_t numNeighbours = getNeighbourIndices(grid, cell, neighbours);
+        double rhs = std::numeric_limits<double>::infinity();
+        for (size_t i = 0; i < numNeighbours; i++) {
+            rhs = std::min(rhs, getEdgeCost(grid, cell, neighbours[i]) + m_g[neighbours[i]]);
+        }
+        m_rhs[cell] = rhs;
+    }
+    if (m_g[cell] != m_rhs[cell]) {
+        m_openList.push(cell, calculateKey(grid, cell));
+    }
+    else {
+        m_openList.remove(cell);
+    }
+}
 
+/**
+ * @brief DstarLite::computeShortestPath expands the inconsistent cells until the start is consistent,
+ * after a change of edge costs only the cells affected by the change are expanded
+ * @param grid
+ */
+void DstarLite::computeShortestPath(const std::shared_ptr<InterSection> &grid) {
+    size_t neighbours[8];
+    while (!m_openList.empty() && (m_openList.topKey() < calculateKey(grid, m_startIndex) || m_rhs[m_startIndex] != m_g[m_startIndex])) {
+        const size_t currentNode = m_openList.top();
+        const DStarKey oldKey = m_openList.topKey();
+        const DStarKey newKey = calculateKey(grid, currentNode);
+        const size_t numNeighbours = getNeighbourIndices(grid, currentNode, neighbours);
+        if (oldKey < newKey) {
+            //key is outdated since the start has moved
+            m_openList.push(currentNode, newKey);
+        }
+        else if (m_g[currentNode] > m_rhs[currentNode]) {
+            //over-consistent
+            m_g[currentNode] = m_rhs[currentNode];
+            m_openList.remove(currentNode);
+            for (size_t i = 0; i < numNeighbours; i++) {
+                updateVertex(grid, neighbours[i]);
             }
-
-            else{ // under-consistent?
-
-                //currentNode->setG(5000);
-                setG(currentNode , 5000);
-                std::weak_ptr<InterSectionCell> currentNodeW(currentNode);
-                expandNode(grid,currentNodeW,source);
-                double min = std::min(getG(currentNode) , getrhs(currentNode));
-                double k1 = min + estimateCost(currentNode,m_source);
-                std::tuple<double,double> first(k1,min);
-
-                setKey(currentNode, first);
-                m_openList.append(currentNode); // put it back in the open list
+        }
+        else {
+            //under-consistent
+            m_g[currentNode] = std::numeric_limits<double>::infinity();
+            updateVertex(grid, currentNode);
+            for (size_t i = 0; i < numNeighbours; i++) {
+                updateVertex(grid, neighbours[i]);
             }
-
-            // this is the correct position to sort the list
-            //m_dStarMap.value(a).key;
-            //QMap<DStarParam, std::shared_ptr<InterSectionCell> > sortedOpenList;
-            /*for (size_t i = 0; i < m_openList.size(); i++) {
-                sortedOpenList.insert(m_dStarMap.value(m_openList.at(i)), m_openList.at(i));
-            }*/
-            // sortedOpenList.first(); //gives InterSectionCell
-            // sortedOpenList.firstKey(); //gives DStarParam
-
-            /* for (auto itSortedMap = sortedOpenList.begin(); itSortedMap != sortedOpenList.end(); itSortedMap++) {
-                qDebug() << std::get<0>(itSortedMap.key().key) << "," << std::get<1>(itSortedMap.key().key);
-            }*/
-
-
-            //qSort(m_openList.begin(), m_openList.end(),[&](const std::shared_ptr<InterSectionCell> a, const std::   shared_ptr<InterSectionCell> b) -> bool { return getKey(a) < getKey(b); });
-            //qSort(sortedOpenList.begin(), sortedOpenList.end(),[&](const DStarParam a, const DStarParam b) -> bool { return std::get<0>(a.first.key) < std::get<0>(b.first.key); });)
-            qSort(m_openList.begin(), m_openList.end(),[&](const std::shared_ptr<InterSectionCell> a, const std::shared_ptr<InterSectionCell> b) -> bool
-            {
-                if( std::get<0> (getKey(a)) == std::get<0>(getKey(b)))
-                    return std::get<1>(getKey(a)) < std::get<1>(getKey(b));
-
-                else
-                    return std::get<0> (getKey(a)) < std::get<0>(getKey(b)) ; });
         }
     }
+}
 
-    // generate path.... make this a function
-    double globalTime = 0.0;
-    m_presentNode = m_startnode; // needed initialization to run the loop.
-    while (m_presentNode != m_targetnode) {
-        // std::shared_ptr<InterSectionCell> here = grid->getInterSectionCell(13,1);
+/**
+ * @brief DstarLite::setCellBlocked changes the costs of all edges of the cell and updates the cell and its neighbours
+ * @param grid
+ * @param cell
+ * @param blocked
+ */
+void DstarLite::setCellBlocked(const std::shared_ptr<InterSection> &grid, const size_t& cell, const bool& blocked) {
+    if ((bool)m_blocked[cell] == blocked) {
+        return;
+    }
+    m_blocked[cell] = blocked ? 1 : 0;
+    size_t neighbours[8];
+    const size_t numNeighbours = getNeighbourIndices(grid, cell, neighbours);
+    updateVertex(grid, cell);
+    for (size_t i = 0; i < numNeighbours; i++) {
+        updateVertex(grid, neighbours[i]);
+    }
+}
 
-        m_presentNode = gradientForPath(grid,m_presentNode);// node with the least g value
+/**
+ * @brief DstarLite::extractPath follows the cheapest neighbours (step costs + g) from the start to the target
+ * @param grid
+ * @param startIndex
+ * @param t0 time before the first step
+ * @return path without the start, if the target is not reachable the car stays for one step
+ */
+Path DstarLite::extractPath(const std::shared_ptr<InterSection> &grid, const size_t& startIndex, const double& t0) const {
+    const InterSectionGrid& cells = grid->getGrid();
+    Path path;
+    double globalTime = t0;
+    size_t currentNode = startIndex;
+    size_t neighbours[8];
+    for (size_t step = 0; currentNode != m_targetIndex && step < cells.size(); step++) {
+        const size_t numNeighbours = getNeighbourIndices(grid, currentNode, neighbours);
+        size_t nextNode = currentNode;
+        double minCost = std::numeric_limits<double>::infinity();
+        for (size_t i = 0; i < numNeighbours; i++) {
+            const double cost = getEdgeCost(grid, currentNode, neighbours[i]) + m_g[neighbours[i]];
+            if (cost < minCost) {
+                minCost = cost;
+                nextNode = neighbours[i];
+            }
+        }
+        if (nextNode == currentNode) {
+            break;
+        }
+        currentNode = nextNode;
         globalTime += InterSectionParameters::T ;
-        m_initialPath.push_back(PathItem(m_presentNode->getX() , m_presentNode->getY() , globalTime));
-        // m_sysFunc->prelimReserveCell(m_initialPath.back()); // what if 2 cars reserve same cell for same time at planning
-
-        //  wht if cell is blocked since start ?
+        path.push_back(PathItem(cells[currentNode]->getX() , cells[currentNode]->getY() , globalTime));
     }
+    if (path.empty() && startIndex != m_targetIndex) {
+        path.push_back(PathItem(cells[startIndex]->getX(), cells[startIndex]->getY(), t0 + InterSectionParameters::T));
+    }
+    return path;
+}
 
-
-
-    return m_initialPath;
-
+/**
+ * @brief DstarLite::calculatePath initial search from the target to the source
+ * @param grid
+ * @param source
+ * @param target
+ * @return
+ */
+Path DstarLite::calculatePath(const std::shared_ptr<InterSection> grid, const std::shared_ptr<InterSectionCell> &source, const std::shared_ptr<InterSectionCell> &target) {
+    const size_t startIndex = grid->getCellIndex(source->getX(), source->getY());
+    initializeSearch(grid, startIndex, grid->getCellIndex(target->getX(), target->getY()));
+    computeShortestPath(grid);
+    return extractPath(grid, startIndex, 0.0);
 }
 
 /**
@@ -181,7 +263,7 @@ Path DstarLite::calculatePath(const std::shared_ptr<InterSection> grid, const st
  */
 PathItem DstarLite::optimize(const PathItem &start) {
 
-    std::shared_ptr<InterSection> grid= InterSection::getInstance();
+    std::shared_ptr<InterSection> grid= m_sysFunc->getInterSection();
 
     std::shared_ptr<InterSectionCell> startNode = grid->getInterSectionCell(start.getX(),start.getY());
 
@@ -213,7 +295,6 @@ PathItem DstarLite::optimize(const PathItem &start) {
         m_finalPath.clear();
         position=0;
         a=0;
-        m_initialPath.clear();
 
         m_finalPath = replan(grid , blocked, startNode);
         toreturn = m_finalPath.at(position);
@@ -229,351 +310,47 @@ PathItem DstarLite::optimize(const PathItem &start) {
 }
 
 
-// update vertex according to algorithm
-void DstarLite::expandNode(const std::shared_ptr<InterSection> &grid, std::weak_ptr<InterSectionCell> &currentNode, const std::shared_ptr<InterSectionCell> &start)
-{
-
-    //std::shared_ptr<InterSection> gridP(grid);
-    std::shared_ptr<InterSectionCell> currentNodeP(currentNode);
-
-    if (currentNodeP.get()){
-
-        QList<std::weak_ptr<InterSectionCell>> neighbours = grid->getNeighbours(currentNode,1);
-
-        for(QList<std::weak_ptr<InterSectionCell>>::iterator it = neighbours.begin(); it!= neighbours.end(); it++){
-
-            std::shared_ptr<InterSectionCell> currentNeighbourP(*(it));
-
-            // double rhsValue = currentNodeP->getG() + estimateCost(currentNodeP,currentNeighbourP);
-            double rhsValue = getG(currentNodeP) + estimateCost(currentNodeP , currentNeighbourP);
-
-
-            if (currentNeighbourP == currentNodeP){
-                continue;
-            }
-            if (currentNeighbourP == m_targetnode){
-                continue;
-            }
-
-            else if (m_openList.contains(currentNeighbourP)){
-                int index = m_openList.indexOf(currentNeighbourP);
-                m_openList.removeAt(index);
-                //continue;
-            }
-
-            // if already consistent , continue.... still not sure about this approach
-            else if ((getG(currentNeighbourP) == getrhs(currentNeighbourP)) && getrhs(currentNeighbourP) <= rhsValue){
-                continue;
-            }
-
-            else {// main condition
-
-                //currentNeighbourP->setRhs(rhsValue); // should i put the condition to check if g and rhs are not equal now
-                setrhs(currentNeighbourP,rhsValue);
-                //double min = std::min(currentNeighbourP->getG() , currentNeighbourP->getRhs());
-                double min = std::min(getG(currentNeighbourP) , getrhs(currentNeighbourP));
-                // should replace m_startnode to something else because of replanning
-                //currentNeighbourP->setKey(min + estimateCost(currentNeighbourP , start)) ;
-                double k1 = min + estimateCost(currentNeighbourP,start);
-                std::tuple<double,double> first(k1,min);
-                setKey(currentNeighbourP ,first);
-                m_openList.append(currentNeighbourP);
-
-            }
-            //
+/**
+ * @brief DstarLite::replan the cell, which could not be reserved, is blocked, the cells blocked at the previous replanning
+ * are released again. Only the changed edges are updated, then the search repairs the costs from the current position.
+ * @param grid
+ * @param blocked path item, which could not be reserved
+ * @param start current cell of the car
+ * @return new path from start
+ */
+Path DstarLite::replan(const std::shared_ptr<InterSection> &grid, const PathItem &blocked, const std::shared_ptr<InterSectionCell> &start) {
+    const size_t startIndex = grid->getCellIndex(start->getX(), start->getY());
+    //with k_m the keys in the open list stay lower bounds, although the start has moved
+    m_km += estimateCost(grid, m_lastStartIndex, startIndex);
+    m_lastStartIndex = startIndex;
+    m_startIndex = startIndex;
+
+    const size_t blockedIndex = grid->getCellIndex(blocked.getX(), blocked.getY());
+    const bool blockCell = blockedIndex != startIndex && blockedIndex != m_targetIndex;
+    for (const size_t& cell : m_blockedCells) {
+        if (!blockCell || cell != blockedIndex) {
+            setCellBlocked(grid, cell, false);
         }
-
     }
-}
-
-std::shared_ptr<InterSectionCell> DstarLite::gradientForPath(const std::shared_ptr<InterSection> &grid, const std::shared_ptr<InterSectionCell> &presentNode)
-{
-    std::shared_ptr<InterSectionCell> myNode = presentNode;
-    QList<std::weak_ptr<InterSectionCell>> neighbours = grid->getNeighbours(presentNode , 1);
-    for(QList<std::weak_ptr<InterSectionCell>>::iterator it = neighbours.begin(); it!= neighbours.end(); it++){
-
-        std::shared_ptr<InterSectionCell> currentNeighbourPGradient(*(it));
-
-        if(m_openList.contains(currentNeighbourPGradient)){
-            continue;
-        }
-
-        else if (currentNeighbourPGradient == presentNode ){
-            continue;
-        }
-
-        else if(getG(currentNeighbourPGradient) < getG(myNode)){
-            myNode = currentNeighbourPGradient;
-        }
-
+    m_blockedCells.clear();
+    if (blockCell) {
+        setCellBlocked(grid, blockedIndex, true);
+        m_blockedCells.push_back(blockedIndex);
     }
-    m_presentNode = myNode;
-    return m_presentNode;
+    computeShortestPath(grid);
+    return extractPath(grid, startIndex, m_sysFunc->getGlobalTime());
 }
 
-/*std::shared_ptr<InterSectionCell> DstarLite::gradientForReplanning(const std::shared_ptr<InterSection> &grid,const std::shared_ptr<InterSectionCell> &presentNode)
-{
-    std::shared_ptr<InterSectionCell> myNode = presentNode;
-    QList<std::weak_ptr<InterSectionCell>> neighbours = grid->getNeighbours(presentNode , 1);
-    for(QList<std::weak_ptr<InterSectionCell>>::iterator it = neighbours.begin(); it!= neighbours.end(); it++){
-
-        std::shared_ptr<InterSectionCell> currentNeighbourPGradient(*(it));
-
-        if (currentNeighbourPGradient == presentNode ){
-            continue;
-        }
-
-        else if(getG(currentNeighbourPGradient) < getG(myNode) ){
-            myNode = currentNeighbourPGradient;
-        }
-
-    }
-    m_presentNode = myNode;
-    return m_presentNode;
-}*/
-
-/*Path DstarLite::replan1(const shared_ptr<InterSection> &grid, PathItem &source, std::shared_ptr<InterSectionCell> &start)
-{
-
-    std::shared_ptr<InterSectionCell> blocked = grid->getInterSectionCell(source.getX() , source.getY());
-
-    setrhs(blocked,5000);
-    double min = std::min(getG(blocked) , getrhs(blocked));
-    double k1 = min + estimateCost(blocked,start);
-    std::tuple<double,double> first(k1,min);
-    setKey(blocked ,first);
-    // setKey(blocked,(min + estimateCost(blocked,start)));
-    // m_openList.append(blocked);
-
-    // for incoming edges. till line #301
-    QList<std::weak_ptr<InterSectionCell>> neighbours = grid->getNeighbours(blocked,1);
-
-    for(QList<std::weak_ptr<InterSectionCell>>::iterator it = neighbours.begin(); it!= neighbours.end(); it++){
-
-        std::shared_ptr<InterSectionCell> currentNeighbourP(*(it));
-
-        if(currentNeighbourP == blocked){
-            continue;
-        }
-
-        m_presentNode = gradientForReplanning(grid,currentNeighbourP);// incoming node check
-
-        if (m_presentNode == blocked){
-            m_openList.append(blocked);
-            m_presentNode = gradientForPath(grid,currentNeighbourP);
-            int index = m_openList.indexOf(blocked);
-            m_openList.removeAt(index); // remove blocked node for another neighbour to iterate also on it
-
-            //currentNeighbourP->setRhs(m_presentNode->getG() + estimateCost(m_presentNode , currentNeighbourP));
-            setrhs(currentNeighbourP,(getG(m_presentNode) + estimateCost(m_presentNode,currentNeighbourP)));
-
-            if (getG(currentNeighbourP) == getrhs(currentNeighbourP)){
-                continue;
-            }
-            else {
-                double min = std::min(getG(currentNeighbourP) , getrhs(currentNeighbourP));
-                double k1 = min + estimateCost(currentNeighbourP,start);
-                std::tuple<double,double> first(k1,min);
-                setKey(currentNeighbourP ,first);
-                // setKey(currentNeighbourP,(min + estimateCost(currentNeighbourP,start)));
-                m_openList.append(currentNeighbourP);
-
-            }
-
-        }
-
-        else {
-            continue;
-        }
-
-
-
-    }
-
-    // for outgoing edges now
-
-    //double minOfStart = std::min(start->getG() , start->getRhs());
-    //start->setKey(min + estimateCost(blocked,start));
-    m_openList.append(blocked);
-    qSort(m_openList.begin(), m_openList.end(),[&](const std::shared_ptr<InterSectionCell> a, const std::shared_ptr<InterSectionCell> b) -> bool { return getKey(a) < getKey(b); });
-
-    while((getKey(m_openList.first()) < getKey(start)) || getG(start) != getrhs(start)){
-
-        std::shared_ptr<InterSectionCell> currentNode = m_openList.first();
-        m_openList.removeFirst();
-        // decide when to remove the element. at start or end
-
-        if (currentNode){
-
-            if(getG(currentNode) > getrhs(currentNode)){
-                //currentNode->setG(currentNode->getRhs());
-                setG(currentNode,getrhs(currentNode));
-                std::weak_ptr<InterSectionCell> currentNodeW(currentNode);
-                expandNode(grid,currentNodeW,start);
-
-            }
-
-            else{ // under-consistent?
-                setG(currentNode , 5000);
-                std::weak_ptr<InterSectionCell> currentNodeW(currentNode);
-                expandNode(grid,currentNodeW,start);
-                double min = std::min(getG(currentNode) , getrhs(currentNode));
-                double k1 = min + estimateCost(currentNode,start);
-                std::tuple<double,double> first(k1,min);
-                setKey(currentNode ,first);
-                // setKey(currentNode, (min + estimateCost(currentNode ,m_source)));
-                m_openList.append(currentNode); // put it back in the open list
-            }
-
-
-
-            // this is the correct position to sort the list
-            qSort(m_openList.begin(), m_openList.end(),[&](const std::shared_ptr<InterSectionCell> a, const std::shared_ptr<InterSectionCell> b) -> bool { return getKey(a) < getKey(b); });
-        }
-    }
-
-    double globalTime = m_sysFunc->getGlobalTime();
-    m_presentNode = start;
-    while (m_presentNode != m_targetnode) {
-
-        m_presentNode = gradientForPath(grid,m_presentNode);// node with the least g value
-        globalTime += InterSectionParameters::T ;
-        m_initialPath.push_back(PathItem(m_presentNode->getX() , m_presentNode->getY() , globalTime));
-        // m_sysFunc->prelimReserveCell(m_initialPath.back());
-
-    }
-    return m_initialPath;
-}*/
-
-
-Path DstarLite::replan(const shared_ptr<InterSection> &grid, PathItem &source, std::shared_ptr<InterSectionCell> &start)
-{
-    std::shared_ptr<InterSectionCell> blocked = grid->getInterSectionCell(source.getX() , source.getY());
-
-    // no need to calculate rhs or g or key for blocked. its blocked. maybe set garbage values
-    // only calculate rhs values of affected cells.
-
-
-    double a = getrhs(blocked) + 1;
-    //double a1= std::ceil(a);
-    double b = getrhs(blocked) + 1.4;
-    //double b1= std::floor(b);
-
-    // fill blocked with garbage values. no use
-    setrhs(blocked,4000);
-    setG(blocked,4500);
-    double min = std::min(getG(blocked) , getrhs(blocked));
-    double k1 = min + estimateCost(blocked,start);
-    std::tuple<double,double> k(k1,min);
-    setKey(blocked,k);
-
-// manual first step for update vertex till line #526:D
-    QList<std::weak_ptr<InterSectionCell>> neighbours = grid->getNeighbours(blocked,1);
-
-    for(QList<std::weak_ptr<InterSectionCell>>::iterator it = neighbours.begin(); it!= neighbours.end(); it++){
-
-        std::shared_ptr<InterSectionCell> currentNeighbourP(*(it));
-        double x= getrhs(currentNeighbourP);
-
-        // these nodes calculated their rhs value based on blocked node. so update their parent and calculate new values
-
-        //if(abs ((getrhs(currentNeighbourP)==a || getrhs(currentNeighbourP)==b)<0.03) && m_openList.contains(currentNeighbourP)){
-        //if((abs(x==a || x==b) < 0.03) && m_openList.contains(currentNeighbourP)){
-
-        // this if if finding which node calculated its rhs value through blocked
-        if(((abs(x-a)<0.03) ||(abs(x-b) < 0.03)) && currentNeighbourP!=start && currentNeighbourP!=blocked){
-            setrhs(currentNeighbourP,5000);
-            std::tuple<double,double> k(100,100);
-            setKey(currentNeighbourP,k);
-            //expandNode(grid,currentNeighbourW,start);
-            if(m_openList.contains(currentNeighbourP)){
-
-                int index= m_openList.indexOf(currentNeighbourP);
-                m_openList.removeAt(index);
-            }
-            else{
-                m_openList.append(currentNeighbourP);
-            }
-        }
-
-
-        else if(currentNeighbourP == start){
-            setrhs(currentNeighbourP,5000);
-            double min = std::min(getG(currentNeighbourP) , getrhs(currentNeighbourP));
-            double k1 = min + estimateCost(currentNeighbourP,start);
-            std::tuple<double,double> k(k1,min);
-            setKey(currentNeighbourP,k);
-            m_openList.append(currentNeighbourP);
-
-        }
-        else if (currentNeighbourP == blocked){
-            continue ;
-        }
-
-
-        else{
-            continue;
-        }
-    }
-
-    qSort(m_openList.begin(), m_openList.end(),[&](const std::shared_ptr<InterSectionCell> a, const std::shared_ptr<InterSectionCell> b) -> bool
-    {
-        if( std::get<0> (getKey(a)) == std::get<0>(getKey(b)))
-            return std::get<1>(getKey(a)) < std::get<1>(getKey(b));
-
-        else
-            return std::get<0> (getKey(a)) < std::get<0>(getKey(b)) ; });
-
-    while((getKey(m_openList.first()) < getKey(start)) || getG(start) != getrhs(start)){
-
-        std::shared_ptr<InterSectionCell> currentNode = m_openList.first();
-        m_openList.removeFirst();
-        // decide when to remove the element. at start or end
-
-        if (currentNode){
-
-            if(getG(currentNode) > getrhs(currentNode)){
-                //currentNode->setG(currentNode->getRhs());
-                setG(currentNode,getrhs(currentNode));
-                std::weak_ptr<InterSectionCell> currentNodeW(currentNode);
-                expandNode(grid,currentNodeW,start);
-
-            }
-
-            else{ // under-consistent?
-                setG(currentNode , 5000);
-                std::weak_ptr<InterSectionCell> currentNodeW(currentNode);
-                expandNode(grid,currentNodeW,start);
-                double min = std::min(getG(currentNode) , getrhs(currentNode));
-                double k1 = min + estimateCost(currentNode,start);
-                std::tuple<double,double> first(k1,min);
-                setKey(currentNode ,first);
-                // setKey(currentNode, (min + estimateCost(currentNode ,m_source)));
-                m_openList.append(currentNode); // put it back in the open list
-            }
-
-            qSort(m_openList.begin(), m_openList.end(),[&](const std::shared_ptr<InterSectionCell> a, const std::shared_ptr<InterSectionCell> b) -> bool
-            {
-                if( std::get<0> (getKey(a)) == std::get<0>(getKey(b)))
-                    return std::get<1>(getKey(a)) < std::get<1>(getKey(b));
-
-                else
-                    return std::get<0> (getKey(a)) < std::get<0>(getKey(b)) ; });
-
-
-        }
-    }
-    double globalTime = m_sysFunc->getGlobalTime();
-    m_presentNode = start;
-    while (m_presentNode != m_targetnode) {
-
-        m_presentNode = gradientForPath(grid,m_presentNode);// node with the least g value
-        globalTime += InterSectionParameters::T ;
-        m_initialPath.push_back(PathItem(m_presentNode->getX() , m_presentNode->getY() , globalTime));
-        // m_sysFunc->prelimReserveCell(m_initialPath.back());
-
+/**
+ * @brief DstarLite::getCostToTarget
+ * @param cell cell index
+ * @return costs of the shortest path from the cell to the target (g), infinity if the target is not reachable
+ */
+double DstarLite::getCostToTarget(const size_t &cell) const {
+    if (cell == m_targetIndex) {
+        return 0.0;
     }
-    return m_initialPath;
+    return m_g[cell];
 }
 
 
@@ -602,7 +379,15 @@ double DstarLite::initializeCosts() {
  * @brief DstarLite::setCurrentConstraints
  * @param constraints
  */
-void DstarLite::setCurrentConstraints(const std::multimap<QString, Constraint> &constraints, const double& t0, const double& T) {
+void DstarLite::setCurrentConstraints(const std::vector<Constraint> &constraints, const double& t0, const double& T) {
+    //
+}
+
+/**
+ * @brief DstarLite::setCurrentBoxConstraints
+ * @param constraints
+ */
+void DstarLite::setCurrentBoxConstraints(const std::vector<ConstraintBox> &constraints, const double& t0, const double& T) {
     //
 }
 
@@ -701,49 +486,6 @@ std::pair<double, double> DstarLite::getControlBounds() const {
 
 }
 
-std::tuple<double,double> DstarLite::getKey(const std::shared_ptr<InterSectionCell> &node)
-{
-    DStarParam currentParam = m_dStarMap.value(node);
-    std::tuple<double,double> key = currentParam.key;
-    return key;
-}
-
-double DstarLite::getG(const std::shared_ptr<InterSectionCell> &node)
-{
-    DStarParam currentParam = m_dStarMap.value(node);
-    double g = currentParam.g;
-    return g;
-}
-
-double DstarLite::getrhs(const std::shared_ptr<InterSectionCell> &node)
-{
-    DStarParam currentParam = m_dStarMap.value(node);
-    double rhs = currentParam.rhs;
-    return rhs;
-}
-
-void DstarLite::setKey(const std::shared_ptr<InterSectionCell> &node, const std::tuple<double,double> &value)
-{
-    DStarParam currentParam = m_dStarMap.value(node);
-    currentParam.key = value;
-    m_dStarMap.insert(node, currentParam);
-}
-
-void DstarLite::setG(const std::shared_ptr<InterSectionCell> &node, const double value)
-{
-    DStarParam currentParam = m_dStarMap.value(node);
-    currentParam.g = value;
-    m_dStarMap.insert(node, currentParam);
-
-}
-
-void DstarLite::setrhs(const std::shared_ptr<InterSectionCell> &node, const double value)
-{
-    DStarParam currentParam = m_dStarMap.value(node);
-    currentParam.rhs = value;
-    m_dStarMap.insert(node, currentParam);
-}
-
 bool DstarLite::testValidityConstraints(std::vector<Constraint> &constraints, const std::vector<double>& controlVector) const {
     return false;
 }
@@ -5,23 +5,25 @@
 #include "intersection.h"
 #include "systemfunction.h"
 #include "pathcalculation.h"
-#include "tuple"
-#include <QtCore/QMap>
+#include "indexedminheap.h"
 #include <QtCore/QPointer>
-#include <QtCore/QList>
 
+#include <utility>
+#include <vector>
 
-struct DStarParam {
-    double rhs;
-    double g;
-   // double key;
-    std::tuple <double , double> key;
-};
+///key of a cell in the priority queue of D* Lite: \f$ [\min(g, rhs) + h(s_{start}, s) + k_m; \min(g, rhs)] \f$, compared lexicographically
+typedef std::pair<double, double> DStarKey;
 
+/**
+ * @brief The DstarLite class plans the path backwards from the target with D* Lite. g and rhs are stored in dense arrays
+ * indexed by the cell index of the grid, the inconsistent cells are kept in an indexed heap with decrease-key. If a cell of the
+ * path cannot be reserved, only the edges of this cell change and the search repairs the affected cells instead of planning
+ * again from scratch.
+ */
 class DstarLite : public PathCalculation
 {
 public:
-    DstarLite(const QString &car, const PathItem& start, const PathItem& target, const double& T);
+    DstarLite(const QString &car, const PathItem& start, const PathItem& target, const double& T, const std::weak_ptr<SimulationContext>& context = std::weak_ptr<SimulationContext>());
     DstarLite(const QString &car, const std::vector<double>& start, const std::vector<double>& target);
     PathAlgorithm getAlg() const;
     std::shared_ptr<SystemFunction> getSystemFunction() const;
@@ -29,7 +31,8 @@ public:
     PathItem optimize(const PathItem &start);
     std::vector<std::vector<double> > optimizeContinous(const std::vector<double> &controlVec, const double &t0, const double &T);
     double initializeCosts();
-    void setCurrentConstraints(const std::multimap<QString, Constraint> &constraints, const double& t0, const double& T);
+    void setCurrentConstraints(const std::vector<Constraint> &constraints, const double& t0, const double& T);
+    void setCurrentBoxConstraints(const std::vector<ConstraintBox> &constraints, const double& t0, const double& T);
     void createGlobalConstraints(const std::vector<double>& lb, const std::vector<double>& ub);
     void initializeDirectionalConstraints(const unsigned int &interSectionWidth, const unsigned int &interSectionHeight, const double &cellSize,
                                                   const double &t0, const int &N, const double &T, const double &dmin, const double &maxDynamics);
@@ -47,52 +50,46 @@ public:
     bool testValidityConstraints(std::vector<Constraint> &constraints, const std::vector<double>& controlVector) const;
     std::vector<Constraint> &getCurrentConstraints();
     void clearAllConstraints();
+    Path replan(const std::shared_ptr<InterSection> &grid, const PathItem &blocked, const std::shared_ptr<InterSectionCell> &start);
+    double getCostToTarget(const size_t& cell) const;
 private:
 
-   // void findPath(std::shared_ptr<InterSection> &grid, std::shared_ptr<InterSectionCell> &source);
-    std::tuple<double, double> getKey(const std::shared_ptr<InterSectionCell> &node);
-    double getG(const std::shared_ptr<InterSectionCell> &node);
-    double getrhs(const std::shared_ptr<InterSectionCell> &node);
-    void setKey(const std::shared_ptr<InterSectionCell> &node , const std::tuple<double, double> &value);
-    void setG(const std::shared_ptr<InterSectionCell> &node , const double value);
-    void setrhs(const std::shared_ptr<InterSectionCell> &node , const double value);
-    Path replan(const shared_ptr<InterSection> &grid, PathItem &source, std::shared_ptr<InterSectionCell> &start);
-    //Path replan1(const shared_ptr<InterSection> &grid , PathItem &source, std::shared_ptr<InterSectionCell> &start);
-    void expandNode(const std::shared_ptr<InterSection> &grid, std::weak_ptr<InterSectionCell> &currentNode, const std::shared_ptr<InterSectionCell> &start);
-    std::shared_ptr<InterSectionCell> gradientForPath(const std::shared_ptr<InterSection> &grid,  const std::shared_ptr<InterSectionCell> &presentNode);
-    std::shared_ptr<InterSectionCell> gradientForReplanning(const std::shared_ptr<InterSection> &grid,  const std::shared_ptr<InterSectionCell> &presentNode);
-    double estimateCost(const std::shared_ptr<InterSectionCell> &first, const std::shared_ptr<InterSectionCell> &second);
-    Path m_initialPath; //first path calculated initially
+    void initializeSearch(const std::shared_ptr<InterSection> &grid, const size_t& startIndex, const size_t& targetIndex);
+    DStarKey calculateKey(const std::shared_ptr<InterSection> &grid, const size_t& cell) const;
+    double estimateCost(const std::shared_ptr<InterSection> &grid, const size_t& first, const size_t& second) const;
+    double getEdgeCost(const std::shared_ptr<InterSection> &grid, const size_t& first, const size_t& second) const;
+    size_t getNeighbourIndices(const std::shared_ptr<InterSection> &grid, const size_t& cell, size_t* neighbours) const;
+    void updateVertex(const std::shared_ptr<InterSection> &grid, const size_t& cell);
+    void computeShortestPath(const std::shared_ptr<InterSection> &grid);
+    void setCellBlocked(const std::shared_ptr<InterSection> &grid, const size_t& cell, const bool& blocked);
+    Path extractPath(const std::shared_ptr<InterSection> &grid, const size_t& startIndex, const double& t0) const;
     Path m_finalPath; // path calculated after changes
-    QList<std::shared_ptr<InterSectionCell>> m_openList;
 
     std::shared_ptr<SystemFunction> m_sysFunc;
 
     PathItem m_start;
     PathItem m_target;
     QString m_car;
-    std::shared_ptr<InterSectionCell> m_startnode;
-    std::shared_ptr<InterSectionCell> m_targetnode;
-    std::shared_ptr<InterSectionCell> m_source;
-    std::shared_ptr<InterSectionCell> m_presentNode;
     int position=0;
     int a=0;
-    //double m_rhs;
-    //double m_gCosts;
-    QMap<std::shared_ptr<InterSectionCell>, DStarParam> m_dStarMap;
-   // QMap<DStarParam, std::shared_ptr<InterSectionCell> > sortedOpenList;
-
-
-
+    ///cost-to-go of the cells (from the last expansion)
+    std::vector<double> m_g;
+    ///one-step lookahead of the cost-to-go
+    std::vector<double> m_rhs;
+    ///1, if the cell could not be reserved at the last replanning
+    std::vector<char> m_blocked;
+    ///cells with m_blocked set
+    std::vector<size_t> m_blockedCells;
+    ///inconsistent cells (g != rhs) by DStarKey
+    IndexedMinHeap<DStarKey> m_openList;
+    ///key modifier, accumulates the heuristic distance the start has moved since the first search
+    double m_km;
+    ///current cell of the car
+    size_t m_startIndex;
+    ///start at the last replanning, to update m_km
+    size_t m_lastStartIndex;
+    ///target cell, the search starts from here
+    size_t m_targetIndex;
 };
 
-/*inline bool operator<(const DStarParam &a, const DStarParam &b) {
-    if (std::get<0>(a.key) == std::get<0>(b.key)) {
-        return std::get<1>(a.key) < std::get<1>(b.key);
-    }
-    else {
-        return std::get<0>(a.key) < std::get<0>(b.key);
-    }
-}*/
-
 #endif // DstarLite_H
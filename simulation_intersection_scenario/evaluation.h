@@ -2,10 +2,16 @@
 #define EVALUATION_H
 
 #include "cargroupqueue.h"
-#include "plot2d.h"
 #include "prioritysorter.h"
 #include "distparam.h"
 
+#include <QtCore/QString>
+#include <QtCore/QMultiMap>
+#include <QtCore/QTextStream>
+#include <QtCore/QDataStream>
+
+class Plot2d;
+
 enum class CostType {
     OPENLOOP = 0,
     CLOSEDLOOP = 1
@@ -15,7 +21,6 @@ class Evaluation
 {
 public:
     Evaluation();
-    void setParentWidget(QWidget *parent);
     void calculatePathValues(const unsigned int& amountCars);
     void setPathSizePerCar(const QString& car, const unsigned int& pathSteps);
     void calculateDistanceCostsPerStep(const CarGroupQueue &cars, const unsigned int &step);
@@ -26,7 +31,7 @@ public:
     unsigned int getMaxPathLength() const;
     const std::map<int, double> &getCulmCostsPerStep() const;
     const std::vector<double>& getMeanFunctionValues() const;
-    void saveContAppliedControl(const CarGroupQueue &cars, const std::map<QString, std::vector<std::vector<double> > >& control);
+    void saveContAppliedControl(const CarGroupQueue &cars, const CarControls& control);
     void saveContCostsPerCar(const CarGroupQueue &cars);
     void saveCurrentCommunicatedConstraints(const CarGroupQueue &cars, unsigned int &step);
     std::map<QString, double> sumCostsOfCarToInfinity(const std::map<QString, std::vector<double> >& costsContinuous) const;
@@ -57,6 +62,7 @@ public:
     void saveMaxPriorityQueueLength(CarGroupQueue& cars, const unsigned int& step);
     void saveNumberOfPriorityQueues(CarGroupQueue& cars, const unsigned int& step);
     void saveCurrentDeltaForCar(CarGroupQueue& cars, const unsigned int& step);
+    void saveConflictResolution(const unsigned int& step, const unsigned int& rounds, const size_t& unresolvedCars);
     //void saveOccupiedCells(const std::shared_ptr<InterSection>& intersect, std::vector<std::shared_ptr<Car> > &cars);
     //Clear after each simulation run
     void clearStatisticsAfterOneRun();
@@ -96,6 +102,8 @@ public:
     void addCommEffortClosedLoopPerformance(const std::pair<unsigned int, double>& pair);
     void addCommEffortOpenLoopPerformance(const std::pair<unsigned int, double>& pair);
     std::map<unsigned int, unsigned int> getCommConstraintsPerStep() const;
+    std::map<unsigned int, unsigned int> getConflictRoundsPerStep() const;
+    std::map<unsigned int, size_t> getUnresolvedConflictsPerStep() const;
     std::map<QString, double> getCostsContinuousInfinity(const CostType &costType) const;
     void setCellSize(const double& cellSize);
     void setCommEffortWholeSimulationSum(const std::pair<double, unsigned int> &pair);
@@ -175,7 +183,6 @@ private:
     std::map<QString, Plot2d*> m_plots;
     ///choose colour
     unsigned int m_colorIndex;
-    QList<QColor> m_colors;
     ///communication effort of constraints in each time step
     std::map<unsigned int, unsigned int> m_commConstraintsPerStep;
     ///current cellsize of the intersection grid
@@ -216,6 +223,10 @@ private:
     std::map<double ,std::map<unsigned int, unsigned int> > m_maxPriorityQueueLength;
     ///saves the number of priority queues for each time instant for each cell size
     std::map<double, std::map<unsigned int, size_t> > m_numberPriorityQueues;
+    ///re-optimization rounds of the discrete conflict resolution for each time instant
+    std::map<unsigned int, unsigned int> m_conflictRoundsPerStep;
+    ///cars without reserved solution after the last round of the conflict resolution for each time instant
+    std::map<unsigned int, size_t> m_unresolvedConflictsPerStep;
     ///save the delta values (differences between min time needed and horizon for dynamics) for each car over time n
     std::map<QString, std::vector<size_t> > m_deltaOverTime;
     ///saves the consumption of space between interval fixed and interval moving principle
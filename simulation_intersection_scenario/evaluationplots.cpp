@@ -0,0 +1,1014 @@
+#include "evaluation.h"
+#include "plot2d.h"
+
+#include <qwt_plot.h>
+
+#include <QtCore/QDebug>
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+#include <QtGui/QColor>
+
+/**
+ * @brief plotColors
+ * @return colours of the curves, which are taken one after another
+ */
+static const QList<QColor>& plotColors() {
+    static const QList<QColor> colors({QColor(174, 63, 63), //red
+                                       QColor(226, 192, 149), //khaki
+                                       QColor(136, 183, 184), //blue
+                                       QColor(0,0,0), //black
+                                       QColor(0, 204, 0)}); //green
+    return colors;
+}
+
+/**
+ * @brief Evaluation::plotAppliedContControl
+ * @param accumulated
+ */
+void Evaluation::plotAppliedContControl(const size_t &N, const bool& accumulated) {
+    //one colour for each curve
+    Plot2d* p2d = nullptr;
+    //over each car
+    QString title = QString("Control ") + QString::number(m_controlContinuous.size()) + QString(" cars, N eq ") + QString::number(N);
+    for (auto it = m_controlContinuous.cbegin(); it != m_controlContinuous.cend(); it++) {
+        title = QString("Control ") + QString::number(m_controlContinuous.size()) + QString(" cars, N eq ") + QString::number(N);
+        if (!accumulated) {
+            title += ", " + it->first;
+        }
+        if (InterSectionParameters::varyCellSize == 1) {
+            title += QString(", Cellsize ") + QString::number(m_cellSize);
+        }
+        if (!accumulated || p2d == nullptr) {
+            if (m_skipTitle) {
+                p2d = new Plot2d(nullptr, "");
+            }
+            else {
+                p2d = new Plot2d(nullptr, title);
+            }
+        }
+        QMultiMap<double, double> vals;
+        //first component u(0)_0
+        for (unsigned int i = 0; i < it->second.size(); i++) {
+            vals.insert(i, it->second.at(i).at(0));
+        }
+        if (accumulated) {
+            p2d->addCurve(vals, QString(it->first) + QString(": u(0)_0"), QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::NoSymbol, QColor(plotColors().at(getNextValidColor(m_colorIndex))));
+        }
+        else {
+            p2d->addCurve(vals, QString(it->first) + QString(": u(0)_0"), QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::NoSymbol, QColor(plotColors().at(getNextValidColor(++m_colorIndex))));
+        }
+        vals.clear();
+        //second component
+        for (unsigned int i = 0; i < it->second.size(); i++) {
+            vals.insert(i, it->second.at(i).at(1));
+        }
+        if (accumulated) {
+            p2d->addCurve(vals, "u(0)_1", QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::NoSymbol, plotColors().at(getNextValidColor(m_colorIndex)));
+            ++m_colorIndex;
+        }
+        else {
+            p2d->addCurve(vals, "u(0)_1", QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::NoSymbol, plotColors().at(getNextValidColor(++m_colorIndex)));
+        }
+        if (!accumulated) {
+            m_plots[title] = p2d;
+        }
+    }
+    p2d->setAxisTitle(QwtPlot::Axis::xBottom, "n", QwtPlot::Axis::yLeft, "u");
+    p2d->enableGrid(true);
+    if (accumulated) {
+        m_plots[title] = p2d;
+    }
+}
+
+/**
+ * @brief Evaluation::plotContCosts
+ * @param accumulated plots all costs in one graph if true, otherwise in seperated graphs
+ */
+void Evaluation::plotCosts(const size_t& N, const CostType& costType, const bool& accumulated, const bool& withCulmCosts) {
+    Plot2d* p2d = nullptr;
+    double sumCosts = 0.0;
+    QMap<double, double> culmCostsOverTimeStep;
+    auto costMap = std::map<QString, std::vector<double> >();
+    QString preTitle;
+    if (costType == CostType::CLOSEDLOOP) {
+        costMap = m_closedLoopCosts;
+        preTitle = QString("closedLoop ");
+    }
+    else if (costType == CostType::OPENLOOP) {
+        costMap = m_openLoopCosts;
+        preTitle = QString("openLoop ");
+    }
+    m_colorIndex = 4;
+
+    QString title = preTitle + QString("Costs ") + QString::number(m_controlContinuous.size()) + QString(" cars, N eq ") + QString::number(N);
+    for (auto it = costMap.cbegin(); it != costMap.cend(); it++) {
+        title = preTitle + QString("Costs ") + QString::number(m_controlContinuous.size()) + QString(" cars, N eq ") + QString::number(N);
+        if (!accumulated) {
+            title += + ", " + it->first;
+        }
+        if (InterSectionParameters::varyCellSize == 1) {
+            title += QString(", Cellsize ") + QString::number(m_cellSize);
+        }
+        if (!accumulated || p2d == nullptr) {
+            if (m_skipTitle) {
+                p2d = new Plot2d(nullptr, "");
+            }
+            else {
+                p2d = new Plot2d(nullptr, title);
+            }
+        }
+        QMultiMap<double, double> vals;
+        for (unsigned int i = 0; i < it->second.size(); i++) {
+            vals.insert(i, it->second.at(i));
+            sumCosts += it->second.at(i);
+            if (costType == CostType::CLOSEDLOOP) {
+                m_culmClosedLoopCostsOverTimestepsOverCellsize[m_cellSize][i] += it->second.at(i);
+                //DEBUG
+                //qDebug() << "cellsize: " << m_cellSize << ", i: " << i << "val.: " << it->second.at(i) << endl;
+                //--DEBUG
+            }
+            else if (costType == CostType::OPENLOOP) {
+                m_culmOpenLoopCostsOverTimestepsOverCellsize[m_cellSize][i] += it->second.at(i);
+            }
+            culmCostsOverTimeStep[i] += it->second.at(i);
+            std::cout << "SumCosts (Closed-Loop): " << sumCosts << "\n";
+        }
+        //cari to cari+1
+        QString legendItem = it->first;
+        legendItem.replace("car", "robot");
+        int indexNumber = legendItem.indexOf(QRegExp("\\d?$"));
+        int carNumber = QString(legendItem).remove(0, indexNumber).toInt();
+        legendItem = legendItem.remove(indexNumber, legendItem.length() - indexNumber);
+        legendItem += QChar::Space;
+        carNumber++;
+        p2d->addCurve(vals, legendItem + QString::number(carNumber), QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::NoSymbol, plotColors().at(getNextValidColor(++m_colorIndex)));
+        if (!accumulated) {
+            p2d->enableGrid(true);
+            m_plots[title] = p2d;
+        }
+    }
+    //culm costs over one time step of all cars
+    if (p2d && withCulmCosts && !culmCostsOverTimeStep.empty()) {
+        if (costType == CostType::OPENLOOP) {
+            p2d->addCurve(culmCostsOverTimeStep, QString(QChar(0x03A3)) + QString("V"), QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::NoSymbol,
+                          plotColors().at(getNextValidColor(++m_colorIndex)), true);
+        }
+        else if (costType == CostType::CLOSEDLOOP) {
+            p2d->addCurve(culmCostsOverTimeStep, QString(QChar(0x03A3)) + QString("V"), QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::NoSymbol,
+                          plotColors().at(getNextValidColor(++m_colorIndex)), true);
+        }
+    }
+    if (m_skipTitle) {
+        p2d->setTitle("");
+    }
+    else {
+        p2d->setTitle(preTitle + QString("Costs ") + QString::number(m_controlContinuous.size()) + QString(" cars, N eq ") + QString::number(N));
+    }
+    if (costType == CostType::CLOSEDLOOP) {
+        p2d->setAxisTitle(QwtPlot::Axis::xBottom, "n", QwtPlot::Axis::yLeft, "l<sub>p</sub>");
+    }
+    else if (costType == CostType::OPENLOOP) {
+        p2d->setAxisTitle(QwtPlot::Axis::xBottom, "n", QwtPlot::Axis::yLeft, getInlineSuperSubscriptStyle()
+                          + QString("<span class='supsub'>V<sub class='subscript'>P</sub><sup class='superscript'>N</sup></span>(" + QString(QChar(0x00B7)) + QString(")")));
+    }
+    p2d->setLegendAlignment(Qt::AlignTop|Qt::AlignRight);
+    p2d->setAxisFormat(QwtPlot::Axis::yLeft, QChar('f'));
+    QwtInterval xInterval = p2d->getPlot()->axisInterval(QwtPlot::Axis::xBottom);
+    //QwtAxisScaleDraw = p2d->getPlot()->axisScaleDraw(QwtPlot::Axis::xBottom);
+    p2d->setAxisTicks(QwtPlot::Axis::xBottom, xInterval.minValue(), xInterval.maxValue(),xInterval.maxValue() / 5.0, 0.0, 0.0, 0.0, true);
+    QwtInterval yInterval = p2d->getPlot()->axisInterval(QwtPlot::Axis::yLeft);
+    p2d->setAxisTicks(QwtPlot::Axis::yLeft, yInterval.minValue(), yInterval.maxValue(), yInterval.maxValue() / (yInterval.maxValue() / 10.0), 0.0, 0.0, 0.0, true);
+    p2d->enableGrid(true);
+    if (accumulated) {
+        m_plots[title] = p2d;
+    }
+}
+
+void Evaluation::plotCulmCostsOverAllCellSizes(const size_t& N, const CostType &costType) {
+    Plot2d* p2d = nullptr;
+    QString title;
+    auto culmCostsMapOverCellSize = std::map<double, std::map<double, double> >();
+    if (costType == CostType::CLOSEDLOOP) {
+        culmCostsMapOverCellSize = m_culmClosedLoopCostsOverTimestepsOverCellsize;
+        title = QString("closedLoop ");
+    }
+    else if (costType == CostType::OPENLOOP) {
+        culmCostsMapOverCellSize = m_culmOpenLoopCostsOverTimestepsOverCellsize;
+        title = QString("openLoop ");
+    }
+    title += QString("AccumCosts over ") + QString::number(m_controlContinuous.size()) + QString(" cars, N eq ") + QString::number(N);
+    if (m_skipTitle) {
+        p2d = new Plot2d(nullptr, "");
+    }
+    else {
+        p2d = new Plot2d(nullptr, title);
+    }
+    std::pair<double, double> maxMinVal;
+    m_colorIndex = 4;
+    for (auto it = culmCostsMapOverCellSize.cbegin(); it != culmCostsMapOverCellSize.cend(); it++) {
+        QMap<double, double> currentCulmCosts(it->second);
+        //DEBUG
+        /*if (costType == CostType::CLOSEDLOOP) {
+            for (auto itDebug = currentCulmCosts.begin(); itDebug != currentCulmCosts.end(); itDebug++) {
+                qDebug() << "extracted cellsize: " << itDebug.key() << "value: " << itDebug.value();
+            }
+        }*/
+        //--DEBUG
+        QMultiMap<double, double> multiCurrentCulmCosts(currentCulmCosts);
+        maxMinVal = getMinAndMax(multiCurrentCulmCosts);
+        p2d->addCurve(multiCurrentCulmCosts, QString("c=") + QString::number(it->first), QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::NoSymbol,
+                      plotColors().at(getNextValidColor(++m_colorIndex)), true);
+    }
+    if (costType == CostType::CLOSEDLOOP) {
+        //p2d->setAxisTitle(QwtPlot::Axis::xBottom, "n", QwtPlot::Axis::yLeft, "<msub><mi>M</mi><mn>P</mn></msub>", QwtText::MathMLText);
+        p2d->setAxisTitle(QwtPlot::Axis::xBottom, "n", QwtPlot::Axis::yLeft, "M<sub>P</sub>", QwtText::RichText);
+    }
+    else if (costType == CostType::OPENLOOP) {
+        //p2d->setAxisTitle(QwtPlot::Axis::xBottom, "<mi>n</mi>", QwtPlot::Axis::yLeft, "<msub><mi>V</mi><mn>P</mn></msub>", QwtText::MathMLText);
+        p2d->setAxisTitle(QwtPlot::Axis::xBottom, "n", QwtPlot::Axis::yLeft, getInlineSuperSubscriptStyle() + QString(QChar(0x03A3))
+                          + QString("<span class='supsub'><sub class='subscript'>p=1</sub><sup class='superscript'>4</sup></span>")
+                          + QString("<span class='supsub'>V<sub class='subscript'>P</sub><sup class='superscript'>N</sup></span>(" + QString(QChar(0x00B7)) + QString(",") + QString(QChar(0x00B7) + QString(")"))),
+                          QwtText::RichText);
+    }
+    p2d->setScaleEngine(QwtPlotScaleType::LogScale);
+    p2d->setLegendAlignment(Qt::AlignBottom|Qt::AlignLeft);
+    p2d->setAxisFormat(QwtPlot::Axis::yLeft, QChar('e'));
+    QwtInterval xInterval = p2d->getPlot()->axisInterval(QwtPlot::Axis::xBottom);
+    p2d->setAxisTicks(QwtPlot::Axis::xBottom, xInterval.minValue(), xInterval.maxValue(),xInterval.maxValue() / 5.0, 0.0, 0.0, 0.0, true);
+    QwtInterval yInterval = p2d->getPlot()->axisInterval(QwtPlot::Axis::yLeft);
+    //p2d->setAxisTicks(QwtPlot::Axis::yLeft, yInterval.minValue(), yInterval.maxValue(), yInterval.maxValue() / (yInterval.maxValue() / 10.0), 0.0, 0.0, 0.0, true);
+    p2d->setAutoScale(QwtPlot::Axis::yLeft, 10, yInterval.minValue(), yInterval.maxValue(), 100);
+    p2d->getPlot()->setAxisMaxMinor(QwtPlot::Axis::yLeft, 0);
+    //double stepSize = 0.0;
+    //p2d->setAutoScale(QwtPlot::Axis::yLeft, std::floor(maxMinVal.second - maxMinVal.first), maxMinVal.first, maxMinVal.second, stepSize);
+    p2d->enableGrid(true);
+    m_plots[title] = p2d;
+}
+
+/**
+ * @brief Evaluation::plotCommEffortCostsInfinity plots the costs cumulated over all cars for each time step
+ * against the communication effort, which was necessary
+ */
+void Evaluation::plotCommEffortCostsInfinity(const CostType& costType) {
+    m_colorIndex = 3;
+    //one colour for each curve
+    Plot2d* p2d = nullptr;
+    QString title;
+    auto commEffortVsCosts = std::multimap<unsigned int, double>();
+    if (costType == CostType::CLOSEDLOOP) {
+        title = QString("closedLoop ");
+        commEffortVsCosts = m_commEffortClosedLoopPerformance;
+    }
+    else if (costType == CostType::OPENLOOP) {
+        title = QString("openLoop");
+        commEffortVsCosts = m_commEffortOpenLoopPerformance;
+    }
+    title += QString("vs Communication,") + QString::number(m_controlContinuous.size()) + QString(" cars");
+    if (m_skipTitle) {
+        p2d = new Plot2d(nullptr, "");
+    }
+    else {
+        p2d = new Plot2d(nullptr, title);
+    }
+    QMultiMap<double, double> vals;
+    for (auto it = commEffortVsCosts.cbegin(); it != commEffortVsCosts.cend(); it++) {
+        vals.insert(it->first, it->second);
+    }
+    p2d->addCurve(vals, QString(), QwtPlotCurve::CurveStyle::Dots, QwtSymbol::Style::NoSymbol, plotColors().at(getNextValidColor(++m_colorIndex)), false);
+    if (costType == CostType::CLOSEDLOOP) {
+        p2d->setAxisTitle(QwtPlot::Axis::xBottom, "K", QwtPlot::Axis::yLeft, "l");
+    }
+    else if (costType == CostType::OPENLOOP) {
+        p2d->setAxisTitle(QwtPlot::Axis::xBottom, "K", QwtPlot::Axis::yLeft, "V");
+    }
+    p2d->setTitle("");
+    p2d->setAxisFormat(QwtPlot::Axis::yLeft, QChar('e'));
+    p2d->enableGrid(true);
+    m_plots[title] = p2d;
+}
+
+void Evaluation::plotCommEffortToCellSize() {
+    //one colour for each curve
+    Plot2d* p2d = nullptr;
+    QString title = QString("Full Communication vs cell size,") + QString::number(m_controlContinuous.size()) + QString(" cars");
+    if (m_skipTitle) {
+        p2d = new Plot2d(nullptr, "");
+    }
+    else {
+        p2d = new Plot2d(nullptr, title);
+    }
+    m_colorIndex = 2;
+    QMultiMap<double, double> vals;
+    std::pair<double, double> firstValues;
+    for (auto it = m_gridSizeCommEffort.begin(); it != m_gridSizeCommEffort.end(); it++) {
+        vals.insert(it->first, it->second);
+        if (it == m_gridSizeCommEffort.begin()) {
+            firstValues.first = it->first;
+        }
+        else if (it != m_gridSizeCommEffort.begin()) {
+            auto itback = it;
+            --itback;
+            if (itback == m_gridSizeCommEffort.begin()) {
+                firstValues.second = it->first;
+            }
+        }
+    }
+    p2d->addCurve(vals, "", QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::Rect, plotColors().at(getNextValidColor(++m_colorIndex)), false);
+    if (m_gridSizeCommEffort.size() > 1) {
+        auto itLast = m_gridSizeCommEffort.end();
+        itLast--;
+        p2d->setAxisScale(QwtPlot::Axis::xBottom, m_gridSizeCommEffort.begin()->first, itLast->first, firstValues.second - firstValues.first);
+        p2d->setAxisTicks(QwtPlot::Axis::xBottom, m_gridSizeCommEffort.begin()->first, itLast->first, m_gridSizeCommEffort.size() - 1, 0, 0, 0, true);
+        std::pair<double, double> yMinMax = getMinAndMax(vals);
+        p2d->setAxisTicks(QwtPlot::Axis::yLeft, yMinMax.first, yMinMax.second, 5.0, 0, 0, 0);
+
+    }
+    p2d->setAxisTitle(QwtPlot::Axis::xBottom, "c", QwtPlot::Axis::yLeft, "K");
+    p2d->setAxisFormat(QwtPlot::Axis::yLeft, QChar('e'));
+    p2d->setTitle("");
+    p2d->enableGrid(true);
+    m_plots[title] = p2d;
+}
+
+void Evaluation::plotCostToCellSize(const CostType& costType) {
+    //one colour for each curve
+    Plot2d* p2d = nullptr;
+    QString title;
+    m_colorIndex = 2;
+    auto gridSizeCostsMap = std::map<double, double>();
+    if (costType == CostType::CLOSEDLOOP) {
+        title = QString("closedLoop ");
+        gridSizeCostsMap = m_gridSizeClosedLoopCostsMap;
+    }
+    else if (costType == CostType::OPENLOOP) {
+        title = QString("openLoop ");
+        gridSizeCostsMap = m_gridSizeOpenLoopCostsMap;
+    }
+    gridSizeCostsMap.erase(0);
+
+    title += QString("Costs vs cell size");
+    if (m_skipTitle) {
+        p2d = new Plot2d(nullptr, "");
+    }
+    else {
+        p2d = new Plot2d(nullptr, title);
+    }
+    QMultiMap<double, double> vals;
+    std::pair<double, double> firstValues;
+    for (auto it = gridSizeCostsMap.begin(); it != gridSizeCostsMap.end(); it++) {
+        vals.insert(it->first, it->second);
+        if (it == gridSizeCostsMap.begin()) {
+            firstValues.first = it->first;
+        }
+        else if (it != gridSizeCostsMap.begin()) {
+            auto itback = it;
+            --itback;
+            if (itback == gridSizeCostsMap.begin()) {
+                firstValues.second = it->first;
+            }
+        }
+    }
+    p2d->addCurve(vals, QString(), QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::Rect, plotColors().at(getNextValidColor(++m_colorIndex)), false);
+    if (gridSizeCostsMap.size() > 1) {
+        auto itLast = gridSizeCostsMap.end();
+        itLast--;
+        p2d->setAxisScale(QwtPlot::Axis::xBottom, gridSizeCostsMap.begin()->first, itLast->first, firstValues.second - firstValues.first);
+        p2d->setAxisTicks(QwtPlot::Axis::xBottom, gridSizeCostsMap.begin()->first, itLast->first, gridSizeCostsMap.size() - 1, 0, 0, 0, true);
+    }
+    p2d->disableLegend();
+    if (costType == CostType::CLOSEDLOOP) {
+        p2d->setAxisTitle(QwtPlot::Axis::xBottom, "c", QwtPlot::Axis::yLeft, "M", QwtText::PlainText);
+    }
+    else if (costType == CostType::OPENLOOP) {
+        p2d->setAxisTitle(QwtPlot::Axis::xBottom, "c", QwtPlot::Axis::yLeft, "V", QwtText::PlainText);
+    }
+    p2d->setAxisFormat(QwtPlot::Axis::yLeft, QChar('e'), 0);
+    std::pair<double, double> yMinMax = getMinAndMax(vals);
+    p2d->setAxisTicks(QwtPlot::Axis::yLeft, yMinMax.first, yMinMax.second, 5.0, 0, 0, 0);
+    p2d->disableLegend();
+    p2d->setTitle("");
+    p2d->enableGrid(true);
+    m_plots[title] = p2d;
+}
+
+void Evaluation::plotDifferentialCommunicationAndNormalCommunicationToCellSize(const bool& full, const bool& diff) {
+    m_colorIndex = 0;
+    //one colour for each curve
+    Plot2d* p2d = nullptr;
+    QString title = QString("Normal and Diff CommEffort vs cell size, ") + QString::number(m_controlContinuous.size()) + QString(" cars");
+    if (m_skipTitle) {
+        p2d = new Plot2d(nullptr, "");
+    }
+    else {
+        p2d = new Plot2d(nullptr, title);
+    }
+    QMultiMap<double, double> vals;
+    std::pair<double, double> firstValues;
+    m_colorIndex = 0;
+    //differential communication
+    if (diff) {
+        double summedValue = 0.0;
+        for (auto it = m_gridSizeDifferentialCommEffort.begin(); it != m_gridSizeDifferentialCommEffort.end(); it++) {
+            //TODO: entweder gemittlelter Wert oder absolute Zahlen
+            vals.insert(it->first, it->second / m_culmClosedLoopCostsOverTimestepsOverCellsize.at(it->first).size());
+            qDebug() << "diffComm:" << it->first << ", " << it->second;
+            if (it == m_gridSizeDifferentialCommEffort.begin()) {
+                firstValues.first = it->first;
+            }
+            else if (it != m_gridSizeDifferentialCommEffort.begin()) {
+                auto itback = it;
+                --itback;
+                if (itback == m_gridSizeDifferentialCommEffort.begin()) {
+                    firstValues.second = it->first;
+                }
+            }
+            summedValue += it->second;
+        }
+        qDebug() << "diff comm: first values: " << firstValues.first << "," << firstValues.second;
+        p2d->addCurve(vals, "With Differential Communication", QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::Rect, plotColors().at(getNextValidColor(++m_colorIndex)), false);
+        p2d->addExtData("sumDiffCommEffort: ", QVariant(summedValue));
+    }
+    vals.clear();
+    //normal communication
+    if (full) {
+        double summedValue = 0.0;
+        for (auto it = m_gridSizeCommEffort.begin(); it != m_gridSizeCommEffort.end(); it++) {
+            vals.insert(it->first, it->second / m_culmClosedLoopCostsOverTimestepsOverCellsize.at(it->first).size());
+            summedValue += it->second;
+            qDebug() << "fullComm:" << it->first << ", " << it->second;
+        }
+        for (auto it = m_gridSizeCommEffort.begin(); it != m_gridSizeCommEffort.end(); it++) {
+            vals.insert(it->first, it->second / m_culmClosedLoopCostsOverTimestepsOverCellsize.at(it->first).size());
+            qDebug() << "diffComm:" << it->first << ", " << it->second;
+            if (it == m_gridSizeCommEffort.begin()) {
+                firstValues.first = it->first;
+            }
+            else if (it != m_gridSizeCommEffort.begin()) {
+                auto itback = it;
+                --itback;
+                if (itback == m_gridSizeCommEffort.begin()) {
+                    firstValues.second = it->first;
+                }
+            }
+        }
+        p2d->addExtData("sumFullCommEffort: ", QVariant(summedValue));
+        p2d->addCurve(vals, "Without Differential Communication", QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::Diamond, plotColors().at(getNextValidColor(++m_colorIndex)), false);
+    }
+    p2d->setAxisTitle(QwtPlot::Axis::xBottom, "c", QwtPlot::Axis::yLeft, "K");
+    if (m_gridSizeCommEffort.size() > 1) {
+        auto itLast = m_gridSizeCommEffort.end();
+        itLast--;
+        p2d->setAxisScale(QwtPlot::Axis::xBottom, m_gridSizeCommEffort.begin()->first, itLast->first, firstValues.second - firstValues.first);
+        p2d->setAxisTicks(QwtPlot::Axis::xBottom, m_gridSizeCommEffort.begin()->first, itLast->first, m_gridSizeCommEffort.size() - 1, 0, 0, 0, true);
+        //std::pair<double, double> yMinMax = getMinAndMax(vals);
+        //p2d->setAxisTicks(QwtPlot::Axis::yLeft, yMinMax.first, yMinMax.second, 5.0, 0, 0, 0);
+
+    }
+    else if (m_gridSizeDifferentialCommEffort.size() > 1) {
+        auto itLast = m_gridSizeDifferentialCommEffort.end();
+        itLast--;
+        p2d->setAxisScale(QwtPlot::Axis::xBottom, m_gridSizeDifferentialCommEffort.begin()->first, itLast->first, firstValues.second - firstValues.first);
+        p2d->setAxisTicks(QwtPlot::Axis::xBottom, m_gridSizeDifferentialCommEffort.begin()->first, itLast->first, m_gridSizeDifferentialCommEffort.size() - 1, 0, 0, 0, true);
+    }
+    /*if (p2d->curves().size() < 2) {
+        p2d->disableLegend();
+    }
+    else {
+        p2d->enableLegend();
+    }*/
+    p2d->setTitle("");
+    p2d->getPlot()->setAxisMaxMinor(QwtPlot::Axis::yLeft, 0);
+    p2d->setLegendAlignment(Qt::AlignBottom|Qt::AlignLeft);
+    p2d->enableGrid(true);
+    m_plots[title] = p2d;
+}
+
+/**
+ * @brief Evaluation::plotPredictionDifference plots \f$ \sum_{k=0}^{N-1} plots the difference of the prediction for each car and optionally
+ * culmulative
+ * @param N prediction horizon length
+ * @param culmulative if true, the summed up curve will also be drawn
+ */
+void Evaluation::plotPredictionDifference(const size_t &N, const bool& culmulative) {
+    Plot2d* p2d = nullptr;
+    QString title = QString("Prediction Difference,") + QString::number(m_controlContinuous.size()) + QString("cars") + QString(",Neq") + QString::number(N) +
+            QString("cellsize") + QString::number(m_cellSize);
+    if (m_skipTitle) {
+        p2d = new Plot2d(nullptr, "");
+    }
+    else {
+        p2d = new Plot2d(nullptr, title);
+    }
+    unsigned int maxValue = 0;
+    //go over each car and add a curve for prediction difference in each time step
+    for (auto itCarPrediction = m_diffPredictions.begin(); itCarPrediction != m_diffPredictions.end(); itCarPrediction++) {
+        //add elements for each time step
+        QMap<double, double> vals;
+        unsigned int time = 0;
+        for (auto vecElement : itCarPrediction->second) {
+            vals.insert(time, vecElement);
+            time++;
+        }
+        if (time > maxValue) {
+            maxValue = time;
+        }
+        //cari to cari+1
+        QString legendItem = itCarPrediction->first;
+        legendItem.replace("car", "p=");
+        int indexNumber = legendItem.indexOf(QRegExp("\\d?$"));
+        int carNumber = QString(legendItem).remove(0, indexNumber).toInt();
+        legendItem = legendItem.remove(indexNumber, legendItem.length() - indexNumber);
+        //legendItem += QChar::Space;
+        carNumber++;
+        p2d->addCurve(vals, /*itCarPrediction->first*/ legendItem + QString::number(carNumber), QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::NoSymbol,
+                      plotColors().at(getNextValidColor(++m_colorIndex)), true);
+    }
+    if (culmulative) {
+        QMap<double, double> culmVals;
+        //iterate over time
+        for (unsigned int i = 0; i < maxValue; i++) {
+            //iterate over cards
+            for (auto itCarPrediction = m_diffPredictions.begin(); itCarPrediction != m_diffPredictions.end(); itCarPrediction++) {
+                if (itCarPrediction->second.size() > i) {
+                    culmVals[i] += itCarPrediction->second.at(i);
+                }
+            }
+        }
+        p2d->addCurve(culmVals, QString("r<sub>c</sub>"), QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::NoSymbol,
+                      plotColors().at(getNextValidColor(++m_colorIndex)), true);
+    }
+    p2d->setLegendAlignment(Qt::AlignTop|Qt::AlignRight);
+    QwtInterval xInterval = p2d->getPlot()->axisInterval(QwtPlot::Axis::xBottom);
+    //QwtAxisScaleDraw = p2d->getPlot()->axisScaleDraw(QwtPlot::Axis::xBottom);
+    p2d->setAxisTicks(QwtPlot::Axis::xBottom, xInterval.minValue(), xInterval.maxValue(),xInterval.maxValue() / 5.0, 0.0, 0.0, 0.0, true);
+    QwtInterval yInterval = p2d->getPlot()->axisInterval(QwtPlot::Axis::yLeft);
+    p2d->setAxisTicks(QwtPlot::Axis::yLeft, yInterval.minValue(), yInterval.maxValue(), yInterval.maxValue() / (yInterval.maxValue() / 10.0), 0.0, 0.0, 0.0, true);
+    p2d->enableGrid(true);
+    if (culmulative) {
+        p2d->setAxisTitle(QwtPlot::Axis::xBottom, "n", QwtPlot::Axis::yLeft, QString(QChar(0x03A3)) + QString("r<sub>c</sub>"), QwtText::RichText);
+    }
+    else {
+        p2d->setAxisTitle(QwtPlot::Axis::xBottom, "n", QwtPlot::Axis::yLeft, "r<sub>c</sub>", QwtText::RichText);
+    }
+    m_plots[title] = p2d;
+}
+
+/**
+ * @brief Evaluation::plotPredictionDifferenceOverCellSizes plots the prediction difference accumulated over all cars for each cell size
+ * @param N
+ */
+void Evaluation::plotPredictionDifferenceOverCellSizes(const size_t &N) {
+    Plot2d* p2d = nullptr;
+    QString title = QString("Prediction Difference,") + QString::number(m_controlContinuous.size()) + QString("cars") + QString(",Neq") + QString::number(N);
+    QStringList cols;
+    cols << "time";
+    if (m_skipTitle) {
+        p2d = new Plot2d(nullptr, "");
+    }
+    else {
+        p2d = new Plot2d(nullptr, title);
+    }
+    //iterate over cell sizes
+    for (auto itSim = m_diffPredictionsOverCellSize.begin(); itSim != m_diffPredictionsOverCellSize.end(); itSim++) {
+        auto carPredictions = itSim->second;
+        size_t maxValue = 0;
+        for (auto itMaxValue = carPredictions.begin(); itMaxValue !=  carPredictions.end(); itMaxValue++) {
+            if (maxValue < itMaxValue->second.size()) {
+                maxValue = itMaxValue->second.size();
+            }
+        }
+        QMap<double, double> summedValues;
+        //iterate over time
+        for (size_t i = 0; i < maxValue; i++) {
+            //iterate over car predictions
+            for (auto itCarPrediction = carPredictions.begin(); itCarPrediction != carPredictions.end(); itCarPrediction++) {
+                if (itCarPrediction->second.size() > i) {
+                    summedValues[i] += itCarPrediction->second.at(i);
+                }
+            }
+        }
+        p2d->addCurve(summedValues, QString("c=") + QString::number(itSim->first, 'f', 1), QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::NoSymbol,
+                                   plotColors().at(getNextValidColor(++m_colorIndex)), true);
+        cols << QString("c=") + QString::number(itSim->first);
+    }
+    p2d->exportToTextFile(title + QString(".txt"));
+    p2d->setAxisTitle(QwtPlot::Axis::xBottom, "n", QwtPlot::Axis::yLeft, QString(QChar(0x03A3)) + "r<sub>c</sub>", QwtText::RichText);
+    p2d->setLegendAlignment(Qt::AlignTop|Qt::AlignRight);
+    QwtInterval xInterval = p2d->getPlot()->axisInterval(QwtPlot::Axis::xBottom);
+    //QwtAxisScaleDraw = p2d->getPlot()->axisScaleDraw(QwtPlot::Axis::xBottom);
+    p2d->setAxisTicks(QwtPlot::Axis::xBottom, xInterval.minValue(), xInterval.maxValue(),xInterval.maxValue() / 5.0, 0.0, 0.0, 0.0, true);
+    QwtInterval yInterval = p2d->getPlot()->axisInterval(QwtPlot::Axis::yLeft);
+    p2d->setAxisTicks(QwtPlot::Axis::yLeft, yInterval.minValue(), yInterval.maxValue(), yInterval.maxValue() / (yInterval.maxValue() / 10.0), 0.0, 0.0, 0.0, true);
+    p2d->enableGrid(true);
+    m_plots[title] = p2d;
+}
+
+/**
+ * @brief Evaluation::plotOccupancyGridDifferenceOverCellSizes plots the cumulated sum of differences of two successive occupancy grids over the whole prediction horizon
+ * (open-loop)
+ * @param N
+ */
+void Evaluation::plotOccupancyGridDifferenceOverCellSizes(const size_t &N) {
+    Plot2d* p2d = nullptr;
+    QString title = QString("Occupancy Grid Difference,") + QString::number(m_controlContinuous.size()) + QString("cars") + QString(",Neq") + QString::number(N);
+    if (m_skipTitle) {
+        p2d = new Plot2d(nullptr, "");
+    }
+    else {
+        p2d = new Plot2d(nullptr, title);
+    }
+    //iterate over cell sizes
+    for (auto itSim = m_diffOccupancyGridsOverCellSize.begin(); itSim != m_diffOccupancyGridsOverCellSize.end(); itSim++) {
+        auto carPredictions = itSim->second;
+        size_t maxValue = 0;
+        for (auto itMaxValue = carPredictions.begin(); itMaxValue !=  carPredictions.end(); itMaxValue++) {
+            if (maxValue < itMaxValue->second.size()) {
+                maxValue = itMaxValue->second.size();
+            }
+        }
+        QMap<double, double> summedValues;
+        //iterate over time
+        for (unsigned int i = 0; i < maxValue; i++) {
+            //iterate over car predictions
+            for (auto itCarPrediction = carPredictions.begin(); itCarPrediction != carPredictions.end(); itCarPrediction++) {
+                if (itCarPrediction->second.size() > i) {
+                    summedValues[i] += itCarPrediction->second.at(i);
+                }
+            }
+        }
+        p2d->addCurve(summedValues, QString("c=") + QString::number(itSim->first, 'f', 1), QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::NoSymbol,
+                                   plotColors().at(getNextValidColor(++m_colorIndex)), true);
+    }
+    p2d->setAxisTitle(QwtPlot::Axis::xBottom, "n", QwtPlot::Axis::yLeft, "r<sub>q</sub>", QwtText::RichText);
+    p2d->setLegendAlignment(Qt::AlignTop|Qt::AlignRight);
+    QwtInterval xInterval = p2d->getPlot()->axisInterval(QwtPlot::Axis::xBottom);
+    //QwtAxisScaleDraw = p2d->getPlot()->axisScaleDraw(QwtPlot::Axis::xBottom);
+    p2d->setAxisTicks(QwtPlot::Axis::xBottom, xInterval.minValue(), xInterval.maxValue(),xInterval.maxValue() / 5.0, 0.0, 0.0, 0.0, true);
+    QwtInterval yInterval = p2d->getPlot()->axisInterval(QwtPlot::Axis::yLeft);
+    p2d->setAxisTicks(QwtPlot::Axis::yLeft, yInterval.minValue(), yInterval.maxValue(), yInterval.maxValue() / (yInterval.maxValue() / 10.0), 0.0, 0.0, 0.0, true);
+    p2d->enableGrid(true);
+    m_plots[title] = p2d;
+}
+
+/**
+ * @brief Evaluation::plotGridPredictionDifference plots the differences of occupancy grid predictions
+ * @param N prediction horizon length
+ * @param culmulative
+ */
+void Evaluation::plotGridPredictionDifference(const size_t &N, const bool &culmulative) {
+    Plot2d* p2d = nullptr;
+    QString title = QString("Occupancy Grid Difference, ") + QString::number(m_controlContinuous.size()) + QString("cars") + QString(",Neq") + QString::number(N)
+            + QString("cellsize") + QString::number(m_cellSize);
+    if (m_skipTitle) {
+        p2d = new Plot2d(nullptr, "");
+    }
+    else {
+        p2d = new Plot2d(nullptr, title);
+    }
+    unsigned int maxValue = 0;
+    for (auto itDiffOccupancyGrid = m_diffOccupancyGrid.begin(); itDiffOccupancyGrid != m_diffOccupancyGrid.end(); itDiffOccupancyGrid++) {
+        QMap<double, double> vals;
+        unsigned int time = 0;
+        for (auto vecElem : itDiffOccupancyGrid->second) {
+            vals.insert(time, vecElem);
+            time++;
+        }
+        if (time > maxValue) {
+            maxValue = time;
+        }
+        //cari to cari+1
+        QString legendItem = itDiffOccupancyGrid->first;
+        legendItem.replace("car", "p=");
+        int indexNumber = legendItem.indexOf(QRegExp("\\d?$"));
+        int carNumber = QString(legendItem).remove(0, indexNumber).toInt();
+        legendItem = legendItem.remove(indexNumber, legendItem.length() - indexNumber);
+        //legendItem += QChar::Space;
+        carNumber++;
+        p2d->addCurve(vals, /*itDiffOccupancyGrid->first*/legendItem + QString::number(carNumber), QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::NoSymbol,
+                      plotColors().at(getNextValidColor(++m_colorIndex)), true);
+    }
+    if (culmulative) {
+        QMap<double, double> culmVals;
+        //iterate over time
+        for (unsigned int i = 0; i < maxValue; i++) {
+            //iterate over cards
+            for (auto itCarPrediction = m_diffOccupancyGrid.begin(); itCarPrediction != m_diffOccupancyGrid.end(); itCarPrediction++) {
+                if (itCarPrediction->second.size() > i) {
+                    culmVals[i] += itCarPrediction->second.at(i);
+                }
+            }
+        }
+        p2d->addCurve(culmVals, QString("r<sub>c</sub>(n)"), QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::NoSymbol,
+                      plotColors().at(getNextValidColor(++m_colorIndex)), true);
+    }
+    p2d->setAxisTitle(QwtPlot::Axis::xBottom, "n", QwtPlot::Axis::yLeft, "r<sub>q</sub>", QwtText::RichText);
+    p2d->setLegendAlignment(Qt::AlignTop|Qt::AlignRight);
+    QwtInterval xInterval = p2d->getPlot()->axisInterval(QwtPlot::Axis::xBottom);
+    //QwtAxisScaleDraw = p2d->getPlot()->axisScaleDraw(QwtPlot::Axis::xBottom);
+    p2d->setAxisTicks(QwtPlot::Axis::xBottom, xInterval.minValue(), xInterval.maxValue(),xInterval.maxValue() / 5.0, 0.0, 0.0, 0.0, true);
+    QwtInterval yInterval = p2d->getPlot()->axisInterval(QwtPlot::Axis::yLeft);
+    p2d->setAxisTicks(QwtPlot::Axis::yLeft, yInterval.minValue(), yInterval.maxValue(), yInterval.maxValue() / (yInterval.maxValue() / 10.0), 0.0, 0.0, 0.0, true);
+    p2d->enableGrid(true);
+    m_plots[title] = p2d;
+}
+
+/**
+ * @brief Evaluation::plotOccupancyCellsHeatMap
+ * @param time
+ * @param numberVehicles
+ */
+void Evaluation::plotOccupancyCellsHeatMap(const unsigned int& time, const unsigned int &numberVehiclesArrived,
+                                           const unsigned int &numberVehiclesWaiting, const double& cellSize, const std::vector<DistParam>& distParams) {
+    Plot2d* p2d = nullptr;
+    QString title = QString("Occupancy Grid Heat Map,time,") + QString::number(time)
+            + QString("numberVehiclesArr,") + QString::number(numberVehiclesArrived)
+            + QString("numberVehiclesWaiting,") + QString::number(numberVehiclesWaiting)
+            + QString("cellSize,") + QString::number(cellSize);
+    QString subTitle = title;
+    for (size_t i = 0; i < distParams.size(); i++) {
+        subTitle += "en" + QString::number(i) + QString(",");
+        if (distParams.at(i).distribFunc == DistributionFunction::POISSON) {
+            subTitle += "poisson,";
+        }
+        else if (distParams.at(i).distribFunc == DistributionFunction::EXP) {
+            subTitle += "exponential,";
+        }
+        subTitle += "ma," + QString::number(distParams.at(i).meanArrivalTime) + QString(",");
+
+    }
+    if (m_skipTitle) {
+        p2d = new Plot2d(nullptr, "");
+    }
+    else {
+        p2d = new Plot2d(nullptr, title);
+    }
+    //evaluate maximum x and maximum y
+    //unsigned int x = 0, y = 0;
+    /*for (auto it = m_occupiedCells.begin(); it != m_occupiedCells.end(); it++) {
+        if (it->first->getX() > (double)x) {
+            x = it->first->getX();
+        }
+        if (it->first->getY() > (double)y) {
+            y = it->first->getY();
+        }
+    }*/
+    //raster matrix to depict the whole intersection
+    QVector<QVector<unsigned int> > valueMatrix;
+    valueMatrix.reserve(m_occupiedCells.size());
+    for (QVector<unsigned int> valsY : valueMatrix) {
+        valsY.reserve(m_occupiedCells.at(0).size());
+    }
+    for (auto row = 0; valueMatrix.size() < m_occupiedCells.size(); row++) {
+        valueMatrix.push_back(QVector<unsigned int>());
+        for (auto col = 0; valueMatrix.at(row).size() < m_occupiedCells.at(row).size(); col++) {
+            valueMatrix[row].push_back(0);
+        }
+    }
+    //fill the raster now with the intersection values
+    for (unsigned int row = 0; row < m_occupiedCells.size(); row++) {
+        for (unsigned int col = 0; col < m_occupiedCells.at(row).size(); col++) {
+            valueMatrix[row][col] = m_occupiedCells.at(row).at(col);
+        }
+    }
+    p2d->addSpectogram(valueMatrix, title);
+    m_plots[title] = p2d;
+}
+
+/**
+ * @brief Evaluation::plotMaxPriorityQueueLength plots the maximum length of priority queues for each time instant
+ * @param numberCars number of cars
+ * @param N horizon length
+ * @param prioritySort priority criteria
+ */
+void Evaluation::plotMaxPriorityQueueLength(const size_t& numberCars, const size_t& N, const QString &prioritySort) {
+    Plot2d* p2d = nullptr;
+    QString title = QString("MaxPriorityQueues,") + prioritySort + QString(",") + QString::number(numberCars)
+            + QString("cars,") + QString("Neq,") + QString::number(N);
+    if (m_skipTitle) {
+        p2d = new Plot2d(nullptr, "");
+    }
+    else {
+        p2d = new Plot2d(nullptr, title);
+    }
+    m_colorIndex = 4;
+    QMap<double, double> vals;
+    for (auto itCell = m_maxPriorityQueueLength.begin(); itCell != m_maxPriorityQueueLength.end(); itCell++) {
+        vals.clear();
+        for (auto itQueue = itCell->second.begin(); itQueue != itCell->second.end(); itQueue++) {
+            vals[itQueue->first] = itQueue->second;
+        }
+        p2d->addCurve(vals, QString("c=") + QString::number(itCell->first, 'f', 1), QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::NoSymbol,
+                                   plotColors().at(getNextValidColor(++m_colorIndex)), true);
+    }
+    p2d->setLegendAlignment(Qt::AlignTop|Qt::AlignRight);
+    if (prioritySort == PrioritySorter::getTextForChosenCriteria(PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORY)
+        || prioritySort == PrioritySorter::getTextForChosenCriteria(PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORY)
+            ) {
+        p2d->setAxisTitle(QwtPlot::Axis::xBottom, "n", QwtPlot::Axis::yLeft, QString("max<sub>|") + QString(QChar(0x03A0)) + QString("(n)|</sub>"), QwtText::RichText);
+    }
+    else if (prioritySort == PrioritySorter::getTextForChosenCriteria(PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY)
+             || prioritySort == PrioritySorter::getTextForChosenCriteria(PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYHIERARCHY)
+             || prioritySort == PrioritySorter::getTextForChosenCriteria(PriorityCriteria::MINCLOSEDLOOPCOSTSCOLORING)
+             || prioritySort == PrioritySorter::getTextForChosenCriteria(PriorityCriteria::MINOPENLOOPCOSTSCOLORING)) {
+        p2d->setAxisTitle(QwtPlot::Axis::xBottom, "n", QwtPlot::Axis::yLeft, QString("#") + QString("M(n)"), QwtText::RichText);
+    }
+    else if (prioritySort == PrioritySorter::getTextForChosenCriteria(PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYTREE)
+             || prioritySort == PrioritySorter::getTextForChosenCriteria(PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYTREE)) {
+        p2d->setAxisTitle(QwtPlot::Axis::xBottom, "n", QwtPlot::Axis::yLeft, QString("max|") + QString("G(n)|"), QwtText::RichText);
+    }
+
+    std::pair<double, double> minMax = getMinAndMax(vals);
+    p2d->setAxisTicks(QwtPlot::Axis::yLeft, minMax.first, minMax.second + 1.0, minMax.second - 1.0, 0.0, 0.0, 0.0, true);
+    m_plots[title] = p2d;
+}
+
+/**
+ * @brief Evaluation::plotNumberOfPriorityQueues plots the number of priority queues in each time instant
+ * @param numberCars number of cars
+ * @param N horizon length
+ * @param prioritySort criteria for priority sort
+ */
+void Evaluation::plotNumberOfPriorityQueues(const size_t &numberCars, const size_t &N, const QString &prioritySort) {
+    Plot2d* p2d = nullptr;
+    QString title = QString("NumberOfPriorityQueues,") + prioritySort + QString(",") + QString::number(numberCars)
+            + QString("cars,") + QString("Neq") + QString::number(N);
+    if (m_skipTitle) {
+        p2d = new Plot2d(nullptr, "");
+    }
+    else {
+        p2d = new Plot2d(nullptr, title);
+    }
+    m_colorIndex = 4;
+    QMap<double, double> vals;
+    for (auto itCell = m_numberPriorityQueues.begin(); itCell != m_numberPriorityQueues.end(); itCell++) {
+        vals.clear();
+        for (auto itQueue = itCell->second.begin(); itQueue != itCell->second.end(); itQueue++) {
+            vals[itQueue->first] = itQueue->second;
+        }
+        p2d->addCurve(vals, QString("c=") + QString::number(itCell->first, 'f', 2), QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::NoSymbol,
+                                   plotColors().at(getNextValidColor(++m_colorIndex)), true);
+    }
+    p2d->setLegendAlignment(Qt::AlignTop|Qt::AlignRight);
+    p2d->setAxisTitle(QwtPlot::Axis::xBottom, "n", QwtPlot::Axis::yLeft, QString(QChar(0x03A0) + QString("<sub>n#</sub>")), QwtText::RichText);
+    std::pair<double, double> minMax = getMinAndMax(vals);
+    p2d->setAxisTicks(QwtPlot::Axis::yLeft, minMax.first, minMax.second, minMax.second - 1.0, 0.0, 0.0, 0.0, true);
+    m_plots[title] = p2d;
+}
+
+
+void Evaluation::showPlots() {
+    for (auto it = m_plots.begin(); it != m_plots.end(); it++) {
+        it->second->show();
+    }
+}
+
+/**
+ * @brief plotDeltaOfCellSize plots the delta time, how much time is left for one car to cross the interval
+ * @param cellSize
+ */
+void Evaluation::plotDeltaOfCellSize(const size_t &numberCars, const size_t& N, const double& cellSize) {
+    m_colorIndex = 4;
+    Plot2d* p2d = nullptr;
+    QString title = QString("Delta,") + QString::number(numberCars)
+            + QString("cars,") + QString("Neq") + QString::number(N) + QString(",cellsize") + QString::number(cellSize);
+    if (m_skipTitle) {
+        p2d = new Plot2d(nullptr, "");
+    }
+    else {
+        p2d = new Plot2d(nullptr, title);
+    }
+    unsigned int maxValue = 0;
+    for (auto itDeltaCarVec = m_deltaOverTime.begin(); itDeltaCarVec != m_deltaOverTime.end(); itDeltaCarVec++) {
+        QMap<double, double> vals;
+        unsigned int time = 0;
+        for (auto vecElem : itDeltaCarVec->second) {
+            vals.insert(time, vecElem);
+            time++;
+        }
+        if (time > maxValue) {
+            maxValue = time;
+        }
+        //cari to cari+1
+        QString legendItem = itDeltaCarVec->first;
+        legendItem.replace("car", "p=");
+        int indexNumber = legendItem.indexOf(QRegExp("\\d?$"));
+        int carNumber = QString(legendItem).remove(0, indexNumber).toInt();
+        legendItem = legendItem.remove(indexNumber, legendItem.length() - indexNumber);
+        //legendItem += QChar::Space;
+        carNumber++;
+        p2d->addCurve(vals, /*itDiffOccupancyGrid->first*/legendItem + QString::number(carNumber), QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::NoSymbol,
+                      plotColors().at(getNextValidColor(++m_colorIndex)), true);
+    }
+    p2d->setAxisTitle(QwtPlot::Axis::xBottom, "n", QwtPlot::Axis::yLeft, QString("k") + QString("<sub>l</sub>"), QwtText::RichText);
+    p2d->setLegendAlignment(Qt::AlignTop|Qt::AlignRight);
+    QwtInterval xInterval = p2d->getPlot()->axisInterval(QwtPlot::Axis::xBottom);
+    //QwtAxisScaleDraw = p2d->getPlot()->axisScaleDraw(QwtPlot::Axis::xBottom);
+    p2d->setAxisTicks(QwtPlot::Axis::xBottom, xInterval.minValue(), xInterval.maxValue(),xInterval.maxValue() / 5.0, 0.0, 0.0, 0.0, true);
+    QwtInterval yInterval = p2d->getPlot()->axisInterval(QwtPlot::Axis::yLeft);
+    p2d->setAxisTicks(QwtPlot::Axis::yLeft, yInterval.minValue(), yInterval.maxValue(), yInterval.maxValue() / (yInterval.maxValue() / 4.0), 0.0, 0.0, 0.0, true);
+    p2d->enableGrid(true);
+    m_plots[title] = p2d;
+}
+
+/**
+ * @brief Evaluation::plotConsumedCellDifference
+ * @param numberCars
+ * @param N
+ */
+void Evaluation::plotConsumedCellDifference(const size_t &numberCars, const size_t &N) {
+    m_colorIndex = 4;
+    Plot2d* p2d = nullptr;
+    QString title = QString("CellDifference,") + QString::number(numberCars)
+            + QString("cars,") + QString("Neq") + QString::number(N);
+    if (m_skipTitle) {
+        p2d = new Plot2d(nullptr, "");
+    }
+    else {
+        p2d = new Plot2d(nullptr, title);
+    }
+    //iterate over cell sizes
+    if (m_intervalTypeConsumedCellSizes.find(CommunicationScheme::MINMAXINTERVAL) != m_intervalTypeConsumedCellSizes.end()) {
+        for (auto itCell = m_intervalTypeConsumedCellSizes.at(CommunicationScheme::MINMAXINTERVAL).begin(); itCell != m_intervalTypeConsumedCellSizes.at(CommunicationScheme::MINMAXINTERVAL).end(); itCell++) {
+            QMap<double, double> vals;
+            //iterate over time instants
+            for (size_t i = 0; i < itCell->second.size(); i++) {
+                if (m_intervalTypeConsumedCellSizes.at(CommunicationScheme::MINMAXINTERVALMOVING).size() > 0) {
+                    std::vector<int> movingVector = m_intervalTypeConsumedCellSizes.at(CommunicationScheme::MINMAXINTERVALMOVING).at(itCell->first);
+                    if (i < movingVector.size()) {
+                        vals.insert(i, itCell->second.at(i) - movingVector.at(i));
+                    }
+                }
+            }
+            p2d->addCurve(vals, QString("c=") + QString::number(itCell->first, 'f', 1), QwtPlotCurve::CurveStyle::Lines, QwtSymbol::Style::NoSymbol,
+                          plotColors().at(getNextValidColor(++m_colorIndex)), true);
+            vals.clear();
+        }
+        p2d->setAxisTitle(QwtPlot::Axis::xBottom, "n", QwtPlot::Axis::yLeft, QString("c") + QString("<sub>l</sub>"), QwtText::RichText);
+        p2d->setLegendAlignment(Qt::AlignTop|Qt::AlignRight);
+        QwtInterval xInterval = p2d->getPlot()->axisInterval(QwtPlot::Axis::xBottom);
+        //QwtAxisScaleDraw = p2d->getPlot()->axisScaleDraw(QwtPlot::Axis::xBottom);
+        p2d->setAxisTicks(QwtPlot::Axis::xBottom, xInterval.minValue(), xInterval.maxValue(),xInterval.maxValue() / 5.0, 0.0, 0.0, 0.0, true);
+        QwtInterval yInterval = p2d->getPlot()->axisInterval(QwtPlot::Axis::yLeft);
+        p2d->setAxisTicks(QwtPlot::Axis::yLeft, yInterval.minValue(), yInterval.maxValue(), yInterval.maxValue() / (yInterval.maxValue() / 4.0), 0.0, 0.0, 0.0, true);
+        p2d->enableGrid(true);
+        m_plots[title] = p2d;
+    }
+}
+
+void Evaluation::exportPlots(const QString &type) {
+    for (auto it = m_plots.begin(); it != m_plots.end(); it++) {
+        it->second->exportToFile(it->first, type);
+    }
+}
+
+/**
+ * @brief Evaluation::getNextValidColor returns the index for a color != white
+ * @param index
+ * @return
+ */
+unsigned int Evaluation::getNextValidColor(const unsigned int& index)  {
+    if (index >= plotColors().size()) {
+        m_colorIndex = 0;
+    }
+    else {
+        m_colorIndex = index;
+    }
+    return m_colorIndex;
+}
+
+QString Evaluation::getInlineSuperSubscriptStyle() {
+    QString css = "<style type=\"text/css\">";
+    css += ".supsub {position: absolute}";
+    css += ".subscript {color: black; display:block; position:relative; left:2px; top: -5px}";
+    css += ".superscript {color: black; display:block; position:relative; left:2px; top: -5px}";
+    css+="</style>";
+    return css;
+}
+
+/**
+ * @brief Evaluation::exportPlotInText exports the plots to a text file if they are needed e.g. in gnuplot
+ * @param fileName
+ * @param cols
+ */
+void Evaluation::exportPlotToText(const QString& fileName, const Plot2d *plot) {
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly| QIODevice::Text)) {
+         qDebug() << "cannot write to " << fileName;
+    }
+    else {
+        QTextStream outStream(&file);
+        if (plot) {
+            outStream << "Plot: " << plot->getTitle() << endl;
+            //write names
+            for (auto itCurves = plot->curves().begin(); itCurves != plot->curves().end(); itCurves++) {
+                outStream << itCurves.key() << QString("     ");
+            }
+            outStream << QChar::CarriageReturn;
+            //write data
+            for (auto itCurves = plot->curves().begin(); itCurves != plot->curves().end(); itCurves++) {
+                outStream << "curve: " << itCurves.key() << QChar::CarriageReturn;
+                outStream << itCurves.value()->data();
+            }
+        }
+    }
+}
@@ -5,20 +5,13 @@
 #include "pathcalculation.h"
 
 /**
- * @brief The FloydWarshallPathCalculation class
+ * @brief The FloydWarshallPathCalculation class takes the shortest paths from the all-pairs table of the intersection
+ * (InterSection::getShortestPathTable) and reserves the cells along the path
  */
-
-
-struct param{
-  double g;
-std::shared_ptr<InterSectionCell> parent;
-
-};
-
 class FloydWarshallPathCalculation : public PathCalculation
 {
 public:
-    FloydWarshallPathCalculation(const QString &car, const PathItem& start, const PathItem& target, const double& T);
+    FloydWarshallPathCalculation(const QString &car, const PathItem& start, const PathItem& target, const double& T, const std::weak_ptr<SimulationContext>& context = std::weak_ptr<SimulationContext>());
     FloydWarshallPathCalculation(const QString &car, const std::vector<double>& start, const std::vector<double>& target);
     PathAlgorithm getAlg() const;
     std::shared_ptr<SystemFunction> getSystemFunction() const;
@@ -26,7 +19,8 @@ public:
     PathItem optimize(const PathItem &start);
     std::vector<std::vector<double> > optimizeContinous(const std::vector<double> &controlVec, const double &t0, const double &T);
     double initializeCosts();
-    void setCurrentConstraints(const std::multimap<QString, Constraint> &constraints, const double& t0, const double& T);
+    void setCurrentConstraints(const std::vector<Constraint> &constraints, const double& t0, const double& T);
+    void setCurrentBoxConstraints(const std::vector<ConstraintBox> &constraints, const double& t0, const double& T);
     void createGlobalConstraints(const std::vector<double>& lb, const std::vector<double>& ub);
     void initializeDirectionalConstraints(const unsigned int &interSectionWidth, const unsigned int &interSectionHeight, const double &cellSize,
                                                   const double &t0, const int &N, const double &T, const double &dmin, const double &maxDynamics);
@@ -47,24 +41,15 @@ public:
 
 private:
 
- double estimateCost(const std::shared_ptr<InterSectionCell> &first, const std::shared_ptr<InterSectionCell> &second);
- void expandNode(const std::shared_ptr<InterSection>& grid, std::weak_ptr<InterSectionCell> &currentNode) ;
- void setG(const std::shared_ptr<InterSectionCell> &a , double value);
- void setParent(const std::shared_ptr<InterSectionCell> &a, const std::shared_ptr<InterSectionCell> &b);
- double getG(const std::shared_ptr<InterSectionCell> &a);
- std::shared_ptr<InterSectionCell> getParent(const std::shared_ptr<InterSectionCell> &a);
 QString m_car;
 PathItem m_start;
 PathItem m_target;
-QList<std::shared_ptr<InterSectionCell>> m_openList;
-QList<std::shared_ptr<InterSectionCell>> m_closedList;
 std::shared_ptr<SystemFunction> m_sysFunc;
 std::shared_ptr<InterSectionCell> m_startNode;
 std::shared_ptr<InterSectionCell> m_targetNode;
 Path m_path;
 int position=0;
 int a;
-QMap<std::shared_ptr<InterSectionCell> , param> m_map;
 
 };
 
@@ -0,0 +1,151 @@
+#include "gridsearchstate.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+const size_t GridSearchState::noCell = std::numeric_limits<size_t>::max();
+
+/**
+ * @brief GridSearchState::GridSearchState
+ */
+GridSearchState::GridSearchState()
+{
+}
+
+/**
+ * @brief GridSearchState::reset marks all cells as unvisited and empties the open list, the memory is kept for the next search
+ * @param numCells number of cells of the grid
+ */
+void GridSearchState::reset(const size_t& numCells) {
+    m_gCost.assign(numCells, std::numeric_limits<double>::max());
+    m_fCost.assign(numCells, std::numeric_limits<double>::max());
+    m_parent.assign(numCells, noCell);
+    m_state.assign(numCells, UNVISITED);
+    m_heap.clear();
+}
+
+/**
+ * @brief GridSearchState::size
+ * @return number of cells, 0 before the first reset
+ */
+size_t GridSearchState::size() const {
+    return m_state.size();
+}
+
+/**
+ * @brief GridSearchState::open inserts the cell into the open list or updates its costs
+ * @param cell
+ * @param gCost
+ * @param fCost key in the open list
+ * @param parent predecessor or noCell
+ */
+void GridSearchState::open(const size_t& cell, const double& gCost, const double& fCost, const size_t& parent) {
+    m_gCost[cell] = gCost;
+    m_fCost[cell] = fCost;
+    m_parent[cell] = parent;
+    m_state[cell] = OPEN;
+    m_heap.emplace_back(fCost, cell);
+    std::push_heap(m_heap.begin(), m_heap.end(), std::greater<std::pair<double, size_t> >());
+}
+
+/**
+ * @brief GridSearchState::close adds the cell to the closed list, its heap entries become outdated
+ * @param cell
+ */
+void GridSearchState::close(const size_t& cell) {
+    m_state[cell] = CLOSED;
+}
+
+/**
+ * @brief GridSearchState::popMin removes the cell with the lowest f-costs from the open list, the caller decides if it is closed
+ * @param cell the removed cell
+ * @return false, if the open list is empty
+ */
+bool GridSearchState::popMin(size_t& cell) {
+    if (!peekMin(cell)) {
+        return false;
+    }
+    std::pop_heap(m_heap.begin(), m_heap.end(), std::greater<std::pair<double, size_t> >());
+    m_heap.pop_back();
+    m_state[cell] = UNVISITED;
+    return true;
+}
+
+/**
+ * @brief GridSearchState::peekMin gives the cell with the lowest f-costs without removing it
+ * @param cell
+ * @return false, if the open list is empty
+ */
+bool GridSearchState::peekMin(size_t& cell) {
+    discardStaleEntries();
+    if (m_heap.empty()) {
+        return false;
+    }
+    cell = m_heap.front().second;
+    return true;
+}
+
+/**
+ * @brief GridSearchState::isOpen
+ * @param cell
+ * @return true, if the cell is in the open list
+ */
+bool GridSearchState::isOpen(const size_t& cell) const {
+    return m_state[cell] == OPEN;
+}
+
+/**
+ * @brief GridSearchState::isClosed
+ * @param cell
+ * @return true, if the cell is in the closed list
+ */
+bool GridSearchState::isClosed(const size_t& cell) const {
+    return m_state[cell] == CLOSED;
+}
+
+/**
+ * @brief GridSearchState::getGCost
+ * @param cell
+ * @return
+ */
+double GridSearchState::getGCost(const size_t& cell) const {
+    return m_gCost[cell];
+}
+
+/**
+ * @brief GridSearchState::getFCost
+ * @param cell
+ * @return
+ */
+double GridSearchState::getFCost(const size_t& cell) const {
+    return m_fCost[cell];
+}
+
+/**
+ * @brief GridSearchState::getParent
+ * @param cell
+ * @return predecessor or noCell
+ */
+size_t GridSearchState::getParent(const size_t& cell) const {
+    return m_parent[cell];
+}
+
+/**
+ * @brief GridSearchState::isStale
+ * @param entry
+ * @return true, if the cell has left the open list or was improved after the entry was pushed
+ */
+bool GridSearchState::isStale(const std::pair<double, size_t>& entry) const {
+    return m_state[entry.second] != OPEN || m_fCost[entry.second] != entry.first;
+}
+
+/**
+ * @brief GridSearchState::discardStaleEntries pops the outdated entries from the top of the heap
+ */
+void GridSearchState::discardStaleEntries() {
+    while (!m_heap.empty() && isStale(m_heap.front())) {
+        std::pop_heap(m_heap.begin(), m_heap.end(), std::greater<std::pair<double, size_t> >());
+        m_heap.pop_back();
+    }
+}
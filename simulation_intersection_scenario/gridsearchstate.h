@@ -0,0 +1,53 @@
+#ifndef GRIDSEARCHSTATE_H
+#define GRIDSEARCHSTATE_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief The GridSearchState class holds the scratch data of one graph search on the intersection grid (costs, parent and
+ * open/closed state) in flat arrays indexed by the cell index (InterSection::getCellIndex), so the search does not write into
+ * the shared InterSectionCell objects and several cars can search on the same grid.
+ * The open list is a binary heap ordered by the f-costs. Improving a cell pushes a new entry, the outdated entries are skipped
+ * when they reach the top (lazy deletion), so each operation costs O(log V) instead of sorting the open list.
+ */
+class GridSearchState
+{
+public:
+    ///parent of cells without predecessor
+    static const size_t noCell;
+
+    GridSearchState();
+    void reset(const size_t& numCells);
+    size_t size() const;
+    void open(const size_t& cell, const double& gCost, const double& fCost, const size_t& parent);
+    void close(const size_t& cell);
+    bool popMin(size_t& cell);
+    bool peekMin(size_t& cell);
+    bool isOpen(const size_t& cell) const;
+    bool isClosed(const size_t& cell) const;
+    double getGCost(const size_t& cell) const;
+    double getFCost(const size_t& cell) const;
+    size_t getParent(const size_t& cell) const;
+private:
+    enum NodeState : char {
+        UNVISITED = 0,
+        OPEN = 1,
+        CLOSED = 2
+    };
+    bool isStale(const std::pair<double, size_t>& entry) const;
+    void discardStaleEntries();
+    ///tentative costs from the start
+    std::vector<double> m_gCost;
+    ///estimated costs of the path through the cell
+    std::vector<double> m_fCost;
+    ///predecessor on the cheapest found path
+    std::vector<size_t> m_parent;
+    ///NodeState of each cell
+    std::vector<char> m_state;
+    ///min-heap of (f-costs, cell), may contain outdated entries
+    std::vector<std::pair<double, size_t> > m_heap;
+};
+
+#endif // GRIDSEARCHSTATE_H
@@ -0,0 +1,157 @@
+#ifndef INDEXEDMINHEAP_H
+#define INDEXEDMINHEAP_H
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief The IndexedMinHeap class is a binary min-heap over the IDs 0..n-1 (e.g. the cell indices of the grid), which
+ * knows the position of each ID in the heap. Therefore the key of an element can be changed (decrease and increase) and an
+ * element can be removed in O(log n), without outdated entries. Key has to provide operator<.
+ */
+template <typename Key>
+class IndexedMinHeap
+{
+public:
+    ///position of the IDs, which are not in the heap
+    static constexpr size_t notInHeap = std::numeric_limits<size_t>::max();
+
+    /**
+     * @brief reset empties the heap and allows the IDs 0..numIds-1
+     * @param numIds
+     */
+    void reset(const size_t& numIds) {
+        m_heap.clear();
+        m_position.assign(numIds, notInHeap);
+        m_keys.assign(numIds, Key());
+    }
+
+    bool empty() const {
+        return m_heap.empty();
+    }
+
+    size_t size() const {
+        return m_heap.size();
+    }
+
+    bool contains(const size_t& id) const {
+        return m_position[id] != notInHeap;
+    }
+
+    /**
+     * @brief top
+     * @return ID with the smallest key, the heap must not be empty
+     */
+    size_t top() const {
+        return m_heap.front();
+    }
+
+    const Key& topKey() const {
+        return m_keys[m_heap.front()];
+    }
+
+    /**
+     * @brief push inserts the ID or changes its key, if it is already in the heap
+     * @param id
+     * @param key
+     */
+    void push(const size_t& id, const Key& key) {
+        if (!contains(id)) {
+            m_keys[id] = key;
+            m_position[id] = m_heap.size();
+            m_heap.push_back(id);
+            siftUp(m_heap.size() - 1);
+        }
+        else if (key < m_keys[id]) {
+            m_keys[id] = key;
+            siftUp(m_position[id]);
+        }
+        else {
+            m_keys[id] = key;
+            siftDown(m_position[id]);
+        }
+    }
+
+    /**
+     * @brief pop removes the ID with the smallest key
+     */
+    void pop() {
+        //copy, the reference into m_heap changes while removing
+        const size_t id = m_heap.front();
+        remove(id);
+    }
+
+    /**
+     * @brief remove removes the ID, if it is in the heap
+     * @param id
+     */
+    void remove(const size_t& id) {
+        if (!contains(id)) {
+            return;
+        }
+        const size_t pos = m_position[id];
+        const size_t last = m_heap.size() - 1;
+        if (pos != last) {
+            swapEntries(pos, last);
+        }
+        m_heap.pop_back();
+        m_position[id] = notInHeap;
+        if (pos < m_heap.size()) {
+            //the moved element can go both directions
+            const size_t moved = m_heap[pos];
+            siftUp(pos);
+            siftDown(m_position[moved]);
+        }
+    }
+private:
+    void siftUp(size_t pos) {
+        while (pos > 0) {
+            const size_t parent = (pos - 1) / 2;
+            if (!(m_keys[m_heap[pos]] < m_keys[m_heap[parent]])) {
+                break;
+            }
+            swapEntries(pos, parent);
+            pos = parent;
+        }
+    }
+
+    void siftDown(size_t pos) {
+        const size_t n = m_heap.size();
+        while (true) {
+            const size_t left = 2 * pos + 1;
+            const size_t right = left + 1;
+            size_t smallest = pos;
+            if (left < n && m_keys[m_heap[left]] < m_keys[m_heap[smallest]]) {
+                smallest = left;
+            }
+            if (right < n && m_keys[m_heap[right]] < m_keys[m_heap[smallest]]) {
+                smallest = right;
+            }
+            if (smallest == pos) {
+                break;
+            }
+            swapEntries(pos, smallest);
+            pos = smallest;
+        }
+    }
+
+    void swapEntries(const size_t& a, const size_t& b) {
+        std::swap(m_heap[a], m_heap[b]);
+        m_position[m_heap[a]] = a;
+        m_position[m_heap[b]] = b;
+    }
+
+    ///IDs in heap order
+    std::vector<size_t> m_heap;
+    ///position of each ID in m_heap or notInHeap
+    std::vector<size_t> m_position;
+    ///current key of each ID
+    std::vector<Key> m_keys;
+};
+
+template <typename Key>
+constexpr size_t IndexedMinHeap<Key>::notInHeap;
+
+#endif // INDEXEDMINHEAP_H
@@ -0,0 +1,208 @@
+#include "integrator.h"
+#include "../simulation-core/vectorhelper.h"
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Integrator::~Integrator
+ */
+Integrator::~Integrator() {
+    //
+}
+
+/**
+ * @brief Integrator::create creates the integrator for the given type with its default settings
+ * @param type
+ * @return integrator
+ */
+std::shared_ptr<Integrator> Integrator::create(const IntegratorType& type) {
+    switch (type) {
+    case IntegratorType::EULER:
+        return std::make_shared<EulerIntegrator>();
+    case IntegratorType::RK4:
+        return std::make_shared<RK4Integrator>();
+    case IntegratorType::ADAPTIVE:
+        return std::make_shared<AdaptiveIntegrator>();
+    case IntegratorType::EXACT:
+    default:
+        return std::make_shared<ExactHolonomicIntegrator>();
+    }
+}
+
+/**
+ * @brief ExactHolonomicIntegrator::integrate returns \f$x_0 + (t_{End} - t_0)u\f$
+ * @param f not used
+ * @param x0 start value
+ * @param u constant control
+ * @param t0 start interval
+ * @param tEnd end interval
+ * @return x(tEnd)
+ */
+std::vector<double> ExactHolonomicIntegrator::integrate(const SystemDynamics& /*f*/, const std::vector<double>& x0, const std::vector<double>& u,
+                                                        const double& t0, const double& tEnd) const {
+    std::vector<double> x = x0;
+    const double h = tEnd - t0;
+    for (size_t j = 0; j < x.size(); j++) {
+        x[j] += h * u[j];
+    }
+    return x;
+}
+
+IntegratorType ExactHolonomicIntegrator::getType() const {
+    return IntegratorType::EXACT;
+}
+
+/**
+ * @brief EulerIntegrator::EulerIntegrator
+ * @param steps number of substeps
+ */
+EulerIntegrator::EulerIntegrator(const unsigned int& steps) :
+    m_steps(std::max(1u, steps))
+{
+
+}
+
+/**
+ * @brief EulerIntegrator::integrate integrates with explicit Euler, the substeps are counted to avoid drift of the time
+ * @param f dynamics
+ * @param x0 start value
+ * @param u constant control
+ * @param t0 start interval
+ * @param tEnd end interval
+ * @return x(tEnd)
+ */
+std::vector<double> EulerIntegrator::integrate(const SystemDynamics& f, const std::vector<double>& x0, const std::vector<double>& u,
+                                               const double& t0, const double& tEnd) const {
+    std::vector<double> x = x0;
+    const double h = (tEnd - t0) / (double)m_steps;
+    for (unsigned int i = 0; i < m_steps; i++) {
+        std::vector<double> dx = f(x, u, t0 + (double)i * h);
+        for (size_t j = 0; j < x.size(); j++) {
+            x[j] += h * dx[j];
+        }
+    }
+    return x;
+}
+
+IntegratorType EulerIntegrator::getType() const {
+    return IntegratorType::EULER;
+}
+
+/**
+ * @brief RK4Integrator::RK4Integrator
+ * @param steps number of substeps
+ */
+RK4Integrator::RK4Integrator(const unsigned int& steps) :
+    m_steps(std::max(1u, steps))
+{
+
+}
+
+/**
+ * @brief RK4Integrator::step one step of the classical Runge-Kutta-method, the intermediate states are formed in one reused
+ * stage vector and the weighted stages are accumulated in place into the result
+ * @param f dynamics
+ * @param x current state
+ * @param u constant control
+ * @param t current time
+ * @param h step size
+ * @return x(t+h)
+ */
+std::vector<double> RK4Integrator::step(const SystemDynamics& f, const std::vector<double>& x, const std::vector<double>& u,
+                                        const double& t, const double& h) {
+    const size_t n = x.size();
+    std::vector<double> xNext = x;
+    std::vector<double> stage = x;
+    std::vector<double> k = f(x, u, t);
+    VectorHelper::axpy(h / 6.0, k.data(), xNext.data(), n);
+    VectorHelper::axpy(h / 2.0, k.data(), stage.data(), n);
+    k = f(stage, u, t + h / 2.0);
+    VectorHelper::axpy(h / 3.0, k.data(), xNext.data(), n);
+    std::copy(x.begin(), x.end(), stage.begin());
+    VectorHelper::axpy(h / 2.0, k.data(), stage.data(), n);
+    k = f(stage, u, t + h / 2.0);
+    VectorHelper::axpy(h / 3.0, k.data(), xNext.data(), n);
+    std::copy(x.begin(), x.end(), stage.begin());
+    VectorHelper::axpy(h, k.data(), stage.data(), n);
+    k = f(stage, u, t + h);
+    VectorHelper::axpy(h / 6.0, k.data(), xNext.data(), n);
+    return xNext;
+}
+
+/**
+ * @brief RK4Integrator::integrate
+ * @param f dynamics
+ * @param x0 start value
+ * @param u constant control
+ * @param t0 start interval
+ * @param tEnd end interval
+ * @return x(tEnd)
+ */
+std::vector<double> RK4Integrator::integrate(const SystemDynamics& f, const std::vector<double>& x0, const std::vector<double>& u,
+                                             const double& t0, const double& tEnd) const {
+    std::vector<double> x = x0;
+    const double h = (tEnd - t0) / (double)m_steps;
+    for (unsigned int i = 0; i < m_steps; i++) {
+        x = step(f, x, u, t0 + (double)i * h, h);
+    }
+    return x;
+}
+
+IntegratorType RK4Integrator::getType() const {
+    return IntegratorType::RK4;
+}
+
+/**
+ * @brief AdaptiveIntegrator::AdaptiveIntegrator
+ * @param tolerance tolerance of the local error
+ * @param minStep minimum step size
+ */
+AdaptiveIntegrator::AdaptiveIntegrator(const double& tolerance, const double& minStep) :
+    m_tolerance(tolerance),
+    m_minStep(minStep)
+{
+
+}
+
+/**
+ * @brief AdaptiveIntegrator::integrate starts with the whole interval as step size and halves the step, if the estimated
+ * local error is bigger than the tolerance, a successful step lets the step size grow again
+ * @param f dynamics
+ * @param x0 start value
+ * @param u constant control
+ * @param t0 start interval
+ * @param tEnd end interval
+ * @return x(tEnd)
+ */
+std::vector<double> AdaptiveIntegrator::integrate(const SystemDynamics& f, const std::vector<double>& x0, const std::vector<double>& u,
+                                                  const double& t0, const double& tEnd) const {
+    std::vector<double> x = x0;
+    double t = t0;
+    double h = tEnd - t0;
+    while (tEnd - t > 0.0) {
+        h = std::min(h, tEnd - t);
+        std::vector<double> xFull = RK4Integrator::step(f, x, u, t, h);
+        std::vector<double> xHalf = RK4Integrator::step(f, x, u, t, h / 2.0);
+        xHalf = RK4Integrator::step(f, xHalf, u, t + h / 2.0, h / 2.0);
+        double error = VectorHelper::getInfinityDistance(xHalf.data(), xFull.data(), x.size());
+        if (error <= m_tolerance || h <= m_minStep) {
+            t += h;
+            //Richardson extrapolation of the two solutions of order 4
+            for (size_t j = 0; j < x.size(); j++) {
+                x[j] = xHalf[j] + (xHalf[j] - xFull[j]) / 15.0;
+            }
+            if (error < m_tolerance / 32.0) {
+                h *= 2.0;
+            }
+        }
+        else {
+            h /= 2.0;
+        }
+    }
+    return x;
+}
+
+IntegratorType AdaptiveIntegrator::getType() const {
+    return IntegratorType::ADAPTIVE;
+}
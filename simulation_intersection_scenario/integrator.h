@@ -0,0 +1,99 @@
+#ifndef INTEGRATOR_H
+#define INTEGRATOR_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief The IntegratorType enum selects the integration scheme of the system dynamics
+ */
+enum class IntegratorType {
+    EXACT = 0,
+    EULER = 1,
+    RK4 = 2,
+    ADAPTIVE = 3
+};
+
+/**
+ * @brief right hand side \f$\dot{x} = f(x,u,t)\f$ of the system dynamics
+ */
+using SystemDynamics = std::function<std::vector<double>(const std::vector<double>& x, const std::vector<double>& u, const double& t)>;
+
+/**
+ * @brief The Integrator class is the interface for integrating the system dynamics \f$\dot{x} = f(x,u,t)\f$
+ * with constant control u over the interval \f$[t_0, t_{End}]\f$
+ */
+class Integrator
+{
+public:
+    virtual ~Integrator();
+    virtual std::vector<double> integrate(const SystemDynamics& f, const std::vector<double>& x0, const std::vector<double>& u,
+                                          const double& t0, const double& tEnd) const = 0;
+    virtual IntegratorType getType() const = 0;
+    static std::shared_ptr<Integrator> create(const IntegratorType& type);
+};
+
+/**
+ * @brief The ExactHolonomicIntegrator class solves the holonomic model \f$\dot{x} = u\f$ in closed form:
+ * \f$x(t_{End}) = x_0 + (t_{End} - t_0)u\f$. The given dynamics f are ignored, so it must only be used for the holonomic model.
+ */
+class ExactHolonomicIntegrator : public Integrator
+{
+public:
+    std::vector<double> integrate(const SystemDynamics& f, const std::vector<double>& x0, const std::vector<double>& u,
+                                  const double& t0, const double& tEnd) const override;
+    IntegratorType getType() const override;
+};
+
+/**
+ * @brief The EulerIntegrator class integrates with the explicit Euler-method over a fixed number of substeps
+ */
+class EulerIntegrator : public Integrator
+{
+public:
+    EulerIntegrator(const unsigned int& steps = 100);
+    std::vector<double> integrate(const SystemDynamics& f, const std::vector<double>& x0, const std::vector<double>& u,
+                                  const double& t0, const double& tEnd) const override;
+    IntegratorType getType() const override;
+private:
+    ///number of substeps in the interval
+    unsigned int m_steps;
+};
+
+/**
+ * @brief The RK4Integrator class integrates with the classical Runge-Kutta-method of order 4 over a fixed number of substeps
+ */
+class RK4Integrator : public Integrator
+{
+public:
+    RK4Integrator(const unsigned int& steps = 1);
+    std::vector<double> integrate(const SystemDynamics& f, const std::vector<double>& x0, const std::vector<double>& u,
+                                  const double& t0, const double& tEnd) const override;
+    IntegratorType getType() const override;
+    static std::vector<double> step(const SystemDynamics& f, const std::vector<double>& x, const std::vector<double>& u,
+                                    const double& t, const double& h);
+private:
+    ///number of substeps in the interval
+    unsigned int m_steps;
+};
+
+/**
+ * @brief The AdaptiveIntegrator class integrates with RK4 and step size control by step doubling,
+ * the local error is estimated by comparing one step of size h with two steps of size h/2
+ */
+class AdaptiveIntegrator : public Integrator
+{
+public:
+    AdaptiveIntegrator(const double& tolerance = 1e-6, const double& minStep = 1e-6);
+    std::vector<double> integrate(const SystemDynamics& f, const std::vector<double>& x0, const std::vector<double>& u,
+                                  const double& t0, const double& tEnd) const override;
+    IntegratorType getType() const override;
+private:
+    ///tolerance of the local error in infinity norm
+    double m_tolerance;
+    ///smallest step size, which is accepted without error test
+    double m_minStep;
+};
+
+#endif // INTEGRATOR_H
@@ -1,7 +1,7 @@
 #include "intersection.h"
 #include "astarpathcalculation.h"
 
-#include <QtTest/QTest>
+#include <QtCore/QDebug>
 
 /**
  * @brief InterSection::InterSection constructs the intersection with the intersection grid
@@ -9,16 +9,17 @@
  * @param width of the grid
  * @param height of the grid
  * @param cellSize cellSize of one cell (only squared are allowed)
+ * @param T sampling time of the run, the cells reserve time slots of this width
  * @param alg path algorihm to choose (TODO)
  */
-InterSection::InterSection(const unsigned int &width, const unsigned int &height, const double cellSize) :
+InterSection::InterSection(const unsigned int &width, const unsigned int &height, const double cellSize, const double T) :
     m_width(width),
     m_height(height),
     m_gridSizeWidth(std::ceil((double)width / cellSize)),
     m_gridSizeHeight(std::ceil((double)height / cellSize)),
-    m_cellSize(cellSize)
+    m_cellSize(cellSize),
+    m_T(T)
 {
-    interSection = std::shared_ptr<InterSection>(this);
 }
 
 /**
@@ -28,89 +29,75 @@ InterSection::InterSection(const unsigned int &width, const unsigned int &height
  * @param cellSize (cellsize, have to be > 0
  */
 void InterSection::buildGrid(const unsigned int &width, const unsigned int &height, const double cellSize) {
-    if (m_gridMap) {
-        m_gridMap.reset();
-    }
+    m_grid.clear();
     m_cellSize = cellSize;
     Q_ASSERT_X(m_width > 0, typeid(this).name(), "width must > 0");
     Q_ASSERT_X(m_height > 0, typeid(this).name(), "height must > 0");
     Q_ASSERT_X(m_cellSize > 0, typeid(this).name(), "cellsize must > 0");
-    m_gridMap = std::make_shared<InterSectionGrid>();
     //if grid size varies, -x_min,x_max stays constant, so amount of grid cells varies
     m_gridSizeWidth = std::ceil((double)width / cellSize);
     m_gridSizeHeight = std::ceil((double)height / cellSize);
+    //the cells are stored in one allocation, the handles alias into it and keep it alive
+    m_cells = std::make_shared<std::vector<InterSectionCell> >();
+    m_cells->reserve(m_gridSizeWidth * m_gridSizeHeight);
     for (unsigned int i = 0; i < m_gridSizeWidth; i++) {
-        m_gridMap->insert(i, QHash<unsigned int, std::shared_ptr<InterSectionCell> >());
         for (unsigned int j = 0; j < m_gridSizeHeight; j++) {
-            m_gridMap->operator [](i).insert(j, std::make_shared<InterSectionCell>(i, j));
+            m_cells->emplace_back(i, j, m_T);
+        }
+    }
+    m_grid.reserve(m_cells->size());
+    for (InterSectionCell& cell : *m_cells) {
+        m_grid.push_back(std::shared_ptr<InterSectionCell>(m_cells, &cell));
+    }
+    //the neighbourhood with radius 1 is used by the most callers, the order is the same as for the general case
+    m_neighbourOffsets.clear();
+    for (int i = -1; i <= 1; i++) {
+        for (int j = -1; j <= 1; j++) {
+            m_neighbourOffsets.emplace_back(i, j);
         }
     }
+    //the shortest paths only depend on the dimensions of the grid
+    QMutexLocker locker(&m_shortestPathMutex);
+    if (m_shortestPaths && (m_shortestPaths->getGridWidth() != m_gridSizeWidth || m_shortestPaths->getGridHeight() != m_gridSizeHeight)) {
+        m_shortestPaths.reset();
+    }
+    locker.unlock();
+    QMutexLocker fieldLocker(&m_distanceFieldMutex);
+    if (!m_distanceFields.empty() && (m_distanceFields.begin()->second->getGridWidth() != m_gridSizeWidth
+                                      || m_distanceFields.begin()->second->getGridHeight() != m_gridSizeHeight)) {
+        m_distanceFields.clear();
+    }
 }
 
 /**
  * @brief getNeighbours get a map with references on the cells which are neighboured around the given cell
+ * the neighbourhood reaches from (x-1, y-1) to (x+radius, y+radius) and includes the cell itself, cells outside the grid are skipped
  * @param cell InterSectionCell which should be examined
  * @param radius max. distance to neighbours (Moore-Neighbourhood)
  * @return list with InterSectionCells surrounding given cell
  */
 QList<std::weak_ptr<InterSectionCell> > InterSection::getNeighbours(const std::weak_ptr<InterSectionCell>& cell, const unsigned int& radius) const {
     QList<std::weak_ptr<InterSectionCell> > neighbourMap;
-    if (!cell.expired()) {
-        std::shared_ptr<InterSectionCell> cellP(cell);
-        unsigned int x = cellP->getX();
-        unsigned int y = cellP->getY();
-        //Sonderfall: x||y == 0
-        if (x == 0 || y == 0) {
-            if (x == 0 && y == 0) {
-                for (unsigned int i = x; i <= x+radius; i++) { // i!=y+radius
-                    for (unsigned int j = y; j <= y+radius; j++) {// j!=x+radius
-                        if (m_gridMap->contains(i)) {
-                            QHash<unsigned int, std::shared_ptr<InterSectionCell> > row = m_gridMap->value(i);
-                            if (row.contains(j)){ //&& i == y && j == x) {
-                                neighbourMap.append(row.value(j));
-                            }//contains cell
-                        }//contains row
-                    }//col
-                }//row
-            }//x && y == 0
-            else if (x == 0) {
-                for (unsigned int i = x ; i <= x+radius; i++) {// same
-                    for (unsigned int j = y-1; j <= y+radius; j++) {// same
-                        if (m_gridMap->contains(i)) {
-                            QHash<unsigned int, std::shared_ptr<InterSectionCell> > row = m_gridMap->value(i);
-                            if (row.contains(j)) { //&& i == y && j == x) {
-                                neighbourMap.append(row.value(j));
-                            }//contains cell
-                        }//contains row
-                    }//col
-                }//row
-            } //x == 0
-            else if (y == 0) {
-                for (unsigned int i = x-1; i <= x+radius; i++) {// same
-                    for (unsigned int j = y; j <= y+radius; j++) {// same
-                        if (m_gridMap->contains(i)) {
-                            QHash<unsigned int, std::shared_ptr<InterSectionCell> > row = m_gridMap->value(i);
-                            if (row.contains(j)){ //&& i == y && j == x) {
-                                neighbourMap.append(row.value(j));
-                            }//contains cell
-                        }//contains row
-                    }//col
-                }//row
-            }//y==0
-        }//x || y == 0
+    std::shared_ptr<InterSectionCell> cellP = cell.lock();
+    if (cellP) {
+        int x = cellP->getX();
+        int y = cellP->getY();
+        if (radius == 1) {
+            for (const std::pair<int, int>& offset : m_neighbourOffsets) {
+                if (isInsideGrid(x + offset.first, y + offset.second)) {
+                    neighbourMap.append(m_grid[getCellIndex(x + offset.first, y + offset.second)]);
+                }
+            }
+        }
         else {
-            //first look, if row is included, then get the cell
-            for (unsigned int i = x - 1; i <= x+radius; i++) {// same
-                for (unsigned int j = y - 1; j <= y+radius; j++) { //same
-                    if (m_gridMap->contains(i)) {
-                        QHash<unsigned int, std::shared_ptr<InterSectionCell> > row = m_gridMap->value(i);
-                        if (row.contains(j)){// && i == y && j == x) {
-                            neighbourMap.append(row.value(j));
-                        }//contains cell
-                    }//contains row
-                }//col
-            }//row
-        }//normal case
+            for (int i = x - 1; i <= x + (int)radius; i++) {
+                for (int j = y - 1; j <= y + (int)radius; j++) {
+                    if (isInsideGrid(i, j)) {
+                        neighbourMap.append(m_grid[getCellIndex(i, j)]);
+                    }
+                }
+            }
+        }
     }
     return neighbourMap;
 }
@@ -231,13 +218,13 @@ QList<std::weak_ptr<InterSectionCell> > InterSection::getSuccessors(const std::w
 /**
  * @brief InterSection::reserveTimeForCar tries to reserve given time of car at intersection cell(k,m)
  * return false, if time cannot be reserved
- * @param car string of car
+ * @param car ID of the car
  * @param k x-coordinate
  * @param m y-coordinate
  * @param t time
  * @return true, if it is reserved, otherwise false
  */
-bool InterSection::reserveTimeForCar(const QString &car, const unsigned int& k, const unsigned int& m, const double& t) {
+bool InterSection::reserveTimeForCar(const CarId &car, const unsigned int& k, const unsigned int& m, const double& t) {
     bool reserved = false;
     std::shared_ptr<InterSectionCell> interSectionCell = getInterSectionCell(k, m);
     if (interSectionCell) {
@@ -253,7 +240,7 @@ bool InterSection::reserveTimeForCar(const QString &car, const unsigned int& k,
  * @param t time
  * @return true, if a next time can be reserved, otherwise false
  */
-double InterSection::reserveNextFreeTimeForCar(const QString& car, const unsigned int& k, const unsigned int& m, const double& t) {
+double InterSection::reserveNextFreeTimeForCar(const CarId& car, const unsigned int& k, const unsigned int& m, const double& t) {
     std::shared_ptr<InterSectionCell> interSectionCell = getInterSectionCell(k, m);
     double reservedTime = -1;
     if (interSectionCell) {
@@ -270,7 +257,7 @@ double InterSection::reserveNextFreeTimeForCar(const QString& car, const unsigne
  * @param t time that should be reserved
  * @return time that is reserved, if no time available, -1.0 is returned
  */
-double InterSection::tryReserveTimeForCar(const QString &car, const unsigned int& k, const unsigned int& m, const double& t) {
+double InterSection::tryReserveTimeForCar(const CarId &car, const unsigned int& k, const unsigned int& m, const double& t) {
     double reservedTime = -1.0;
     std::shared_ptr<InterSectionCell> interSectionCell = getInterSectionCell(k, m);
     if (interSectionCell) {
@@ -296,7 +283,7 @@ double InterSection::tryReserveTimeForCar(const QString &car, const unsigned int
  * @param t time
  * @return
  */
-double InterSection::tryReservePrelimTimeForCar(const QString &car, const unsigned int& k, const unsigned int& m, const double& t) {
+double InterSection::tryReservePrelimTimeForCar(const CarId &car, const unsigned int& k, const unsigned int& m, const double& t) {
     double reservedTime = -1;
     std::shared_ptr<InterSectionCell> interSectionCell = getInterSectionCell(k, m);
     if (interSectionCell) {
@@ -358,78 +345,107 @@ double InterSection::getPossiblePrelimReserveTimeForCar(const unsigned int& k, c
  * @param car
  * @return
  */
-bool InterSection::isTimeAlreadyReserved(std::shared_ptr<InterSectionCell> cell, const QString& car, const double& time) const {
+bool InterSection::isTimeAlreadyReserved(std::shared_ptr<InterSectionCell> cell, const CarId& car, const double& time) const {
     //Q_ASSERT_X(cell == NULL)
     return cell->isTimeAlreadyReserved(car, time);
 }
 
 /**
  * @brief InterSection::getGrid
- * @return
+ * @return all cells of the grid in row-major order
  */
-std::shared_ptr<InterSectionGrid> InterSection::getGrid() const {
-    return m_gridMap;
+const InterSectionGrid& InterSection::getGrid() const {
+    return m_grid;
 }
 
 /**
- * @brief InterSection::getInstance
- * @return
+ * @brief InterSection::getShortestPathTable gives the shortest paths between all cells, the table is computed on the first call
+ * and shared by all cars until buildGrid changes the dimensions of the grid
+ * @return read-only table, indexed by getCellIndex
+ */
+std::shared_ptr<const ShortestPathTable> InterSection::getShortestPathTable() const {
+    QMutexLocker locker(&m_shortestPathMutex);
+    if (!m_shortestPaths) {
+        m_shortestPaths = std::make_shared<const ShortestPathTable>(m_gridSizeWidth, m_gridSizeHeight);
+    }
+    return m_shortestPaths;
+}
+
+/**
+ * @brief InterSection::getDistanceField gives the distances of all cells to the target, the field is computed on the first
+ * request for this target and shared by all cars until buildGrid changes the dimensions of the grid
+ * @param targetIndex cell index of the target (getCellIndex)
+ * @return read-only field, indexed by getCellIndex
  */
-std::shared_ptr<InterSection> InterSection::getInstance() {
-    if (interSection == nullptr) {
-        //TODO: hier noch variable Parameter festlegen
-        interSection = std::make_shared<InterSection>(4, 4, 1.0);
+std::shared_ptr<const DistanceField> InterSection::getDistanceField(const size_t& targetIndex) const {
+    QMutexLocker locker(&m_distanceFieldMutex);
+    std::shared_ptr<const DistanceField>& field = m_distanceFields[targetIndex];
+    if (!field) {
+        field = std::make_shared<const DistanceField>(m_gridSizeWidth, m_gridSizeHeight, targetIndex);
     }
-    return interSection;
+    return field;
+}
+
+/**
+ * @brief InterSection::isInsideGrid
+ * @param k width
+ * @param m height
+ * @return true, if the grid is built and contains the cell (k,m)
+ */
+bool InterSection::isInsideGrid(const int& k, const int& m) const {
+    return !m_grid.empty() && k >= 0 && m >= 0 && (unsigned int)k < m_gridSizeWidth && (unsigned int)m < m_gridSizeHeight;
+}
+
+/**
+ * @brief InterSection::getCellIndex
+ * @param k width
+ * @param m height
+ * @return index of the cell (k,m) in the grid, (k,m) has to be inside the grid
+ */
+size_t InterSection::getCellIndex(const unsigned int& k, const unsigned int& m) const {
+    return (size_t)k * m_gridSizeHeight + m;
+}
+
+/**
+ * @brief InterSection::getCellHandle returns a non-owning pointer to the cell (k,m), which is valid as long as the grid is not rebuilt
+ * @param k width
+ * @param m height
+ * @return cell or nullptr, if (k,m) is outside the grid
+ */
+InterSectionCell* InterSection::getCellHandle(const unsigned int& k, const unsigned int& m) const {
+    return isInsideGrid(k, m) ? &(*m_cells)[getCellIndex(k, m)] : nullptr;
+}
+
+/**
+ * @brief InterSection::getCellHandleFromCoordinates returns a non-owning pointer to the cell, which contains the point (x1, x2)
+ * @param x1
+ * @param x2
+ * @return cell or nullptr, if the point is outside the grid
+ */
+InterSectionCell* InterSection::getCellHandleFromCoordinates(const double& x1, const double& x2) const {
+    int w = std::floor(x1 / m_cellSize);
+    int h = std::floor(x2 / m_cellSize);
+    return isInsideGrid(w, h) ? &(*m_cells)[getCellIndex(w, h)] : nullptr;
 }
 
 /**
  * @brief InterSection::getInterSectionCell returns the according intersection cell with (k,m)
- * if cellsize > 1, it will be mapped by k/c and m/c
  * @param k width
  * @param m height
- * @return
+ * @return cell or nullptr, if (k,m) is outside the grid
  */
 std::shared_ptr<InterSectionCell> InterSection::getInterSectionCell(const unsigned int& k, const unsigned int& m) {
-    //TODO: Q_ASSERT_X - falls Zelle nicht vorhanden
-    std::shared_ptr<InterSectionCell> cell = nullptr;
-    //gridsize bigger, less cells available
-    /*if (m_gridSizeWidth < m_width|| m_gridSizeHeight < m_height) {
-        unsigned int kReduced = std::ceil((double)k / m_cellSize);
-        unsigned int mReduced = std::ceil((double)m / m_cellSize);
-        if (getGrid() && getGrid()->contains(kReduced) && getGrid()->operator [](kReduced).contains(mReduced)) {
-            cell = getGrid()->operator[](kReduced).operator[](mReduced);
-        }
-    //}
-    //else */
-    if (getGrid() && getGrid()->contains(k) && getGrid()->operator [](k).contains(m)) {
-        cell = getGrid()->operator[](k).operator[](m);
-    }
-    return cell;
+    return isInsideGrid(k, m) ? m_grid[getCellIndex(k, m)] : nullptr;
 }
 
 /**
  * @brief InterSection::getInterSectionCell const version of InterSection::getInterSectionCell
- * if cellsize > 1, it will be mapped by k/c and m/c
  * @param k width
  * @param m height
- * @return
+ * @return cell or nullptr, if (k,m) is outside the grid
  */
 std::shared_ptr<InterSectionCell> InterSection::getInterSectionCell(const unsigned int& k, const unsigned int& m) const {
-    //TODO: Q_ASSERT_X - falls celle nicht vorhanden
-    std::shared_ptr<InterSectionCell> cell = nullptr;
-    /*if (m_gridSizeWidth < m_width|| m_gridSizeHeight < m_height) {
-        unsigned int kReduced = std::ceil((double)k / m_cellSize);
-        unsigned int mReduced = std::ceil((double)m / m_cellSize);
-        if (getGrid() && getGrid()->contains(kReduced) && getGrid()->operator[] (kReduced).contains(mReduced)) {
-            cell = getGrid()->operator[](kReduced).operator[](mReduced);
-        }
-    }*/
-    //else
-    if (getGrid() && getGrid()->contains(k) && getGrid()->operator [](k).contains(m)) {
-        cell = getGrid()->operator[](k).operator[](m);
-    }
-    return cell;
+    return isInsideGrid(k, m) ? m_grid[getCellIndex(k, m)] : nullptr;
 }
 
 /**
@@ -469,7 +485,7 @@ unsigned int InterSection::getGridWidth() const {
  * @param car
  * @param path
  */
-void InterSection::clearPrelimPathOfCar(const QString& car, const Path& path) {
+void InterSection::clearPrelimPathOfCar(const CarId& car, const Path& path) {
     for (const PathItem& pathItem : path) {
         std::shared_ptr<InterSectionCell> cell = getInterSectionCell(pathItem.getX(), pathItem.getY());
         if (cell) {
@@ -508,16 +524,16 @@ void InterSection::printReservations() const {
         for (unsigned int m = 0; m < m_height; m++) {
             std::cout << "Cell: " << k << ", " << m << std::endl;
             std::shared_ptr<InterSectionCell> cell = getInterSectionCell(k, m);
-            const QVector<ReservationCell>& reservQueue = cell->getReservationCells();
+            const QVector<ReservationCell> reservQueue = cell->getReservationCells();
             std::cout << "reserved: " << std::endl;
             for (const ReservationCell& resCell: reservQueue) {
-                std::cout << "(" << resCell.getCar().toStdString() << ", " << resCell.getTime() << "), ";
+                std::cout << "(" << resCell.getCar() << ", " << resCell.getTime() << "), ";
             }
             std::cout << std::endl;
-            const QVector<ReservationCell>& prelimQueue = cell->getPrelimReservationCells();
+            const QVector<ReservationCell> prelimQueue = cell->getPrelimReservationCells();
             std::cout << "prelim.: " << std::endl;
             for (const ReservationCell& preCell : prelimQueue) {
-                std::cout << "(" << preCell.getCar().toStdString() << ", " << preCell.getTime() << "), ";
+                std::cout << "(" << preCell.getCar() << ", " << preCell.getTime() << "), ";
             }
             std::cout << std::endl;
         }
@@ -534,7 +550,7 @@ void InterSection::printReservations() const {
 std::shared_ptr<InterSectionCell> InterSection::getCellFromCoordinates(const std::vector<double> &x) {
     int w = std::floor(x.at(0) / getCellSize());
     int h = std::floor(x.at(1) / getCellSize());
-    return getInterSectionCell(w, h);
+    return isInsideGrid(w, h) ? m_grid[getCellIndex(w, h)] : nullptr;
 }
 
 /**
@@ -1,17 +1,24 @@
 #ifndef INTERSECTION_H
 #define INTERSECTION_H
+#include <map>
 #include <memory>
+#include <utility>
+#include <vector>
+#include <QtCore/QMutex>
 #include "../simulation-core/simulationresource.h"
 #include "intersectioncell.h"
+#include "shortestpathtable.h"
+#include "distancefield.h"
 #include "pathcalculation.h"
 #include "arrivalcar.h"
+#include "intersectionparameters.h"
 
 //@TODO: structure for modeling obstacles and real costs and if a cell is reserved
 //for this the intersection has to give back a free time slot
-using InterSectionGrid = QHash<unsigned int,QHash<unsigned int, std::shared_ptr<InterSectionCell> > >;
-//typedef QHash<unsigned int,QHash<unsigned int, std::shared_ptr<InterSectionCell> > > InterSectionGrid;
+///dense grid of handles to the cells, row-major with index k * gridHeight + m. The handles share the ownership
+///of the cell array, so a cell stays valid as long as a handle is kept, even if the grid is rebuilt
+using InterSectionGrid = std::vector<std::shared_ptr<InterSectionCell> >;
 
-static std::shared_ptr<InterSection> interSection;
 /**
  * @brief The InterSection class holds the complete set for the intersection including a grid which represents each cell
  * Furthermore the class gives several methods to examine the grid and also reserve time slots or to check if time slots are
@@ -20,24 +27,29 @@ static std::shared_ptr<InterSection> interSection;
 class InterSection : public SimulationResource
 {
 public:
-    InterSection(const unsigned int &width, const unsigned int &height, const double cellSize = 1.0);
+    InterSection(const unsigned int &width, const unsigned int &height, const double cellSize = 1.0, const double T = InterSectionParameters::T);
     void buildGrid(const unsigned int &width, const unsigned int &height, const double cellSize);
     PathCalculation* getPathCalculation();
     QList<std::weak_ptr<InterSectionCell> > getNeighbours(const std::weak_ptr<InterSectionCell> &cell, const unsigned int& radius) const;
     bool isNeighboured(const std::weak_ptr<InterSectionCell>& first, const std::weak_ptr<InterSectionCell>& second) const;
-    std::shared_ptr<InterSectionGrid> getGrid() const;
+    const InterSectionGrid& getGrid() const;
+    std::shared_ptr<const ShortestPathTable> getShortestPathTable() const;
+    std::shared_ptr<const DistanceField> getDistanceField(const size_t& targetIndex) const;
+    bool isInsideGrid(const int& k, const int& m) const;
+    size_t getCellIndex(const unsigned int& k, const unsigned int& m) const;
+    InterSectionCell* getCellHandle(const unsigned int& k, const unsigned int& m) const;
+    InterSectionCell* getCellHandleFromCoordinates(const double& x1, const double& x2) const;
     QList<std::weak_ptr<InterSectionCell> > getSuccessors(const std::weak_ptr<InterSectionCell>& start, const std::weak_ptr<InterSectionCell>& target) const;
-    bool reserveTimeForCar(const QString &car, const unsigned int& k, const unsigned int& m, const double& t);
-    double reserveNextFreeTimeForCar(const QString &car, const unsigned int& k, const unsigned int& m, const double& t);
+    bool reserveTimeForCar(const CarId &car, const unsigned int& k, const unsigned int& m, const double& t);
+    double reserveNextFreeTimeForCar(const CarId &car, const unsigned int& k, const unsigned int& m, const double& t);
     double getPossibleReserveTimeForCar(const unsigned int& k, const unsigned int& m, const double& t) const;
     double getPossiblePrelimReserveTimeForCar(const unsigned int& k, const unsigned int& m, const double& t) const;
-    static std::shared_ptr<InterSection> getInstance();
-    double tryReserveTimeForCar(const QString &car, const unsigned int& k, const unsigned int& m, const double& t);
-    double tryReservePrelimTimeForCar(const QString &car, const unsigned int& k, const unsigned int& m, const double& t);
+    double tryReserveTimeForCar(const CarId &car, const unsigned int& k, const unsigned int& m, const double& t);
+    double tryReservePrelimTimeForCar(const CarId &car, const unsigned int& k, const unsigned int& m, const double& t);
     std::shared_ptr<InterSectionCell> getInterSectionCell(const unsigned int& k, const unsigned int& m);
     std::shared_ptr<InterSectionCell> getInterSectionCell(const unsigned int& k, const unsigned int& m) const;
-    bool isTimeAlreadyReserved(std::shared_ptr<InterSectionCell> cell, const QString& car, const double& time) const;
-    void clearPrelimPathOfCar(const QString& car, const Path& path);
+    bool isTimeAlreadyReserved(std::shared_ptr<InterSectionCell> cell, const CarId& car, const double& time) const;
+    void clearPrelimPathOfCar(const CarId& car, const Path& path);
     void copyCurrentPositionsToPreliminaries();
     unsigned int getHeight() const;
     unsigned int getWidth() const;
@@ -53,8 +65,20 @@ public:
     unsigned int numberEntryPoints() const;
     unsigned int getAmountOfCarsForNextTime(const unsigned int& entryPoint);
 private:
-    ///Hash-Table which contains all Intersection-Cells in a 2D-grid
-    std::shared_ptr<InterSectionGrid> m_gridMap;
+    ///all Intersection-Cells of the 2D-grid by value in one contiguous array (row-major), empty if no grid is built
+    std::shared_ptr<std::vector<InterSectionCell> > m_cells;
+    ///shared handles into m_cells for the planners, same order
+    InterSectionGrid m_grid;
+    ///offsets (dk, dm) of the neighbourhood with radius 1, precomputed for getNeighbours
+    std::vector<std::pair<int, int> > m_neighbourOffsets;
+    ///shortest paths between all cells, built on the first request and kept as long as the grid dimensions stay the same
+    mutable std::shared_ptr<const ShortestPathTable> m_shortestPaths;
+    ///guards the construction of m_shortestPaths
+    mutable QMutex m_shortestPathMutex;
+    ///distance fields by the cell index of their target, each built on the first request for the target
+    mutable std::map<size_t, std::shared_ptr<const DistanceField> > m_distanceFields;
+    ///guards m_distanceFields
+    mutable QMutex m_distanceFieldMutex;
     ///holds a map of enumerated entry points in the intersection, standardized, all beginning of lanes are entry points
     std::map<unsigned int, std::shared_ptr<InterSectionCell> > m_entryPoints;
     ///width of the gridMap
@@ -67,6 +91,8 @@ private:
     unsigned int m_gridSizeHeight;
     //@TODO: add additional parameter for cell size
     double m_cellSize;
+    ///sampling time of the run, width of the time slots in the reservation tables of the cells
+    double m_T;
     ///stochastic process for each entry point in the intersection
     std::vector<ArrivalCar> m_enterInterSectDist;
 
@@ -7,7 +7,6 @@
 
 #include <QtCore/QFile>
 #include <QtCore/QTime>
-#include <QtTest/QTest>
 #include <QtCore/QTextStream>
 #include <QtCore/QStringBuilder>
 
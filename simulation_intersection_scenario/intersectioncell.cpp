@@ -1,17 +1,16 @@
 #include "intersectioncell.h"
 
-#include "intersectionparameters.h"
-
 /**
  * @brief InterSectionCell::InterSectionCell
  * @param x position horizontal
  * @param y position vertical
+ * @param T sampling time of the run, width of the time slots of the reservation tables
  */
-InterSectionCell::InterSectionCell(const unsigned int &x, const unsigned int &y) :
+InterSectionCell::InterSectionCell(const unsigned int &x, const unsigned int &y, const double &T) :
+    m_reserved(T),
+    m_prelimReserved(T),
     m_x(x),
-    m_y(y),
-    tentativeGCost(0.0),
-    fCost(0.0)
+    m_y(y)
     //rhs(5000.0),
     //g(5000.0),
     //key(100.0)
@@ -25,33 +24,16 @@ InterSectionCell::InterSectionCell(const unsigned int &x, const unsigned int &y)
  * @return
  */
 bool InterSectionCell::isTimeReserved(const double &time) const {
-    QVector<ReservationCell>::const_iterator it = m_reserved.begin();
-    while (it != m_reserved.end()) {
-        if ((*it).getTime() == time) {
-            return true;
-            break;
-        }
-        it++;
-    }
-    return false;
+    return m_reserved.isReserved(time);
 }
 
 /**
  * @brief InterSectionCell::getTimeForCar
- * @param car string of the car
+ * @param car ID of the car
  * @return
  */
-double InterSectionCell::getTimeForCar(const QString& car, const double &t) const {
-    QVector<ReservationCell>::const_iterator it = m_reserved.begin();
-    double time = -1.0;
-    while (it != m_reserved.end()) {
-        if ((*it).getCar() == car && (*it).getTime() >= t) {
-            time = (*it).getTime();
-            break;
-        }
-        it++;
-    }
-    return time;
+double InterSectionCell::getTimeForCar(const CarId& car, const double &t) const {
+    return m_reserved.getTimeForCar(car, t);
 }
 
 /**
@@ -59,17 +41,8 @@ double InterSectionCell::getTimeForCar(const QString& car, const double &t) cons
  * @param car
  * @return
  */
-double InterSectionCell::getPrelimTimeForCar(const QString& car, const double& t) const {
-    QVector<ReservationCell>::const_iterator it = m_prelimReserved.begin();
-    double time = -1;
-    while (it != m_prelimReserved.end()) {
-        if ((*it).getCar() == car && (*it).getTime() >= t) {
-            time = (*it).getTime();
-            break;
-        }
-        it++;
-    }
-    return time;
+double InterSectionCell::getPrelimTimeForCar(const CarId& car, const double& t) const {
+    return m_prelimReserved.getTimeForCar(car, t);
 }
 
 /**
@@ -79,15 +52,26 @@ double InterSectionCell::getPrelimTimeForCar(const QString& car, const double& t
  * @return true, if time slot is free, otherwise false
  */
 bool InterSectionCell::isPrelimTimeReserved(const double &time) const {
-    QVector<ReservationCell>::const_iterator it = m_prelimReserved.begin();
-    while (it != m_prelimReserved.end()) {
-        if ((*it).getTime() == time) {
-            return true;
-            break;
-        }
-        it++;
-    }
-    return false;
+    return m_prelimReserved.isReserved(time);
+}
+
+/**
+ * @brief InterSectionCell::isPrelimTimeReservedByOtherCar looks up, if the cell is preliminary reserved by another car at the given time
+ * @param car own car, its reservations are ignored
+ * @param time
+ * @return true, if another car has reserved the time slot
+ */
+bool InterSectionCell::isPrelimTimeReservedByOtherCar(const CarId &car, const double &time) const {
+    return m_prelimReserved.isReservedByOtherCar(car, time);
+}
+
+/**
+ * @brief InterSectionCell::getPrelimCarForTime
+ * @param time
+ * @return car, which has preliminary reserved the cell at the given time, noCarId if it is free
+ */
+CarId InterSectionCell::getPrelimCarForTime(const double &time) const {
+    return m_prelimReserved.getCar(time);
 }
 
 /**
@@ -96,17 +80,8 @@ bool InterSectionCell::isPrelimTimeReserved(const double &time) const {
  * @param time reserved time greaterequal than this (lower bound
  * @return
  */
-bool InterSectionCell::isTimeAlreadyReserved(const QString& car, const double &time) const {
-    QVector<ReservationCell>::const_iterator it = m_reserved.begin();
-    bool found = false;
-    while (it != m_reserved.end()) {
-        if ((*it).getCar() == car && (*it).getTime() >= time) {
-            found = true;
-            break;
-        }
-        it++;
-    }
-    return found;
+bool InterSectionCell::isTimeAlreadyReserved(const CarId& car, const double &time) const {
+    return m_reserved.hasReservationFrom(car, time);
 }
 
 /**
@@ -115,17 +90,8 @@ bool InterSectionCell::isTimeAlreadyReserved(const QString& car, const double &t
  * @param time lower bound
  * @return true, if a prelim. time which is greater than given time is found, otherwise false
  */
-bool InterSectionCell::isPrelimTimeAlreadyReserved(const QString& car, const double& time) const {
-    QVector<ReservationCell>::const_iterator it = m_prelimReserved.begin();
-    bool found = false;
-    while (it != m_prelimReserved.end()) {
-        if ((*it).getCar() == car && (*it).getTime() >= time) {
-            found = true;
-            break;
-        }
-        it++;
-    }
-    return found;
+bool InterSectionCell::isPrelimTimeAlreadyReserved(const CarId& car, const double& time) const {
+    return m_prelimReserved.hasReservationFrom(car, time);
 }
 
 /**
@@ -134,51 +100,26 @@ bool InterSectionCell::isPrelimTimeAlreadyReserved(const QString& car, const dou
  * @param time given time, which should be reserved
  * @return true, if time is reserved, false, if time is already reserved
  */
-bool InterSectionCell::reserveTimeForCar(const QString &car, const double &time) {
-    QVector<ReservationCell>::const_iterator it = m_reserved.begin();
-    while (it != m_reserved.end()) {
-        if ((*it).getTime() == time) {
-            return false;
-            break;
-        }
-        it++;
-    }
-    m_reserved.append(ReservationCell(car, time));
-    return true;
+bool InterSectionCell::reserveTimeForCar(const CarId &car, const double &time) {
+    return m_reserved.reserve(car, time);
 }
 
 /**
- * @brief removeCar
+ * @brief removeCar removes the earliest reservation of the car
  * @param car
  * @return true, if car was found and is removed, otherwise false
  */
-bool InterSectionCell::removeCar(const QString &car) {
-    QVector<ReservationCell>::const_iterator it = m_reserved.begin();
-    bool removed = false;
-    unsigned int count = 0;
-    while (it != m_reserved.end()) {
-        if ((*it).getCar() == car) {
-            m_reserved.removeAt(count);
-            removed = true;
-            break;
-        }
-        it++;
-        count++;
-    }
-    return removed;
+bool InterSectionCell::removeCar(const CarId &car) {
+    return m_reserved.removeFirst(car);
 }
 
 /**
- * @brief InterSectionCell::getNextFreeTime
+ * @brief InterSectionCell::getNextFreeTime skips the reserved time slots in the occupancy bitmap
  * @param start
  * @return
  */
 double InterSectionCell::getNextFreeTime(const double &start) const {
-    double firstFreeTime = start;
-    while (isTimeReserved(firstFreeTime)) {
-        firstFreeTime += InterSectionParameters::T;
-    }
-    return firstFreeTime;
+    return m_reserved.getNextFreeTime(start);
 }
 
 /**
@@ -187,11 +128,7 @@ double InterSectionCell::getNextFreeTime(const double &start) const {
  * @return
  */
 double InterSectionCell::getNextFreePrelimTime(const double &start) const {
-    double firstFreeTime = start;
-    while (isPrelimTimeReserved(firstFreeTime)) {
-        firstFreeTime += InterSectionParameters::T;
-    }
-    return firstFreeTime;
+    return m_prelimReserved.getNextFreeTime(start);
 }
 
 /**
@@ -216,7 +153,7 @@ double InterSectionCell::getY() const {
  * @param time
  * @return
  */
-double InterSectionCell::reserveNextFreeTimeForCar(const QString& car, const double &time) {
+double InterSectionCell::reserveNextFreeTimeForCar(const CarId& car, const double &time) {
     double firstFreeTime = getNextFreeTime(time);
     if (firstFreeTime != -1.0) {
         reserveTimeForCar(car, firstFreeTime);
@@ -230,17 +167,8 @@ double InterSectionCell::reserveNextFreeTimeForCar(const QString& car, const dou
  * @param time
  * @return
  */
-bool InterSectionCell::reservePremlimNextTime(const QString& car, const double& time) {
-    QVector<ReservationCell>::const_iterator it = m_prelimReserved.begin();
-    while (it != m_prelimReserved.end()) {
-       if ((*it).getTime() == time) {
-           return false;
-           break;
-       }
-       it++;
-    }
-    m_prelimReserved.append(ReservationCell(car, time));
-    return true;
+bool InterSectionCell::reservePremlimNextTime(const CarId& car, const double& time) {
+    return m_prelimReserved.reserve(car, time);
 }
 
 /**
@@ -258,18 +186,8 @@ bool InterSectionCell::operator==(const std::shared_ptr<InterSectionCell> compCe
 }
 
 
-void InterSectionCell::removePrelimPathFromCar(const QString& car) {
-    QVector<ReservationCell>::iterator it = m_prelimReserved.begin();
-    while (it != m_prelimReserved.end()) {
-        if ((*it).getCar() == car) {
-            ReservationCell& carDel = (*it);
-            int index = m_prelimReserved.indexOf(carDel);
-            m_prelimReserved.remove(index);
-        }
-        else {
-            it++;
-        }
-    }
+void InterSectionCell::removePrelimPathFromCar(const CarId& car) {
+    m_prelimReserved.removeCar(car);
 }
 
 /**
@@ -277,11 +195,7 @@ void InterSectionCell::removePrelimPathFromCar(const QString& car) {
  * @return amount of copied items
  */
 unsigned int InterSectionCell::replacePrelimWithReservedPositions() {
-    m_prelimReserved.clear();
-    m_prelimReserved.reserve(m_reserved.size());
-    for (ReservationCell& reserve : m_reserved) {
-        m_prelimReserved.push_back(reserve);
-    }
+    m_prelimReserved = m_reserved;
     return m_prelimReserved.size();
 }
 
@@ -297,46 +211,16 @@ unsigned int InterSectionCell::getNumOfReservations()
  * @brief InterSectionCell::getReservationCells get the reservation queue
  * @return reservation queue
  */
-const QVector<ReservationCell>& InterSectionCell::getReservationCells() const {
-    return m_reserved;
+QVector<ReservationCell> InterSectionCell::getReservationCells() const {
+    return m_reserved.getReservationCells();
 }
 
 /**
  * @brief InterSectionCell::getPrelimReservationCells get the prelimiated reservation queue
  * @return prelimination queue
  */
-const QVector<ReservationCell> &InterSectionCell::getPrelimReservationCells() const {
-    return m_prelimReserved;
-}
-
-double InterSectionCell::getTentativeGCost() const
-{
-    return tentativeGCost;
-}
-
-void InterSectionCell::setTentativeGCost(double value)
-{
-    tentativeGCost = value;
-}
-
-double InterSectionCell::getFCost() const
-{
-    return fCost;
-}
-
-void InterSectionCell::setFCost(double value)
-{
-    fCost = value;
-}
-
-std::weak_ptr<InterSectionCell> InterSectionCell::getParent() const
-{
-    return parent;
-}
-
-void InterSectionCell::setParent(const std::weak_ptr<InterSectionCell> &value)
-{
-    parent = value;
+QVector<ReservationCell> InterSectionCell::getPrelimReservationCells() const {
+    return m_prelimReserved.getReservationCells();
 }
 
 /*double InterSectionCell::getRhs() const
@@ -1,7 +1,7 @@
         #ifndef INTERSECTIONCELL_H
     #define INTERSECTIONCELL_H
     #include <QtCore/QVector>
-    #include <reservationcell.h>
+    #include "reservationtable.h"
     #include <memory>
 
     /**
@@ -11,20 +11,22 @@
     class InterSectionCell
     {
     public:
-        InterSectionCell(const unsigned int &x, const unsigned int &y);
+        InterSectionCell(const unsigned int &x, const unsigned int &y, const double& T);
         bool isTimeReserved(const double &time) const;
         bool isPrelimTimeReserved(const double &time) const;
-        bool reserveTimeForCar(const QString &car, const double &time);
-        double reserveNextFreeTimeForCar(const QString& car, const double &time);
-        bool removeCar(const QString &car);
+        bool isPrelimTimeReservedByOtherCar(const CarId &car, const double &time) const;
+        CarId getPrelimCarForTime(const double &time) const;
+        bool reserveTimeForCar(const CarId &car, const double &time);
+        double reserveNextFreeTimeForCar(const CarId& car, const double &time);
+        bool removeCar(const CarId &car);
         double getNextFreeTime(const double& start = 0.0) const;
         double getNextFreePrelimTime(const double &start = 0.0) const;
-        bool reservePremlimNextTime(const QString& car, const double& time);
-        bool isTimeAlreadyReserved(const QString& car, const double& time) const;
-        bool isPrelimTimeAlreadyReserved(const QString& car, const double& time) const;
-        double getTimeForCar(const QString& car, const double& t) const;
-        double getPrelimTimeForCar(const QString& car, const double& t) const;
-        void removePrelimPathFromCar(const QString& car);
+        bool reservePremlimNextTime(const CarId& car, const double& time);
+        bool isTimeAlreadyReserved(const CarId& car, const double& time) const;
+        bool isPrelimTimeAlreadyReserved(const CarId& car, const double& time) const;
+        double getTimeForCar(const CarId& car, const double& t) const;
+        double getPrelimTimeForCar(const CarId& car, const double& t) const;
+        void removePrelimPathFromCar(const CarId& car);
         bool operator==(const std::shared_ptr<InterSectionCell> compCell) const;
         //bool operator<(const std::shared_ptr<InterSectionCell> compCell) const;
         unsigned int replacePrelimWithReservedPositions();
@@ -32,19 +34,11 @@
 
         double getX() const;
         double getY() const;
-        const QVector<ReservationCell> &getReservationCells() const;
-        const QVector<ReservationCell>& getPrelimReservationCells() const;
+        QVector<ReservationCell> getReservationCells() const;
+        QVector<ReservationCell> getPrelimReservationCells() const;
 
 
 
-        double getTentativeGCost() const;
-        void setTentativeGCost(double value);
-
-        double getFCost() const;
-        void setFCost(double value);
-
-        std::weak_ptr<InterSectionCell> getParent() const;
-        void setParent(const std::weak_ptr<InterSectionCell> &value);
         //bool compare (const std::shared_ptr<InterSectionCell> left, const std::shared_ptr<InterSectionCell> right)const;
 
 
@@ -67,17 +61,14 @@
         void setKey(double value);*/
 
     private:
-        ///the time vector which holds the reserved time for the cell
-        QVector<ReservationCell> m_reserved;
+        ///reservation table indexed by time slot which holds the reserved time for the cell
+        ReservationTable m_reserved;
         ///preliminary reserved time
-        QVector<ReservationCell> m_prelimReserved;
+        ReservationTable m_prelimReserved;
         ///index for x
         unsigned int m_x;
         ///index for y
         unsigned int m_y;
-        double tentativeGCost; // astar
-        double fCost; //astar
-        std::weak_ptr<InterSectionCell> parent; //astar
 
         //double rhs; //dstar
         //double g; //dstar
@@ -18,3 +18,12 @@ constexpr unsigned int InterSectionParameters::varyCellSize;
 constexpr double InterSectionParameters::robotDiameter;
 constexpr unsigned int InterSectionParameters::intersectionalScenario;
 constexpr unsigned int InterSectionParameters::stochasticArrival;
+constexpr IntegratorType InterSectionParameters::integratorType;
+constexpr OptimizationAlgorithm InterSectionParameters::optimizationAlgorithm;
+constexpr unsigned int InterSectionParameters::ocpWorkerThreads;
+constexpr RunMode InterSectionParameters::runMode;
+constexpr unsigned int InterSectionParameters::constraintPruning;
+constexpr unsigned int InterSectionParameters::aggregateIntervalConstraints;
+constexpr unsigned int InterSectionParameters::maxConflictRounds;
+constexpr double InterSectionParameters::constraintSmoothing;
+constexpr unsigned int InterSectionParameters::terminalCosts;
@@ -1,6 +1,8 @@
 #ifndef INTERSECTIONPARAMETERS_H
 #define INTERSECTIONPARAMETERS_H
 
+#include "integrator.h"
+
 #include <cstddef>
 
 /**
@@ -32,6 +34,26 @@ enum class SpacialSet {
     CONTINUOUS = 2
 };
 
+/**
+ * @brief The OptimizationAlgorithm enum selects the NLopt algorithm for the continuous OCP, COBYLA is derivative-free,
+ * SLSQP, MMA and CCSAQ use the analytic gradients of the cost function and the constraints
+ */
+enum class OptimizationAlgorithm {
+    COBYLA = 0,
+    SLSQP = 1,
+    MMA = 2,
+    CCSAQ = 3
+};
+
+/**
+ * @brief The RunMode enum describes, whether the simulation steps are paced by the frame timer of the GUI (real time)
+ * or the simulation runs as fast as possible (e.g. for experiments without visualization)
+ */
+enum class RunMode {
+    REALTIME = 0,
+    FASTFORWARD = 1
+};
+
 class InterSectionParameters {
 public:
 static constexpr unsigned int maxCars = 4;
@@ -52,6 +74,15 @@ static constexpr unsigned int varyCellSize = 1;
 static constexpr double robotDiameter = 0.5;
 static constexpr unsigned int intersectionalScenario = 0;
 static constexpr unsigned int stochasticArrival = 0;
+static constexpr IntegratorType integratorType = IntegratorType::EXACT;
+static constexpr OptimizationAlgorithm optimizationAlgorithm = OptimizationAlgorithm::COBYLA;
+static constexpr unsigned int ocpWorkerThreads = 1;
+static constexpr RunMode runMode = RunMode::REALTIME;
+static constexpr unsigned int constraintPruning = 1;
+static constexpr unsigned int aggregateIntervalConstraints = 1;
+static constexpr unsigned int maxConflictRounds = 5;
+static constexpr double constraintSmoothing = 20.0;
+static constexpr unsigned int terminalCosts = 1;
 };
 
 #endif // INTERSECTIONPARAMETERS_H
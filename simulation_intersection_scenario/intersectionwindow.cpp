@@ -45,7 +45,8 @@ IntersectionWindow::IntersectionWindow(int k, int m, int maxCars, int N, double
     m_showMinRadius(false),
     m_showConstraintMargin(false),
     m_rwLockOccupiedCellHash(QReadWriteLock::NonRecursive),
-    m_priorityCriteria(PriorityCriteria::FIXED)
+    m_priorityCriteria(PriorityCriteria::FIXED),
+    m_runMode(InterSectionParameters::runMode)
 {
     m_colors.append(QColor(174, 63, 63));
     m_colors.append(QColor(226, 192, 149));
@@ -281,6 +282,7 @@ void IntersectionWindow::removeCarfromGUI(const QString &key, const int &row)
  */
 void IntersectionWindow::finished()
 {
+    m_frameTimer.stop();
     title->setPlainText(QString("FINISHED!"));
     carSelectBox->clear();
 }
@@ -431,6 +433,23 @@ void IntersectionWindow::showConstraintMarginGUI(int changed) {
     }
 }
 
+/**
+ * @brief IntersectionWindow::fastForwardGUIChanged if checked, the simulation runs as fast as possible,
+ * otherwise each step is paced by the frame timer
+ * @param changed
+ */
+void IntersectionWindow::fastForwardGUIChanged(int changed) {
+    if (changed == Qt::CheckState::Checked) {
+        m_runMode = RunMode::FASTFORWARD;
+    }
+    else if (changed == Qt::CheckState::Unchecked) {
+        m_runMode = RunMode::REALTIME;
+    }
+    if (thread) {
+        thread->setRunMode(m_runMode);
+    }
+}
+
 /**
  * @brief IntersectionWindow::setPriorityCriteria changes the criteria to the chosen entry from the Combobox
  * @param priority
@@ -582,6 +601,15 @@ void IntersectionWindow::setup()
     showConstraintMarginCheckBox->setObjectName("showConstraintMarginCheckBox");
     verticalLayout->addWidget(showConstraintMarginCheckBox);
 
+    //run the simulation as fast as possible instead of pacing it by the frame timer
+    fastForwardLabel = new QLabel(layoutWidget);
+    fastForwardLabel->setObjectName("fastForwardLabel");
+    verticalLayout->addWidget(fastForwardLabel);
+    fastForwardCheckBox = new QCheckBox(layoutWidget);
+    fastForwardCheckBox->setObjectName("fastForwardCheckBox");
+    verticalLayout->addWidget(fastForwardCheckBox);
+    fastForwardCheckBox->setCheckState(m_runMode == RunMode::FASTFORWARD ? Qt::CheckState::Checked : Qt::CheckState::Unchecked);
+
     //priority criteria
     priorityLabel = new QLabel(layoutWidget);
     priorityLabel->setObjectName("priorityLabel");
@@ -650,6 +678,7 @@ void IntersectionWindow::setup()
     connect(showPredictionCheckBox, SIGNAL(stateChanged(int)), this, SLOT(showPredictionGUI(int)));
     connect(showConstraintMarginCheckBox, SIGNAL(stateChanged(int)), this, SLOT(showConstraintMarginGUI(int)));
     connect(priorityComboBox, SIGNAL(currentIndexChanged(QString)), this, SLOT(setPriorityCriteria(QString)));
+    connect(fastForwardCheckBox, SIGNAL(stateChanged(int)), this, SLOT(fastForwardGUIChanged(int)));
 }
 
 /** @brief Private function to initialize widgets
@@ -673,6 +702,7 @@ void IntersectionWindow::retranslateUi()
     radiusLabel->setText(QApplication::translate("IntersectionWindow", "car radius:", 0));
     showPredictionLabel->setText(QApplication::translate("IntersectionWindow", "predictions", 0));
     showConstraintMarginLabel->setText(QApplication::translate("IntersectionWindow", "constraint margins", 0));
+    fastForwardLabel->setText(QApplication::translate("IntersectionWindow", "fast forward", 0));
 }
 
 /** @brief Draws the intersection and starts simulation thread
@@ -719,6 +749,11 @@ void IntersectionWindow::start()
     }*/
 
 
+    //the frame timer must not keep ticking a previous simulation
+    m_frameTimer.stop();
+    if (thread) {
+        disconnect(&m_frameTimer, SIGNAL(timeout()), thread, SLOT(frameTick()));
+    }
     CommunicationScheme commScheme = CommunicationScheme::CONTINUOUS;
     thread = new SimulationThread(width, height, maxCars, N, m_T, lambda, {-1.0, 1.0}, {0.5, 0.5}, this, InterSectionParameters::robotDiameter, m_priorityCriteria, commScheme,PathAlgorithm::MPCCOBYLA);
     if (commScheme == CommunicationScheme::FULL || commScheme == CommunicationScheme::DIFFERENTIAL
@@ -751,6 +786,12 @@ void IntersectionWindow::start()
     connect(this, SIGNAL(pause()), thread, SLOT(pause()));
     connect(this, SIGNAL(resume()), thread, SLOT(resume()));
 
+    //the frame timer releases one simulation step per sampling time in real time mode
+    thread->setRunMode(m_runMode);
+    m_frameTimer.setInterval(static_cast<int>(m_T * 1000.0));
+    connect(&m_frameTimer, SIGNAL(timeout()), thread, SLOT(frameTick()));
+    m_frameTimer.start();
+
     thread->startSimulation();
     //m_recVideo.start(100);
 }
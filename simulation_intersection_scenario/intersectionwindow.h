@@ -37,6 +37,7 @@
 #include <QtCore/QTextStream>
 #include <QtWidgets/QGridLayout>
 #include <QtCore/QPointer>
+#include <QtCore/QTimer>
 
 #include <iostream>
 #include <vector>
@@ -92,6 +93,7 @@ public slots:
     void carMinRadiusGUIChanged(int changed);
     void showPredictionGUI(int changed);
     void showConstraintMarginGUI(int changed);
+    void fastForwardGUIChanged(int changed);
 
 private:
     unsigned int getNextValidColor(const unsigned int& index);
@@ -122,6 +124,10 @@ private:
     ///serves for locking the occupied cell map. This should be read-locked, if a car is
     ///still removing its old prediction and tries to insert a new one
     QReadWriteLock m_rwLockOccupiedCellHash;
+    ///real time or fast forward simulation
+    RunMode m_runMode;
+    ///frame timer, which paces the simulation thread in real time mode (one step per sampling time)
+    QTimer m_frameTimer;
 
     //Window Widgets
     QWidget *centralwidget;
@@ -152,6 +158,8 @@ private:
     QCheckBox* showPredictionCheckBox;
     QLabel* showConstraintMarginLabel;
     QCheckBox* showConstraintMarginCheckBox;
+    QLabel* fastForwardLabel;
+    QCheckBox* fastForwardCheckBox;
     QMenuBar *menubar;
     QStatusBar *statusbar;
     QGraphicsTextItem* title;
@@ -6,10 +6,9 @@
 #include "../simulation-core/vectorhelper.h"
 #include <QtCore/QDebug>
 
+#include <algorithm>
 #include <utility>
 
-double MpcController::m_lowerAcceptenceBound = 0.0;
-double MpcController::m_reoptimizeBound = 0.0;
 /**
  * @brief MpcController::MpcController
  * @param car
@@ -17,8 +16,10 @@ double MpcController::m_reoptimizeBound = 0.0;
  * @param target
  * @param lambda
  * @param T sampling interval
+ * @param context simulation, the car belongs to
  */
-MpcController::MpcController(const QString& car, const PathItem& start, const PathItem& target, const size_t &N, const double &lambda, const std::pair<double, double>& bounds) :
+MpcController::MpcController(const QString& car, const PathItem& start, const PathItem& target, const size_t &N, const double &lambda, const std::pair<double, double>& bounds,
+                             const std::weak_ptr<SimulationContext>& context) :
     m_car(car),
     m_n(N),
     m_target(target),
@@ -26,18 +27,18 @@ MpcController::MpcController(const QString& car, const PathItem& start, const Pa
     m_actualFunctionValue(0.0),
     m_openLoopCosts(0.0),
     m_closedLoopCosts(0.0),
+    m_lowerAcceptenceBound(0.0),
+    m_reoptimizeBound(0.0),
     m_controlLowerBound(bounds.first),
     m_controlUpperBound(bounds.second),
-    m_boundInitSteps(true)
+    m_boundInitSteps(true),
+    m_optAlgorithm(InterSectionParameters::optimizationAlgorithm)
 {
-    m_systemFunc = std::make_shared<SystemFunction>(car, Path(start));
+    m_systemFunc = std::make_shared<SystemFunction>(car, Path(start), context);
     m_systemFunc->setIntervalControlDynamic({m_controlLowerBound, m_controlUpperBound});
-    if (m_lowerAcceptenceBound == 0.0) {
-        m_lowerAcceptenceBound = calcLowerAcceptanceBound();
-    }
-    if (m_reoptimizeBound == 0.0) {
-        m_reoptimizeBound = calcReoptimizeBound();
-    }
+    //the bounds depend on the grid of this simulation and on lambda, so each controller calculates its own
+    m_lowerAcceptenceBound = calcLowerAcceptanceBound();
+    m_reoptimizeBound = calcReoptimizeBound();
 }
 
 /**
@@ -46,8 +47,10 @@ MpcController::MpcController(const QString& car, const PathItem& start, const Pa
  * @param start
  * @param target
  * @param lambda
+ * @param context simulation, the car belongs to
  */
-MpcController::MpcController(const QString &car, const std::vector<double>& start, const std::vector<double>& target, const size_t &N, const double& lambda, const std::pair<double, double> &bounds) :
+MpcController::MpcController(const QString &car, const std::vector<double>& start, const std::vector<double>& target, const size_t &N, const double& lambda, const std::pair<double, double> &bounds,
+                             const std::weak_ptr<SimulationContext>& context) :
     m_car(car),
     m_n(N),
     m_target(PathItem()),
@@ -55,12 +58,15 @@ MpcController::MpcController(const QString &car, const std::vector<double>& star
     m_actualFunctionValue(0.0),
     m_openLoopCosts(0.0),
     m_closedLoopCosts(0.0),
+    m_lowerAcceptenceBound(0.0),
+    m_reoptimizeBound(0.0),
     m_targetCont(target),
     m_controlLowerBound(bounds.first),
     m_controlUpperBound(bounds.second),
-    m_boundInitSteps(true)
+    m_boundInitSteps(true),
+    m_optAlgorithm(InterSectionParameters::optimizationAlgorithm)
 {
-    m_systemFunc = std::make_shared<SystemFunction>(car, start);
+    m_systemFunc = std::make_shared<SystemFunction>(car, start, context);
     m_systemFunc->setIntervalControlDynamic({m_controlLowerBound, m_controlUpperBound});
 }
 
@@ -100,17 +106,17 @@ void MpcController::calcConstraintsFromPath() {
         //left- to rightside
         if (m_target.getY() <= 1) {
             //lowerBound = 0, 0, 0;
-            //upperBound = InterSection::getInstance()->getWidth(), (InterSection::getInstance()->getHeight() - 1) / 2, DBL_MAX;
+            //upperBound = m_systemFunc->getInterSection()->getWidth(), (m_systemFunc->getInterSection()->getHeight() - 1) / 2, DBL_MAX;
             //NLOpt: 0 to 4*4 = 16/2-1 = 7
-            m_constraint = Constraint(0, InterSection::getInstance()->getWidth() * InterSection::getInstance()->getHeight() / 2 - 1, m_n);
+            m_constraint = Constraint(0, m_systemFunc->getInterSection()->getWidth() * m_systemFunc->getInterSection()->getHeight() / 2 - 1, m_n);
         }
         //right- to leftside
         else if (m_target.getY() > 1) {
-            //lowerBound = 0, (InterSection::getInstance()->getHeight()) / 2, 0;
-            //upperBound = InterSection::getInstance()->getWidth(), InterSection::getInstance()->getHeight(), DBL_MAX;
+            //lowerBound = 0, (m_systemFunc->getInterSection()->getHeight()) / 2, 0;
+            //upperBound = m_systemFunc->getInterSection()->getWidth(), m_systemFunc->getInterSection()->getHeight(), DBL_MAX;
             //NLOpt: 4*4=16/2 = 8 to 15 = 4*4-1
-            m_constraint = Constraint(InterSection::getInstance()->getWidth() * InterSection::getInstance()->getHeight() / 2,
-                                      InterSection::getInstance()->getWidth() * InterSection::getInstance()->getHeight() - 1, m_n);
+            m_constraint = Constraint(m_systemFunc->getInterSection()->getWidth() * m_systemFunc->getInterSection()->getHeight() / 2,
+                                      m_systemFunc->getInterSection()->getWidth() * m_systemFunc->getInterSection()->getHeight() - 1, m_n);
         }
     }
     //vertical
@@ -118,13 +124,13 @@ void MpcController::calcConstraintsFromPath() {
         //up- to downside
         if (m_target.getX() <= 1) {
             //lowerBound = 0, 0, 0;
-            //upperBound = (InterSection::getInstance()->getWidth() - 1) / 2, InterSection::getInstance()->getHeight(), DBL_MAX;
+            //upperBound = (m_systemFunc->getInterSection()->getWidth() - 1) / 2, m_systemFunc->getInterSection()->getHeight(), DBL_MAX;
             //NLOpt
             //0,1, 4, 5, 8, 9, ...
             std::vector<double> controlValues;
-            for (unsigned int i = 0; i < InterSection::getInstance()->getWidth() * InterSection::getInstance()->getHeight(); i++) {
+            for (unsigned int i = 0; i < m_systemFunc->getInterSection()->getWidth() * m_systemFunc->getInterSection()->getHeight(); i++) {
                 //left side (0, 1, 4, 5)
-                if (i % InterSection::getInstance()->getWidth() < InterSection::getInstance()->getWidth() / 2) {
+                if (i % m_systemFunc->getInterSection()->getWidth() < m_systemFunc->getInterSection()->getWidth() / 2) {
                     controlValues.push_back(i);
                 }
             }
@@ -132,14 +138,14 @@ void MpcController::calcConstraintsFromPath() {
         }
         //down- to upside
         else if (m_target.getX() > 1) {
-            //lowerBound = InterSection::getInstance()->getWidth() / 2, 0, 0;
-            //upperBound = InterSection::getInstance()->getWidth(), InterSection::getInstance()->getHeight(), DBL_MAX;
+            //lowerBound = m_systemFunc->getInterSection()->getWidth() / 2, 0, 0;
+            //upperBound = m_systemFunc->getInterSection()->getWidth(), m_systemFunc->getInterSection()->getHeight(), DBL_MAX;
             //NlOpt
 
             std::vector<double> controlValues;
-            for (unsigned int i = 0; i < InterSection::getInstance()->getWidth() * InterSection::getInstance()->getHeight(); i++) {
+            for (unsigned int i = 0; i < m_systemFunc->getInterSection()->getWidth() * m_systemFunc->getInterSection()->getHeight(); i++) {
                 //left side (0, 1, 4, 5)
-                if (i % InterSection::getInstance()->getWidth() >= InterSection::getInstance()->getWidth() / 2) {
+                if (i % m_systemFunc->getInterSection()->getWidth() >= m_systemFunc->getInterSection()->getWidth() / 2) {
                     controlValues.push_back(i);
                 }
             }
@@ -193,7 +199,7 @@ PathItem MpcController::optimize(const PathItem& start) {
 
 
     std::vector<double> upperBound(m_n);
-    std::shared_ptr<InterSection> interSect = InterSection::getInstance();
+    std::shared_ptr<InterSection> interSect = m_systemFunc->getInterSection();
     double maxValue = interSect->getHeight() * interSect->getWidth() - 1;
     std::fill(upperBound.begin(), upperBound.end(), maxValue);
     optObject.set_upper_bounds(upperBound);
@@ -245,18 +251,38 @@ PathItem MpcController::optimize(const PathItem& start) {
  * @return
  */
 std::vector<std::vector<double> > MpcController::optimizeContinous(const std::vector<double>& controlVec, const double &t0, const double &T) {
-
-    //nlopt::opt continObject(nlopt::LD_LBFGS, controlVec.size());
-    nlopt::opt continObject(nlopt::LN_COBYLA, controlVec.size());
-    //continObject.set_lower_bounds(-1.0);
-    //continObject.set_upper_bounds(1.0);
-    continObject.set_lower_bounds(m_controlLowerBound);
-    continObject.set_upper_bounds(m_controlUpperBound);
-
-    //continObject.set_ftol_rel(0.00001);
-    continObject.set_ftol_abs(0.1);
-    continObject.set_xtol_rel(0.001);
-    continObject.set_maxeval(10000);
+    std::vector<double> optVec = controlVec;
+    //getting stuck
+    if (VectorHelper::norm2(optVec) < 0.5 && t0 > 10.0) {
+        for (auto i = 0; i < optVec.size(); ++i) {
+                optVec[i] = 0.0;
+        }
+        for (auto i = 0; i < std::ceil(optVec.size() / 2); ++i) {
+            if (VectorHelper::norm2(VectorHelper::sub(m_systemFunc->getCurrentContinuousState(), m_globalConstraintsMin.at(0).getCenterPoint()))
+                    > VectorHelper::norm2(VectorHelper::sub(m_systemFunc->getCurrentContinuousState(), m_globalConstraintsMax.at(0).getCenterPoint())) ) {
+                std::cout << "adapt reverse pattern: " << m_car.toLatin1().data() << ", t : " << t0 << std::endl;
+                if (i % 2 == 0) {
+                    optVec[i] = -1.0;
+                }
+                else {
+                    optVec[i] = 0.0;
+                }
+            }
+            else {
+                std::cout << "adapt forward pattern: " << m_car.toLatin1().data() << ", t : " << t0 << std::endl;
+                if (i % 2 == 0) {
+                    optVec[i] = 1.0;
+                }
+                else {
+                    optVec[i] = 0.0;
+                }
+            }
+        }
+        //the pattern is far from the shifted solution, so start cold with the default step
+        m_solverContext.invalidate();
+    }
+    //the optimizer is kept across the steps, it is only rebuilt if the algorithm, the dimension or the bounds change
+    nlopt::opt& continObject = m_solverContext.getOptimizer(getNloptAlgorithm(), controlVec.size(), m_controlLowerBound, m_controlUpperBound);
 
     /*if (m_constraints.size() > 1) {
         std::cout << "current constraint radius: " << m_constraints.at(0).getCurrentGridSize() << std::endl;
@@ -278,23 +304,52 @@ std::vector<std::vector<double> > MpcController::optimizeContinous(const std::ve
     if (InterSectionParameters::intersectionalScenario == 1)  {
         updateDirectionalConstraints(getSystemFunction(), t0, T, m_n);
     }
-    //insert the constraints from previous vehicles
+    //the constraints are evaluated through their objects, so they only have to be registered again if the objects have changed
+    std::vector<const void*> constraintObjects;
+    constraintObjects.reserve(m_constraints.size() + m_constraintsBox.size() + m_globalConstraintsMin.size() + m_globalConstraintsMax.size() + m_constraintsDirec.size());
+    //only the gradient-based algorithms need the smoothed max-norm, the others keep the exact constraints
+    const bool smoothConstraints = isGradientBased();
     for (Constraint& constraint : m_constraints) {
-        continObject.add_inequality_constraint(Constraint::wrapConstraintObject, &constraint);
-        //DEBUG
-        //qDebug() << "Constraint: (" << constraint.getCenterPoint().at(0) << "," << constraint.getCenterPoint().at(1) << ")";
-        //--DEBUG
+        constraint.setSmoothed(smoothConstraints);
+        constraintObjects.push_back(&constraint);
     }
-    //insert global constraints
-    //first minimum constriants
-    for (unsigned int i = 0; i < m_globalConstraintsMin.size(); i++) {
-        continObject.add_inequality_constraint(ConstraintMin::wrapConstraintObject, &m_globalConstraintsMin.at(i));
+    for (const ConstraintBox& constraint : m_constraintsBox) {
+        constraintObjects.push_back(&constraint);
     }
-    for (unsigned int i = 0; i < m_globalConstraintsMax.size(); i++) {
-        continObject.add_inequality_constraint(ConstraintMax::wrapConstraintObject, &m_globalConstraintsMax.at(i));
+    for (const ConstraintMin& constraint : m_globalConstraintsMin) {
+        constraintObjects.push_back(&constraint);
+    }
+    for (const ConstraintMax& constraint : m_globalConstraintsMax) {
+        constraintObjects.push_back(&constraint);
+    }
+    for (const ConstraintDirectional& constraint : m_constraintsDirec) {
+        constraintObjects.push_back(&constraint);
     }
-    for (unsigned int i = 0; i < m_constraintsDirec.size(); i++) {
-        continObject.add_inequality_constraint(ConstraintDirectional::wrapConstraintObject, &m_constraintsDirec.at(i));
+    if (m_solverContext.needsConstraintUpdate(constraintObjects)) {
+        continObject.remove_inequality_constraints();
+        //insert the constraints from previous vehicles
+        for (Constraint& constraint : m_constraints) {
+            continObject.add_inequality_constraint(Constraint::wrapConstraintObject, &constraint);
+            //DEBUG
+            //qDebug() << "Constraint: (" << constraint.getCenterPoint().at(0) << "," << constraint.getCenterPoint().at(1) << ")";
+            //--DEBUG
+        }
+        //one vector-valued constraint over all steps for each interval of the previous vehicles
+        for (ConstraintBox& constraint : m_constraintsBox) {
+            continObject.add_inequality_mconstraint(ConstraintBox::wrapConstraintObject, &constraint, std::vector<double>(constraint.getDimension(), 0.0));
+        }
+        //insert global constraints
+        //first minimum constriants
+        for (unsigned int i = 0; i < m_globalConstraintsMin.size(); i++) {
+            continObject.add_inequality_constraint(ConstraintMin::wrapConstraintObject, &m_globalConstraintsMin.at(i));
+        }
+        for (unsigned int i = 0; i < m_globalConstraintsMax.size(); i++) {
+            continObject.add_inequality_constraint(ConstraintMax::wrapConstraintObject, &m_globalConstraintsMax.at(i));
+        }
+        for (unsigned int i = 0; i < m_constraintsDirec.size(); i++) {
+            continObject.add_inequality_constraint(ConstraintDirectional::wrapConstraintObject, &m_constraintsDirec.at(i));
+        }
+        m_solverContext.setConstraints(constraintObjects);
     }
     CostFunction costFunction(m_systemFunc->getCurrentContinuousState(), m_targetCont, t0, T, m_n, m_lambda, m_systemFunc);
     continObject.set_min_objective(CostFunction::wrapCostFunctionObject, &costFunction);
@@ -303,40 +358,18 @@ std::vector<std::vector<double> > MpcController::optimizeContinous(const std::ve
         //continObject.set_initial_step({0.0, m_controlLowerBound});
         continObject.set_initial_step(m_controlLowerBound);
     }*/
-    std::vector<double> optVec = controlVec;
-    //getting stuck
-    if (VectorHelper::norm2(optVec) < 0.5 && t0 > 10.0) {
-        for (auto i = 0; i < optVec.size(); ++i) {
-                optVec[i] = 0.0;
-        }
-        for (auto i = 0; i < std::ceil(optVec.size() / 2); ++i) {
-            if (VectorHelper::norm2(VectorHelper::sub(m_systemFunc->getCurrentContinuousState(), m_globalConstraintsMin.at(0).getCenterPoint()))
-                    > VectorHelper::norm2(VectorHelper::sub(m_systemFunc->getCurrentContinuousState(), m_globalConstraintsMax.at(0).getCenterPoint())) ) {
-                std::cout << "adapt reverse pattern: " << m_car.toLatin1().data() << ", t : " << t0 << std::endl;
-                if (i % 2 == 0) {
-                    optVec[i] = -1.0;
-                }
-                else {
-                    optVec[i] = 0.0;
-                }
-            }
-            else {
-                std::cout << "adapt forward pattern: " << m_car.toLatin1().data() << ", t : " << t0 << std::endl;
-                if (i % 2 == 0) {
-                    optVec[i] = 1.0;
-                }
-                else {
-                    optVec[i] = 0.0;
-                }
-            }
-        }
+    if (m_solverContext.hasWarmStart()) {
+        //the shifted problem is close to the last one, start with the step the last solution needed
+        continObject.set_initial_step(m_solverContext.getInitialStep());
     }
+    const std::vector<double> startVec = optVec;
     nlopt::result ret;
     try{ ret = continObject.optimize(optVec, functionValue);}
     catch(nlopt::roundoff_limited) {
         qDebug() << m_car << ": roundoff_limit";
     }
     testValidityConstraints(m_constraints, optVec);
+    testValidityConstraintsBox(m_constraintsBox, optVec);
     testValidityConstraintsMax(m_globalConstraintsMax, optVec);
     testValidityConstraintsMin(m_globalConstraintsMin, optVec);
     m_openLoopCosts = functionValue;
@@ -344,6 +377,7 @@ std::vector<std::vector<double> > MpcController::optimizeContinous(const std::ve
     if (ret == nlopt::FAILURE) {
         qDebug() << "nlopt failed for:" << m_car;
     }
+    m_solverContext.storeStep(startVec, optVec);
     std::vector<std::vector<double> > shapedOptControl = VectorHelper::reshapeXd(optVec);
     m_prediction = optVec;
     return shapedOptControl;
@@ -422,6 +456,54 @@ std::vector<double> MpcController::getInitialControl(const double& t0, const dou
     return m_prediction;
 }
 
+/**
+ * @brief MpcController::setOptimizationAlgorithm sets the algorithm for the continuous OCP
+ * @param algorithm
+ */
+void MpcController::setOptimizationAlgorithm(const OptimizationAlgorithm& algorithm) {
+    m_optAlgorithm = algorithm;
+}
+
+/**
+ * @brief MpcController::getOptimizationAlgorithm
+ * @return algorithm for the continuous OCP
+ */
+OptimizationAlgorithm MpcController::getOptimizationAlgorithm() const {
+    return m_optAlgorithm;
+}
+
+/**
+ * @brief MpcController::getNloptAlgorithm maps the selected algorithm to the NLopt algorithm,
+ * the gradient-based algorithms need the analytic gradients of CostFunction and Constraint, which assume the exact solution
+ * of the holonomic dynamics, with another integrator the gradient-free COBYLA is taken
+ * @return NLopt algorithm
+ */
+nlopt::algorithm MpcController::getNloptAlgorithm() const {
+    if (m_systemFunc && m_systemFunc->getIntegrator() && m_systemFunc->getIntegrator()->getType() != IntegratorType::EXACT) {
+        return nlopt::LN_COBYLA;
+    }
+    switch (m_optAlgorithm) {
+    case OptimizationAlgorithm::SLSQP:
+        return nlopt::LD_SLSQP;
+    case OptimizationAlgorithm::MMA:
+        return nlopt::LD_MMA;
+    case OptimizationAlgorithm::CCSAQ:
+        return nlopt::LD_CCSAQ;
+    case OptimizationAlgorithm::COBYLA:
+    default:
+        return nlopt::LN_COBYLA;
+    }
+}
+
+/**
+ * @brief MpcController::isGradientBased
+ * @return true, if the NLopt algorithm uses the analytic gradients of the cost function and the constraints
+ */
+bool MpcController::isGradientBased() const {
+    const nlopt::algorithm algorithm = getNloptAlgorithm();
+    return algorithm == nlopt::LD_SLSQP || algorithm == nlopt::LD_MMA || algorithm == nlopt::LD_CCSAQ;
+}
+
 /**
  * @brief MpcController::getCurrentPrelimSolution
  * @return
@@ -493,7 +575,7 @@ double MpcController::getClosedLoopCosts() const {
 bool MpcController::shouldReoptimize(const Path &curPath, const double &costs) const {
     unsigned int violated = 0;
     if (!curPath.isNeighboured(&violated) || ( m_functionValues.size() > 0
-            && costs - m_functionValues.at(m_functionValues.size() - 1) > MpcController::m_reoptimizeBound ) ) {
+            && costs - m_functionValues.at(m_functionValues.size() - 1) > m_reoptimizeBound ) ) {
         return true;
     }
     return false;
@@ -513,8 +595,8 @@ double MpcController::reoptimize(nlopt::opt &optObject, std::vector<double>& con
             && m_systemFunc->getStart().getY() != m_target.getY()) {
         std::vector<double> yStep(controlVec);
         for (double& y : yStep) {
-            //y = (double)InterSection::getInstance()->getHeight() / 3.0;
-            y = (double)InterSection::getInstance()->getHeight() - 0.1;
+            //y = (double)m_systemFunc->getInterSection()->getHeight() / 3.0;
+            y = (double)m_systemFunc->getInterSection()->getHeight() - 0.1;
         }
         optObject.set_initial_step(yStep);
     }
@@ -524,7 +606,7 @@ double MpcController::reoptimize(nlopt::opt &optObject, std::vector<double>& con
              && m_systemFunc->getPath().back().getX() > 0 && m_systemFunc->getPath().back().getX() > m_target.getX()) {
         std::vector<double> yStep(controlVec);
         for (double& y : yStep) {
-            //y = (double)InterSection::getInstance()->getHeight() / 3.0;
+            //y = (double)m_systemFunc->getInterSection()->getHeight() / 3.0;
             y = -0.8;
         }
         optObject.set_initial_step(yStep);
@@ -543,7 +625,7 @@ double MpcController::reoptimize(nlopt::opt &optObject, std::vector<double>& con
  */
 double MpcController::calcLowerAcceptanceBound() const {
     return CostFunction::calcCurrentStateCosts(PathItem(0,0,0.0), PathItem(1,1,0.0),
-                         PathItem(InterSection::getInstance()->getWidth(), InterSection::getInstance()->getHeight(), 0.0),
+                         PathItem(m_systemFunc->getInterSection()->getWidth(), m_systemFunc->getInterSection()->getHeight(), 0.0),
                          m_lambda) * 1.5;
 }
 
@@ -554,7 +636,7 @@ double MpcController::calcLowerAcceptanceBound() const {
  */
 double MpcController::calcReoptimizeBound() const {
     return CostFunction::calcCurrentStateCosts(PathItem(0,0,0.0), PathItem(1,1,0.0),
-                         PathItem(InterSection::getInstance()->getWidth(), InterSection::getInstance()->getHeight(), 0.0),
+                         PathItem(m_systemFunc->getInterSection()->getWidth(), m_systemFunc->getInterSection()->getHeight(), 0.0),
                          m_lambda) * m_reoptimizationCostFactor;
 }
 
@@ -582,21 +664,16 @@ std::vector<double> MpcController::getTargetContinuous() const {
 
 /**
  * @brief MpcController::setCurrentConstraints clears the current dynamic constraints, not the global ones
- * and inserts them except if they are their own
- * @param constraints from the previous cars
+ * and takes the constraints of the other cars
+ * @param constraints from the previous cars (without the own ones)
  * @param current start time t0
  * @param current sampling instance T
  */
-void MpcController::setCurrentConstraints(const std::multimap<QString, Constraint> &constraints, const double& t0, const double& T) {
+void MpcController::setCurrentConstraints(const std::vector<Constraint> &constraints, const double& t0, const double& T) {
     /*if (scheme == CommunicationScheme::FULL || scheme == CommunicationScheme::CONTINUOUS
             || scheme == CommunicationScheme::MINMAXINTERVAL || scheme == CommunicationScheme::MINMAXINTERVALMOVING) {
 */
-        m_constraints.clear();
-        for (auto it = constraints.cbegin(); it != constraints.cend(); it++) {
-            if (it->first != m_car) {
-                m_constraints.push_back(it->second);
-            }
-        }
+        m_constraints = constraints;
     /*}
     else if (scheme == CommunicationScheme::DIFFERENTIAL) {
         //first, remove old constraints
@@ -619,9 +696,89 @@ void MpcController::setCurrentConstraints(const std::multimap<QString, Constrain
             }
         }
     }*/
+    if (InterSectionParameters::constraintPruning == 1) {
+        pruneUnreachableConstraints(t0, T);
+    }
+    initializeConstraints(t0, T);
+}
+
+/**
+ * @brief MpcController::pruneUnreachableConstraints removes the constraints of the other cars, which cannot become active.
+ * With the control bounds the state after p steps lies in the box \f$x_0 + pT[u_{min}, u_{max}]\f$, a constraint for step p
+ * is only active, if its square \f$||x_p - c||_{\infty} < r\f$ intersects this box. Constraints outside the horizon are never active.
+ * For the gradient-based algorithms the smoothed max-norm is up to Constraint::getSmoothingGap smaller, so the square is enlarged by it.
+ * @param t0 current time
+ * @param T sampling step
+ * @return number of removed constraints
+ */
+size_t MpcController::pruneUnreachableConstraints(const double& t0, const double& T) {
+    const std::vector<double> x0 = m_systemFunc->getCurrentContinuousState();
+    const double smoothingGap = isGradientBased() ? Constraint::getSmoothingGap(x0.size()) : 0.0;
+    const size_t sizeBefore = m_constraints.size();
+    auto itRemove = std::remove_if(m_constraints.begin(), m_constraints.end(), [&](const Constraint& constraint) {
+        //same step as in the evaluation of the constraint
+        double pos = constraint.getConstraintTime()*1/T - t0*1/T;
+        int position = (int)pos;
+        if (position < 0 || position >= (int)m_n) {
+            return true;
+        }
+        const std::vector<double> center = constraint.getCenterPoint();
+        double distance = 0.0;
+        for (unsigned int j = 0; j < x0.size() && j < center.size(); j++) {
+            const double lower = x0.at(j) + position * T * m_controlLowerBound;
+            const double upper = x0.at(j) + position * T * m_controlUpperBound;
+            distance = std::max(distance, std::max(lower - center.at(j), center.at(j) - upper));
+        }
+        return distance >= constraint.getCurrentGridSize() + smoothingGap;
+    });
+    m_constraints.erase(itRemove, m_constraints.end());
+    return sizeBefore - m_constraints.size();
+}
+
+/**
+ * @brief MpcController::setCurrentBoxConstraints replaces the aggregated interval constraints of the other cars
+ * @param constraints one box for each other car
+ * @param t0 current start time
+ * @param T current sampling instance
+ */
+void MpcController::setCurrentBoxConstraints(const std::vector<ConstraintBox> &constraints, const double& t0, const double& T) {
+    m_constraintsBox = constraints;
+    if (InterSectionParameters::constraintPruning == 1) {
+        pruneUnreachableBoxConstraints(t0, T);
+    }
     initializeConstraints(t0, T);
 }
 
+/**
+ * @brief MpcController::pruneUnreachableBoxConstraints same as pruneUnreachableConstraints for the aggregated interval constraints,
+ * a box is removed, if it does not intersect the reachable box \f$x_0 + pT[u_{min}, u_{max}]\f$ enlarged by the margin for any step p
+ * @param t0 current time
+ * @param T sampling step
+ * @return number of removed constraints
+ */
+size_t MpcController::pruneUnreachableBoxConstraints(const double& t0, const double& T) {
+    const std::vector<double> x0 = m_systemFunc->getCurrentContinuousState();
+    const size_t sizeBefore = m_constraintsBox.size();
+    auto itRemove = std::remove_if(m_constraintsBox.begin(), m_constraintsBox.end(), [&](const ConstraintBox& constraint) {
+        double pos = constraint.getConstraintTime()*1/T - t0*1/T;
+        int first = std::max((int)pos, 0);
+        for (int position = first; position < (int)m_n; position++) {
+            double distance = 0.0;
+            for (unsigned int j = 0; j < x0.size() && j < constraint.getLowerBound().size(); j++) {
+                const double lower = x0.at(j) + position * T * m_controlLowerBound;
+                const double upper = x0.at(j) + position * T * m_controlUpperBound;
+                distance = std::max(distance, std::max(lower - constraint.getUpperBound().at(j), constraint.getLowerBound().at(j) - upper));
+            }
+            if (distance < constraint.getCurrentGridSize()) {
+                return false;
+            }
+        }
+        return true;
+    });
+    m_constraintsBox.erase(itRemove, m_constraintsBox.end());
+    return sizeBefore - m_constraintsBox.size();
+}
+
 std::vector<Constraint>& MpcController::getCurrentConstraints() {
     return m_constraints;
 }
@@ -670,6 +827,22 @@ bool MpcController::testValidityConstraints(std::vector<Constraint>& constraints
     return valid;
 }
 
+/**
+ * @brief MpcController::testValidityConstraintsBox gives back, if one of the aggregated interval constraints is invalid for the control
+ * @param constraints
+ * @param controlVector
+ */
+bool MpcController::testValidityConstraintsBox(std::vector<ConstraintBox>& constraints, const std::vector<double>& controlVector) const {
+    bool valid = true;
+    for (ConstraintBox& constraint : constraints) {
+        if (constraint.getMaxViolation(controlVector) > 0.0) {
+            valid = false;
+            break;
+        }
+    }
+    return valid;
+}
+
 bool MpcController::testValidityConstraintsMin(std::vector<ConstraintMin>& constraints, const std::vector<double>& controlVector) const {
     bool valid = true;
     for (ConstraintMin& constraint : constraints) {
@@ -717,6 +890,9 @@ void MpcController::initializeConstraints(const double &t0, const double& T) {
     for (Constraint& constraint : m_constraints) {
         constraint.setActualSystem(m_systemFunc, t0, T, m_n);
     }
+    for (ConstraintBox& constraint : m_constraintsBox) {
+        constraint.setActualSystem(m_systemFunc, t0, T, m_n);
+    }
     //insert global constraints
     //first minimum constriants
     for (unsigned int i = 0; i < m_globalConstraintsMin.size(); i++) {
@@ -732,6 +908,7 @@ void MpcController::initializeConstraints(const double &t0, const double& T) {
  */
 void MpcController::clearAllConstraints() {
    m_constraints.clear();
+   m_constraintsBox.clear();
    m_globalConstraintsMax.clear();
    m_globalConstraintsMin.clear();
    m_constraintsDirec.clear();
@@ -786,4 +963,6 @@ void MpcController::clearPrediction() {
     for (double& val : m_prediction) {
         val = 0.0;
     }
+    //the next initial control is not a shifted solution anymore
+    m_solverContext.invalidate();
 }
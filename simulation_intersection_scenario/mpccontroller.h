@@ -8,8 +8,10 @@
 #include "constraintmin.h"
 #include "constraintmax.h"
 #include "constraint.h"
+#include "constraintbox.h"
 
 #include "pathcalculation.h"
+#include "solvercontext.h"
 
 #include <nlopt.hpp>
 
@@ -24,8 +26,10 @@
 class MpcController : public PathCalculation
 {
 public:
-    MpcController(const QString &car, const PathItem& start, const PathItem& target, const size_t& N, const double& lambda, const std::pair<double, double> &bounds = {-1.0, 1.0});
-    MpcController(const QString &car, const std::vector<double>& start, const std::vector<double>& target, const size_t &N, const double& lambda, const std::pair<double, double>& bounds = {-1.0, 1.0});
+    MpcController(const QString &car, const PathItem& start, const PathItem& target, const size_t& N, const double& lambda, const std::pair<double, double> &bounds = {-1.0, 1.0},
+                  const std::weak_ptr<SimulationContext>& context = std::weak_ptr<SimulationContext>());
+    MpcController(const QString &car, const std::vector<double>& start, const std::vector<double>& target, const size_t &N, const double& lambda, const std::pair<double, double>& bounds = {-1.0, 1.0},
+                  const std::weak_ptr<SimulationContext>& context = std::weak_ptr<SimulationContext>());
     void calcConstraintsFromPath();
     PathItem optimize(const PathItem &start);
     void addActualSolutionToFunctionValues();
@@ -43,16 +47,15 @@ PathAlgorithm getAlg() const;
     bool shouldReoptimize(const Path& curPath, const double& costs) const;
     double reoptimize(nlopt::opt &optObject, std::vector<double>& controlVec);
     std::map<std::string, double> calcCostsForNeighbours();
-    ///initial value for accepting an intermediate optimization result if reoptimization is necessary
-    static double m_lowerAcceptenceBound;
-    ///if costs are too high, reoptimize
-    static double m_reoptimizeBound;
     double initializeCosts();
     std::vector<std::vector<double> > optimizeContinous(const std::vector<double> &controlVec, const double &t0, const double &T);
     std::vector<double> getTargetContinuous() const;
     std::vector<double> getInitialControl(const double &t0, const double &T);
     void initializeConstraints(const double &t0, const double &T);
-    void setCurrentConstraints(const std::multimap<QString, Constraint> &constraints, const double& t0, const double& T);
+    void setCurrentConstraints(const std::vector<Constraint> &constraints, const double& t0, const double& T);
+    void setCurrentBoxConstraints(const std::vector<ConstraintBox> &constraints, const double& t0, const double& T);
+    size_t pruneUnreachableConstraints(const double& t0, const double& T);
+    size_t pruneUnreachableBoxConstraints(const double& t0, const double& T);
     std::vector<Constraint> &getCurrentConstraints();
     void clearAllConstraints();
     void initializeDirectionalConstraints(const unsigned int &interSectionWidth, const unsigned int &interSectionHeight, const double &cellSize,
@@ -66,8 +69,13 @@ PathAlgorithm getAlg() const;
     //TODO: Refactor
     bool testValidityConstraintsMin(std::vector<ConstraintMin> &constraints, const std::vector<double>& controlVector) const;
     bool testValidityConstraintsMax(std::vector<ConstraintMax> &constraints, const std::vector<double>& controlVector) const;
+    bool testValidityConstraintsBox(std::vector<ConstraintBox> &constraints, const std::vector<double>& controlVector) const;
     void setControlRange(const double& lb, const double& ub);
     std::pair<double, double> getControlBounds() const;
+    void setOptimizationAlgorithm(const OptimizationAlgorithm& algorithm);
+    OptimizationAlgorithm getOptimizationAlgorithm() const;
+    nlopt::algorithm getNloptAlgorithm() const;
+    bool isGradientBased() const;
 private:
     ///system dynamics
     std::shared_ptr<SystemFunction> m_systemFunc;
@@ -92,8 +100,14 @@ private:
     double m_openLoopCosts;
     ///time dependant closed loop costs;
     double m_closedLoopCosts;
+    ///initial value for accepting an intermediate optimization result if reoptimization is necessary
+    double m_lowerAcceptenceBound;
+    ///if costs are too high, reoptimize
+    double m_reoptimizeBound;
     ///constraint which are coming from the previous optimizing cars
     std::vector<Constraint> m_constraints;
+    ///aggregated interval constraints coming from the previous optimizing cars, one for each car
+    std::vector<ConstraintBox> m_constraintsBox;
 
     ///directional constraint, to keep cars in right directional lanes
     std::vector<ConstraintDirectional> m_constraintsDirec;
@@ -115,6 +129,10 @@ private:
     double m_controlLowerBound, m_controlUpperBound;
     ///bound init steps
     bool m_boundInitSteps;
+    ///algorithm to solve the continuous OCP
+    OptimizationAlgorithm m_optAlgorithm;
+    ///optimizer kept across the MPC steps
+    SolverContext m_solverContext;
 };
 
 #endif // MPCCONTROLLER_H
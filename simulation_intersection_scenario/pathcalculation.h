@@ -3,6 +3,7 @@
 #include "intersectioncell.h"
 #include "systemfunction.h"
 #include "constraint.h"
+#include "constraintbox.h"
 #include "path.h"
 #include <memory>
 
@@ -42,7 +43,9 @@ public:
     ///calculate initial costs
     virtual double initializeCosts() = 0;
     ///insert the current constraint obtained by other cars
-    virtual void setCurrentConstraints(const std::multimap<QString, Constraint> &constraints, const double& t0, const double& T) = 0;
+    virtual void setCurrentConstraints(const std::vector<Constraint> &constraints, const double& t0, const double& T) = 0;
+    ///insert the aggregated interval constraints obtained by other cars
+    virtual void setCurrentBoxConstraints(const std::vector<ConstraintBox> &constraints, const double& t0, const double& T) = 0;
     ///create global constraints concening the operational space
     virtual void createGlobalConstraints(const std::vector<double>& lb, const std::vector<double>& ub) = 0;
     ///if used the directional intersection scenario, this has to be used
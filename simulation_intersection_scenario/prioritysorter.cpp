@@ -1,9 +1,12 @@
 #include "prioritysorter.h"
+#include "conflictindex.h"
 
 #include <QDebug>
 
+#include <algorithm>
 #include <future>
 #include <memory>
+#include <set>
 
 /**
  * @brief PrioritySorter::PrioritySorter
@@ -25,10 +28,10 @@ PrioritySorter::PrioritySorter(const PriorityCriteria &criteria) :
  * @param N horizon
  * @param radius radius for one robot car
  */
-void PrioritySorter::sortAfterPriority(CarGroupQueue& cars, const std::map<QString, std::vector<std::vector<double> >>& contin,
-                                       const std::multimap<QString, Constraint>& constraints,
+void PrioritySorter::sortAfterPriority(CarGroupQueue& cars, const CarControls& contin,
+                                       const ConstraintStore& constraints,
                                        const double& t0, const double& T, const size_t& N, const double& radius) {
-    std::map<QString, std::vector<std::vector<double> > > continSol = contin;
+    CarControls continSol = contin;
     if (m_criteria == PriorityCriteria::MINCLOSEDLOOPCOSTS) {
         auto carsSeq = cars.getOrderSeq();
         std::sort(carsSeq.begin(), carsSeq.end(), compareMinClosedLoopCostsLess);
@@ -58,6 +61,9 @@ void PrioritySorter::sortAfterPriority(CarGroupQueue& cars, const std::map<QStri
         if (t0 == 0.0) {
             continSol = getUnconstrainedSol(cars, t0, T);
         }
+        //map all predictions to the cells once
+        ConflictIndex conflicts(T);
+        conflicts.build(cars.getOrderSeq(), continSol, t0, T, N, radius);
 
         //now evaluate the intersection of trajectories
         size_t rowSize = cars.rowSize();
@@ -76,8 +82,6 @@ void PrioritySorter::sortAfterPriority(CarGroupQueue& cars, const std::map<QStri
                 countOtherPos = countPos;
                 //position of other examined car
                 bool foundConflicts = false;
-                Path cellsForX = (*itCar)->getPredictedTrajectoryCells((*itCar)->getCurrentStateContinuous(),
-                                                                       VectorHelper::reshapeXdTo1d(continSol.at((*itCar)->getName())), t0, T, N, radius);
                 //(*itCar)->addCountCommunicatedConstraints();
                 if (carRow.size() > 1) {
                     //test all other vehicles in vector
@@ -85,11 +89,9 @@ void PrioritySorter::sortAfterPriority(CarGroupQueue& cars, const std::map<QStri
                     while (itOtherCar != carRow.end()) {
                         bool localCarConflict = false;
                         if ((*itCar) != *itOtherCar) {
-                            Path otherCells = (*itOtherCar)->getPredictedTrajectoryCells((*itOtherCar)->getCurrentStateContinuous(),
-                                                                                         VectorHelper::reshapeXdTo1d(continSol.at((*itOtherCar)->getName())), t0, T, N, radius);
                             //(*itOtherCar)->addCountCommunicatedConstraints();
                             //if conflicts are found, keep it
-                            if (!cellsForX.findSimilarities(otherCells).empty()) {
+                            if (conflicts.hasConflict(*itCar, *itOtherCar)) {
                                 foundConflicts = true;
                                 localCarConflict = true;
                                 dependent.insert(std::pair<int, std::shared_ptr<Car> >(countOtherPos, *(itOtherCar)));
@@ -143,10 +145,13 @@ void PrioritySorter::sortAfterPriority(CarGroupQueue& cars, const std::map<QStri
             for (size_t i = 0; i < rowSize; i++) {
                 auto carRow = cars.getRow(i);
                 for (auto car : carRow) {
-                    continSol[car->getName()] = VectorHelper::reshapeXd(car->getCurrentPrediction());
+                    continSol[car->getId()] = VectorHelper::reshapeXd(car->getCurrentPrediction());
                 }
             }
         }
+        //map all predictions to the cells once
+        ConflictIndex conflicts(T);
+        conflicts.build(cars.getOrderSeq(), continSol, t0, T, N, radius);
         if (m_criteria == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYHIERARCHY || m_criteria == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY) {
             std::vector<std::shared_ptr<Car> > movedCars;
             for (size_t i = 0; i < rowSize; i++) {
@@ -156,16 +161,13 @@ void PrioritySorter::sortAfterPriority(CarGroupQueue& cars, const std::map<QStri
                 auto car = carRow.begin();
                 while (car != carRow.end()) {
                     //evaluate conflicts in own row
-                    Path cellsForX = (*car)->getPredictedTrajectoryCells((*car)->getCurrentStateContinuous(), VectorHelper::reshapeXdTo1d(continSol.at((*car)->getName())), t0, T, N, radius);
                     (*car)->addCountCommunicatedConstraints();
                     //now test current row for the other cars
                     auto itCar = carRow.begin();
                     while (itCar != carRow.end()) {
                         if ((*car) != (*itCar)) {
-                            Path cellsOther = (*itCar)->getPredictedTrajectoryCells((*itCar)->getCurrentStateContinuous(),
-                                                                                    VectorHelper::reshapeXdTo1d(continSol.at((*itCar)->getName())), t0, T, N, radius);
                             (*itCar)->addCountCommunicatedConstraints();
-                            if (!cellsForX.findSimilarities(cellsOther).empty()) {
+                            if (conflicts.hasConflict(*car, *itCar)) {
                                 //test with priority rule and add to list
                                 //iterator over row (hierarchy)
                                 auto maxCar = getCarWithHigherCosts((*car), (*itCar));
@@ -203,8 +205,8 @@ void PrioritySorter::sortAfterPriority(CarGroupQueue& cars, const std::map<QStri
                     //now look for the upper rows (first, evaluate active constraints)
                     auto upRow = cars.getPreviousRow(carRow);
                     for (auto itCar = upRow.begin(); itCar != upRow.end(); itCar++) {
-                        auto carConstraints = getConstraintsFromMap(constraints, (*itCar)->getName());
-                        foundConflict = (*car)->testActiveConstraints(carConstraints, VectorHelper::reshapeXdTo1d(continSol.at((*car)->getName())), t0, T, N);
+                        auto carConstraints = constraints.getConstraints((*itCar)->getId());
+                        foundConflict = (*car)->testActiveConstraints(carConstraints, VectorHelper::reshapeXdTo1d(continSol.at((*car)->getId())), t0, T, N);
                         if (foundConflict) {
                             break;
                         }
@@ -230,15 +232,12 @@ void PrioritySorter::sortAfterPriority(CarGroupQueue& cars, const std::map<QStri
                 //evaluate conflicts for all rows
                 while (car != carRow.end()) {
                     bool carHasMoved = false;
-                    Path cellsForX = (*car)->getPredictedTrajectoryCells((*car)->getCurrentStateContinuous(), VectorHelper::reshapeXdTo1d(continSol.at((*car)->getName())), t0, T, N, radius);
                     for (size_t j = 0; j < rowSize; j++) {
                         auto carRowj = cars.getRow(j);
                         auto itCar = carRowj.begin();
                         while (itCar != carRowj.end()) {
                             if ((*car) != (*itCar) && !cars.isInRelationTo((*car), (*itCar)) ) {
-                                Path cellsOther = (*itCar)->getPredictedTrajectoryCells((*itCar)->getCurrentStateContinuous(),
-                                                                                        VectorHelper::reshapeXdTo1d(continSol.at((*itCar)->getName())), t0, T, N, radius);
-                                if (!cellsForX.findSimilarities(cellsOther).empty()) {
+                                if (conflicts.hasConflict(*car, *itCar)) {
                                     //test with priority rule and add to list
                                     //iterator over row (hierarchy)
                                     auto maxCar = getCarWithHigherCosts((*car), (*itCar));
@@ -300,8 +299,8 @@ void PrioritySorter::sortAfterPriority(CarGroupQueue& cars, const std::map<QStri
                     auto predCar = predList.begin();
                     while (predCar != predList.end() && predList.size() > 0) {
                         std::shared_ptr<Car> tempCar = *predCar;
-                        auto carConstraints = getConstraintsFromMap(constraints, (*predCar)->getName());
-                        bool foundConflict = (*car)->testActiveConstraints(carConstraints, VectorHelper::reshapeXdTo1d(continSol.at((*car)->getName())), t0, T, N);
+                        auto carConstraints = constraints.getConstraints((*predCar)->getId());
+                        bool foundConflict = (*car)->testActiveConstraints(carConstraints, VectorHelper::reshapeXdTo1d(continSol.at((*car)->getId())), t0, T, N);
                         //DEBUG
                         //auto rootCar = cars.getRoot(*car);
                         //cars.showCarGroupTree(rootCar);
@@ -338,11 +337,94 @@ void PrioritySorter::sortAfterPriority(CarGroupQueue& cars, const std::map<QStri
         }//--tree-based
     cars.removeEmptyRows();
     }
+    else if (m_criteria == PriorityCriteria::MINOPENLOOPCOSTSCOLORING || m_criteria == PriorityCriteria::MINCLOSEDLOOPCOSTSCOLORING) {
+        std::vector<std::shared_ptr<Car> > carsSeq = cars.getOrderSeq();
+        //in the start, get the unconstrained solution for each car
+        if (t0 == 0.0) {
+            continSol = getUnconstrainedSol(cars, t0, T);
+        }
+        else {
+            for (auto car : carsSeq) {
+                continSol[car->getId()] = VectorHelper::reshapeXd(car->getCurrentPrediction());
+            }
+        }
+        //every car communicates its predicted cells once
+        for (auto car : carsSeq) {
+            car->addCountCommunicatedConstraints();
+        }
+        ConflictIndex conflicts(T);
+        conflicts.build(carsSeq, continSol, t0, T, N, radius);
+        //each colour is one level, the cars of a level are not in conflict and can be optimized in parallel
+        std::vector<std::vector<std::shared_ptr<Car> > > levels = colourConflictGraph(carsSeq, conflicts);
+        cars.clear();
+        for (size_t level = 0; level < levels.size(); level++) {
+            cars.storeOrder(levels.at(level), level);
+        }
+        cars.removeEmptyRows();
+    }
     else if (m_criteria == PriorityCriteria::FIXED) {
         //nothing
     }
 }
 
+/**
+ * @brief PrioritySorter::colourConflictGraph colours the conflict graph of the cars with the DSATUR heuristic:
+ * the next car is the one with the most different colours among its neighbours (ties: more conflicts, then higher priority),
+ * it gets the smallest colour not used by a neighbour. This keeps the number of colours (sequential levels) small.
+ * @param cars cars to colour
+ * @param conflicts index with the predictions of the cars
+ * @return cars for each colour, ordered after the priority criteria
+ */
+std::vector<std::vector<std::shared_ptr<Car> > > PrioritySorter::colourConflictGraph(const std::vector<std::shared_ptr<Car> >& cars, const ConflictIndex& conflicts) const {
+    std::vector<std::shared_ptr<Car> > order = cars;
+    if (m_criteria == PriorityCriteria::MINCLOSEDLOOPCOSTSCOLORING) {
+        std::stable_sort(order.begin(), order.end(), compareMinClosedLoopCostsLess);
+    }
+    else {
+        std::stable_sort(order.begin(), order.end(), compareMinOpenLoopCostsLess);
+    }
+    const size_t n = order.size();
+    std::map<std::shared_ptr<Car>, size_t> position;
+    for (size_t i = 0; i < n; i++) {
+        position[order.at(i)] = i;
+    }
+    std::vector<std::vector<size_t> > adjacency(n);
+    for (size_t i = 0; i < n; i++) {
+        for (const std::shared_ptr<Car>& other : conflicts.getConflictingCars(order.at(i))) {
+            auto itPos = position.find(other);
+            if (itPos != position.end()) {
+                adjacency.at(i).push_back(itPos->second);
+            }
+        }
+    }
+    std::vector<int> colour(n, -1);
+    std::vector<std::set<int> > neighbourColours(n);
+    int numColours = 0;
+    for (size_t step = 0; step < n; step++) {
+        size_t next = n;
+        for (size_t i = 0; i < n; i++) {
+            if (colour.at(i) == -1 && (next == n || neighbourColours.at(i).size() > neighbourColours.at(next).size()
+                                        || (neighbourColours.at(i).size() == neighbourColours.at(next).size() && adjacency.at(i).size() > adjacency.at(next).size()))) {
+                next = i;
+            }
+        }
+        int c = 0;
+        while (neighbourColours.at(next).count(c) > 0) {
+            c++;
+        }
+        colour.at(next) = c;
+        numColours = std::max(numColours, c + 1);
+        for (const size_t& neighbour : adjacency.at(next)) {
+            neighbourColours.at(neighbour).insert(c);
+        }
+    }
+    std::vector<std::vector<std::shared_ptr<Car> > > levels(numColours);
+    for (size_t i = 0; i < n; i++) {
+        levels.at(colour.at(i)).push_back(order.at(i));
+    }
+    return levels;
+}
+
 /**
  * @brief PrioritySorter::testCurrentCarsForCurrentRow tests the car with current solution for the current row if there is any conflict in the hierarchy and moves the car
  * @param cars Queue with cars
@@ -352,25 +434,33 @@ void PrioritySorter::sortAfterPriority(CarGroupQueue& cars, const std::map<QStri
  * @param t0 start time
  * @param T
  * @param N
- * @return QStringList with cars removed
+ * @return IDs of the cars removed
  */
-QStringList PrioritySorter::testCurrentCarsForCurrentRow(CarGroupQueue& cars, const std::map<QString, std::vector<std::vector<double> >> continSol,
+std::vector<CarId> PrioritySorter::testCurrentCarsForCurrentRow(CarGroupQueue& cars, const CarControls& continSol,
                                                  std::vector<std::shared_ptr<Car> >& carRow, const double& radius, const double& t0, const double& T, const size_t& N)  {
-    QStringList removedCars;
-    if (m_criteria == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYHIERARCHY || m_criteria == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY) {
+    std::vector<CarId> removedCars;
+    ConflictIndex conflicts(T);
+    if (m_criteria == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYHIERARCHY || m_criteria == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY ||
+            m_criteria == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYTREE || m_criteria == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYTREE ||
+            m_criteria == PriorityCriteria::MINOPENLOOPCOSTSCOLORING || m_criteria == PriorityCriteria::MINCLOSEDLOOPCOSTSCOLORING) {
+        //map all predictions to the cells once, the cars of the row are indexed as well if they are not part of the queue
+        std::vector<std::shared_ptr<Car> > indexedCars = cars.getOrderSeq();
+        indexedCars.insert(indexedCars.end(), carRow.begin(), carRow.end());
+        conflicts.build(indexedCars, continSol, t0, T, N, radius);
+    }
+    //the levels of the colouring are tested like the hierarchy, a car getting into conflict within its level is moved to the next level
+    if (m_criteria == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYHIERARCHY || m_criteria == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY
+            || m_criteria == PriorityCriteria::MINOPENLOOPCOSTSCOLORING || m_criteria == PriorityCriteria::MINCLOSEDLOOPCOSTSCOLORING) {
         auto car = carRow.begin();
         while (car != carRow.end()) {
             bool isCarRemoved = false;
-            Path cellsForX = (*car)->getPredictedTrajectoryCells((*car)->getCurrentStateContinuous(), VectorHelper::reshapeXdTo1d(continSol.at((*car)->getName())), t0, T, N, radius);
             //now test current row for the other cars
             auto itCar = carRow.begin();
             while ( itCar != carRow.end()) {
                 if ( (*itCar) != (*car) && !cars.isInRelationTo((*car), (*itCar)) ) {
-                    Path cellsOther = (*itCar)->getPredictedTrajectoryCells((*itCar)->getCurrentStateContinuous(),
-                                                                            VectorHelper::reshapeXdTo1d(continSol.at((*itCar)->getName())), t0, T, N, radius);
-                    if (!cellsForX.findSimilarities(cellsOther).empty()) {
+                    if (conflicts.hasConflict(*car, *itCar)) {
                         std::shared_ptr<Car> carToMove = getCarWithHigherCosts((*itCar), (*car));
-                        removedCars.append(carToMove->getName());
+                        removedCars.push_back(carToMove->getId());
                         cars.moveCarToNextRow(carToMove);
                         if (carToMove == (*car)) {
                             carRow.erase(car);
@@ -400,20 +490,17 @@ QStringList PrioritySorter::testCurrentCarsForCurrentRow(CarGroupQueue& cars, co
         //test the row for all cars
         while (car != carRow.end()) {
             bool isMoved = false;
-            Path cellsForX = (*car)->getPredictedTrajectoryCells((*car)->getCurrentStateContinuous(), VectorHelper::reshapeXdTo1d(continSol.at((*car)->getName())), t0, T, N, radius);
             for (size_t i = 0; i < cars.rowSize(); i++) {
                 auto itRow = cars.getRow(i);
                 if (!isMoved) {
                     auto itCar = itRow.begin();
                     //iterate now over all rows
                     while (itCar != itRow.end()) {
-                        if ((*itCar) != (*car) && continSol.find((*itCar)->getName()) != continSol.end() && !cars.isInRelationTo((*car), (*itCar)) ) {
-                            Path cellsOther = (*itCar)->getPredictedTrajectoryCells((*itCar)->getCurrentStateContinuous(),
-                                                                                    VectorHelper::reshapeXdTo1d(continSol.at((*itCar)->getName())), t0, T, N, radius);
-                            if (!cellsForX.findSimilarities(cellsOther).empty() ) {
+                        if ((*itCar) != (*car) && continSol.contains((*itCar)->getId()) && !cars.isInRelationTo((*car), (*itCar)) ) {
+                            if (conflicts.hasConflict(*car, *itCar)) {
                                 std::shared_ptr<Car> carToMove = getCarWithHigherCosts((*itCar), (*car));
 
-                                removedCars.append(carToMove->getName());
+                                removedCars.push_back(carToMove->getId());
                                 if (carToMove == (*car)) {
                                     cars.addSuccessor((*itCar), (*car));
                                     carRow.erase(car);
@@ -453,11 +540,13 @@ QStringList PrioritySorter::testCurrentCarsForCurrentRow(CarGroupQueue& cars, co
 std::shared_ptr<Car> PrioritySorter::getCarWithHigherCosts(const std::shared_ptr<Car>& car1, const std::shared_ptr<Car>& car2) const {
     std::vector<std::shared_ptr<Car> > cars = {car1, car2};
     if (m_criteria == PriorityCriteria::MINCLOSEDLOOPCOSTS || m_criteria == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORY
-            || m_criteria == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY || m_criteria == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYTREE) {
+            || m_criteria == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY || m_criteria == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYTREE
+            || m_criteria == PriorityCriteria::MINCLOSEDLOOPCOSTSCOLORING) {
         std::sort(cars.begin(), cars.end(), compareMinClosedLoopCostsLess);
     }
     else if (m_criteria == PriorityCriteria::MINOPENLOOPCOSTS || m_criteria == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORY
-             || m_criteria == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYHIERARCHY || m_criteria == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYTREE) {
+             || m_criteria == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYHIERARCHY || m_criteria == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYTREE
+             || m_criteria == PriorityCriteria::MINOPENLOOPCOSTSCOLORING) {
         std::sort(cars.begin(), cars.end(), compareMinOpenLoopCostsLess);
     }
     else if (m_criteria == PriorityCriteria::MAXCLOSEDLOOPCOSTS) {
@@ -559,29 +648,35 @@ QString PrioritySorter::getTextForChosenCriteria(const PriorityCriteria& criteri
     return ret.toLower();
 }
 
-std::map<QString, std::vector<std::vector<double> > > PrioritySorter::getUnconstrainedSol(const CarGroupQueue& cars, const double& t0, const double& T) const {
-    std::map<QString, std::vector<std::vector<double> > > continSol;
+/**
+ * @brief PrioritySorter::getCriteriaForText returns the priority criteria for the literal description (case insensitive)
+ * @param text
+ * @param ok is set to false, if the text does not match any criteria
+ * @return chosen criteria, FIXED if the text is unknown
+ */
+PriorityCriteria PrioritySorter::getCriteriaForText(const QString& text, bool* ok) {
+    for (int i = 0; i < getPriorityCriteriaMapSize(); i++) {
+        if (text.toUpper() == QString(priorityCriteriaMap[i].text)) {
+            if (ok) {
+                *ok = true;
+            }
+            return priorityCriteriaMap[i].criteria;
+        }
+    }
+    if (ok) {
+        *ok = false;
+    }
+    return PriorityCriteria::FIXED;
+}
+
+CarControls PrioritySorter::getUnconstrainedSol(const CarGroupQueue& cars, const double& t0, const double& T) const {
+    CarControls continSol;
     //calculate the OCP without any constraints
     for (std::shared_ptr<Car>& car : cars.getOrderSeq()) {
         car->clearAllConstraints();
         car->createGlobalConstraints();
         auto optControl = std::async(std::launch::async, &Car::calcOcpObjectiveContinuous, car, car->getInitialControl(t0, T), t0, T);
-        continSol[car->getName()] = optControl.get();
+        continSol[car->getId()] = optControl.get();
     }
     return continSol;
 }
-
-/**
- * @brief PrioritySorter::getConstraintsFromMap returns the constraint from the multimap
- * @param constraints
- * @param car
- * @return
- */
-std::vector<Constraint> PrioritySorter::getConstraintsFromMap(const std::multimap<QString, Constraint>& constraints, const QString& car) const {
-    auto carConstraints = constraints.equal_range(car);
-    std::vector<Constraint> constraintList;
-    for (auto itConstraint = carConstraints.first; itConstraint != carConstraints.second; itConstraint++) {
-        constraintList.push_back(itConstraint->second);
-    }
-    return constraintList;
-}
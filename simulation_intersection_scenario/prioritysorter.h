@@ -9,6 +9,8 @@
 #include <memory>
 #include <map>
 
+class ConflictIndex;
+
 //TODO: Refactoring: put this in simulation core library
 
 /**
@@ -24,6 +26,8 @@
  * MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY order sorting ascending after minimum closed-loop costs with memory saving the dependency in hierarchical order considering each row for executing
  * MINOPENLOOPCOSTSWITHMEMORYTREE order sorting ascending after minimum open-loop costs with memory but only after which active constraints are violated
  * MINCLOSEDLOOPCOSTSWITHMEMORYTREE order sorting ascending after minimum closed-loop costs with memory but only after which active constraints are violated
+ * MINOPENLOOPCOSTSCOLORING levels from a colouring of the conflict graph, each level is conflict-free and ordered after minimum open-loop costs
+ * MINCLOSEDLOOPCOSTSCOLORING levels from a colouring of the conflict graph, each level is conflict-free and ordered after minimum closed-loop costs
  */
 enum class PriorityCriteria {
     FIXED=0,
@@ -36,7 +40,9 @@ enum class PriorityCriteria {
     MINOPENLOOPCOSTSWITHMEMORYHIERARCHY = 7,
     MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY = 8,
     MINOPENLOOPCOSTSWITHMEMORYTREE = 9,
-    MINCLOSEDLOOPCOSTSWITHMEMORYTREE = 10
+    MINCLOSEDLOOPCOSTSWITHMEMORYTREE = 10,
+    MINOPENLOOPCOSTSCOLORING = 11,
+    MINCLOSEDLOOPCOSTSCOLORING = 12
 };
 
 
@@ -63,7 +69,9 @@ constexpr PriorityCriteriaStrings priorityCriteriaMap[] = {
     {PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYHIERARCHY, "MINOPENLOOPCOSTSWITHMEMORYHIERARCHY"},
     {PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY, "MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY"},
     {PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYTREE, "MINOPENLOOPCOSTSWITHMEMORYTREE"},
-    {PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYTREE, "MINCLOSEDLOOPCOSTSWITHMEMORYTREE"}
+    {PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYTREE, "MINCLOSEDLOOPCOSTSWITHMEMORYTREE"},
+    {PriorityCriteria::MINOPENLOOPCOSTSCOLORING, "MINOPENLOOPCOSTSCOLORING"},
+    {PriorityCriteria::MINCLOSEDLOOPCOSTSCOLORING, "MINCLOSEDLOOPCOSTSCOLORING"}
 };
 
 /**
@@ -81,8 +89,8 @@ class PrioritySorter
 {
 public:
     PrioritySorter(const PriorityCriteria& criteria);
-    void sortAfterPriority(CarGroupQueue &cars, const std::map<QString, std::vector<std::vector<double> > > &contin,
-                           const std::multimap<QString, Constraint> &constraints, const double &t0 = 0.0,
+    void sortAfterPriority(CarGroupQueue &cars, const CarControls &contin,
+                           const ConstraintStore &constraints, const double &t0 = 0.0,
                            const double &T = 0.0, const size_t &N = InterSectionParameters::N, const double &radius = 0.5);
     std::vector<std::shared_ptr<Car> > findCarInDeorderPriorityMap(CarGroupQueue &deorderAndPriorityMap, const std::shared_ptr<Car>& car);
     PriorityCriteria getPriorityCriteria() const;
@@ -92,12 +100,13 @@ public:
     static bool compareMaxOpenLoopCostsGreater(const std::shared_ptr<Car>& car1, const std::shared_ptr<Car>& car2);
     static QStringList getTextForCriteria();
     static QString getTextForChosenCriteria(const PriorityCriteria& criteria);
+    static PriorityCriteria getCriteriaForText(const QString& text, bool* ok = nullptr);
     ///get optimisation unconstrained
-    std::map<QString, std::vector<std::vector<double> > > getUnconstrainedSol(const CarGroupQueue &cars, const double &t0, const double &T) const;
+    CarControls getUnconstrainedSol(const CarGroupQueue &cars, const double &t0, const double &T) const;
     std::shared_ptr<Car> getCarWithHigherCosts(const std::shared_ptr<Car>& car1, const std::shared_ptr<Car>& car2) const;
-    QStringList testCurrentCarsForCurrentRow(CarGroupQueue& cars, const std::map<QString, std::vector<std::vector<double> > > continSol,
+    std::vector<CarId> testCurrentCarsForCurrentRow(CarGroupQueue& cars, const CarControls& continSol,
                                       std::vector<std::shared_ptr<Car> > &carRow, const double &radius, const double &t0, const double &T, const size_t &N);
-    std::vector<Constraint> getConstraintsFromMap(const std::multimap<QString, Constraint> &constraints, const QString& car) const;
+    std::vector<std::vector<std::shared_ptr<Car> > > colourConflictGraph(const std::vector<std::shared_ptr<Car> >& cars, const ConflictIndex& conflicts) const;
 private:
     ///chosen criteria
     PriorityCriteria m_criteria;
@@ -5,7 +5,7 @@
  * @param car
  * @param time
  */
-ReservationCell::ReservationCell(const QString &car, const double &time) :
+ReservationCell::ReservationCell(const CarId &car, const double &time) :
     m_car(car),
     m_time(time)
 {
@@ -15,7 +15,7 @@ ReservationCell::ReservationCell(const QString &car, const double &time) :
  * @brief ReservationCell::ReservationCell
  */
 ReservationCell::ReservationCell() :
-    m_car(""),
+    m_car(noCarId),
     m_time(0)
 {
 
@@ -25,7 +25,7 @@ ReservationCell::ReservationCell() :
 ** * @brief reservationCell::getCar
 ** * @return
 */
-QString ReservationCell::getCar() const {
+CarId ReservationCell::getCar() const {
     return m_car;
 }
 
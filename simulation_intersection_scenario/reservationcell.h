@@ -1,6 +1,6 @@
 #ifndef RESERVATIONCELL_H
 #define RESERVATIONCELL_H
-#include <QtCore/QString>
+#include "carid.h"
 
 /**
  * @brief stores the information for which time a car the cell has reserved
@@ -8,14 +8,14 @@
 class ReservationCell
 {
 public:
-    ReservationCell(const QString &car, const double &time);
+    ReservationCell(const CarId &car, const double &time);
     ReservationCell();
-    QString getCar() const;
+    CarId getCar() const;
     double getTime() const;
     bool operator==(const ReservationCell& cell) const;
 private:
     ///ID of the car
-    QString m_car;
+    CarId m_car;
     ///time for which the cell is reserved
     double m_time;
 };
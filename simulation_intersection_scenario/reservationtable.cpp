@@ -0,0 +1,284 @@
+#include "reservationtable.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+///number of slots per word of the bitmap
+constexpr int64_t slotsPerWord = 64;
+
+/**
+ * @brief floorDiv division which rounds to negative infinity, so negative slots are mapped to the correct word
+ */
+int64_t floorDiv(const int64_t& a, const int64_t& b) {
+    return (a >= 0) ? (a / b) : -((-a + b - 1) / b);
+}
+}
+
+/**
+ * @brief ReservationTable::ReservationTable
+ * @param T width of a time slot (sample time of the simulation)
+ */
+ReservationTable::ReservationTable(const double &T) :
+    m_T(T),
+    m_firstWord(0)
+{
+}
+
+/**
+ * @brief ReservationTable::getSlot maps the time to its discretized time slot
+ * @param time
+ * @return slot index
+ */
+int64_t ReservationTable::getSlot(const double &time) const {
+    return static_cast<int64_t>(std::llround(time / m_T));
+}
+
+/**
+ * @brief ReservationTable::getCarSlots
+ * @param car
+ * @return sorted reserved slots of the car, nullptr if the car has never reserved a slot here
+ */
+const std::set<int64_t>* ReservationTable::getCarSlots(const CarId &car) const {
+    if (car >= m_carSlots.size()) {
+        return nullptr;
+    }
+    return &m_carSlots[car];
+}
+
+/**
+ * @brief ReservationTable::isSlotReserved looks up the bitmap
+ * @param slot
+ * @return true, if slot is reserved
+ */
+bool ReservationTable::isSlotReserved(const int64_t &slot) const {
+    const int64_t word = floorDiv(slot, slotsPerWord) - m_firstWord;
+    if (word < 0 || word >= static_cast<int64_t>(m_occupied.size())) {
+        return false;
+    }
+    const int64_t bit = slot - (m_firstWord + word) * slotsPerWord;
+    return (m_occupied[word] >> bit) & 1u;
+}
+
+/**
+ * @brief ReservationTable::setSlot sets the bit of the slot, the bitmap grows to the front or back if necessary
+ * @param slot
+ * @param reserved
+ */
+void ReservationTable::setSlot(const int64_t &slot, const bool &reserved) {
+    const int64_t wordIndex = floorDiv(slot, slotsPerWord);
+    if (m_occupied.empty()) {
+        m_firstWord = wordIndex;
+        m_occupied.push_back(0);
+    }
+    else if (wordIndex < m_firstWord) {
+        m_occupied.insert(m_occupied.begin(), m_firstWord - wordIndex, 0);
+        m_firstWord = wordIndex;
+    }
+    else if (wordIndex - m_firstWord >= static_cast<int64_t>(m_occupied.size())) {
+        m_occupied.resize(wordIndex - m_firstWord + 1, 0);
+    }
+    const int64_t bit = slot - wordIndex * slotsPerWord;
+    uint64_t& word = m_occupied[wordIndex - m_firstWord];
+    if (reserved) {
+        word |= (uint64_t(1) << bit);
+    }
+    else {
+        word &= ~(uint64_t(1) << bit);
+    }
+}
+
+/**
+ * @brief ReservationTable::isReserved
+ * @param time
+ * @return true, if the time slot of time is reserved by any car
+ */
+bool ReservationTable::isReserved(const double &time) const {
+    return isSlotReserved(getSlot(time));
+}
+
+/**
+ * @brief ReservationTable::isReservedByOtherCar
+ * @param car
+ * @param time
+ * @return true, if the time slot of time is reserved by a car other than the given one
+ */
+bool ReservationTable::isReservedByOtherCar(const CarId &car, const double &time) const {
+    const int64_t slot = getSlot(time);
+    if (!isSlotReserved(slot)) {
+        return false;
+    }
+    return m_entries.at(slot).car != car;
+}
+
+/**
+ * @brief ReservationTable::getCar
+ * @param time
+ * @return ID of the car, which has reserved the time slot of time, noCarId if the slot is free
+ */
+CarId ReservationTable::getCar(const double &time) const {
+    const int64_t slot = getSlot(time);
+    if (!isSlotReserved(slot)) {
+        return noCarId;
+    }
+    return m_entries.at(slot).car;
+}
+
+/**
+ * @brief ReservationTable::reserve reserves the time slot for the car
+ * @param car
+ * @param time
+ * @return true, if time is reserved, false, if the time slot is already reserved
+ */
+bool ReservationTable::reserve(const CarId &car, const double &time) {
+    const int64_t slot = getSlot(time);
+    if (isSlotReserved(slot)) {
+        return false;
+    }
+    if (car >= m_carSlots.size()) {
+        m_carSlots.resize(car + 1);
+    }
+    m_entries[slot] = Entry{car, time};
+    m_carSlots[car].insert(slot);
+    setSlot(slot, true);
+    return true;
+}
+
+/**
+ * @brief ReservationTable::hasReservationFrom
+ * @param car
+ * @param time lower bound
+ * @return true, if the car has reserved a slot at or after time
+ */
+bool ReservationTable::hasReservationFrom(const CarId &car, const double &time) const {
+    const std::set<int64_t>* slots = getCarSlots(car);
+    return slots && slots->lower_bound(getSlot(time)) != slots->end();
+}
+
+/**
+ * @brief ReservationTable::getTimeForCar
+ * @param car
+ * @param time lower bound
+ * @return first reserved time of the car at or after time, -1.0 if there is none
+ */
+double ReservationTable::getTimeForCar(const CarId &car, const double &time) const {
+    const std::set<int64_t>* slots = getCarSlots(car);
+    if (!slots) {
+        return -1.0;
+    }
+    std::set<int64_t>::const_iterator it = slots->lower_bound(getSlot(time));
+    if (it == slots->end()) {
+        return -1.0;
+    }
+    return m_entries.at(*it).time;
+}
+
+/**
+ * @brief ReservationTable::getNextFreeTime scans the bitmap word by word for the first free slot
+ * @param start
+ * @return start + k * T for the smallest k with a free slot
+ */
+double ReservationTable::getNextFreeTime(const double &start) const {
+    const int64_t startSlot = getSlot(start);
+    int64_t word = floorDiv(startSlot, slotsPerWord) - m_firstWord;
+    int64_t freeSlot = startSlot;
+    if (word >= 0 && word < static_cast<int64_t>(m_occupied.size())) {
+        const int64_t startBit = startSlot - (m_firstWord + word) * slotsPerWord;
+        //slots before the start count as reserved
+        uint64_t bits = m_occupied[word] | ((uint64_t(1) << startBit) - 1);
+        while (bits == ~uint64_t(0) && ++word < static_cast<int64_t>(m_occupied.size())) {
+            bits = m_occupied[word];
+        }
+        if (word == static_cast<int64_t>(m_occupied.size())) {
+            freeSlot = (m_firstWord + word) * slotsPerWord;
+        }
+        else {
+            int64_t bit = 0;
+            while ((bits >> bit) & 1u) {
+                bit++;
+            }
+            freeSlot = (m_firstWord + word) * slotsPerWord + bit;
+        }
+    }
+    return start + static_cast<double>(freeSlot - startSlot) * m_T;
+}
+
+/**
+ * @brief ReservationTable::releaseSlot removes the reservation of the slot
+ * @param slot
+ */
+void ReservationTable::releaseSlot(const int64_t &slot) {
+    m_entries.erase(slot);
+    setSlot(slot, false);
+}
+
+/**
+ * @brief ReservationTable::removeFirst removes the earliest reservation of the car
+ * @param car
+ * @return true, if a reservation of the car was found and removed
+ */
+bool ReservationTable::removeFirst(const CarId &car) {
+    if (car >= m_carSlots.size() || m_carSlots[car].empty()) {
+        return false;
+    }
+    std::set<int64_t>& slots = m_carSlots[car];
+    releaseSlot(*slots.begin());
+    slots.erase(slots.begin());
+    return true;
+}
+
+/**
+ * @brief ReservationTable::removeCar removes all reservations of the car
+ * @param car
+ * @return number of removed reservations
+ */
+unsigned int ReservationTable::removeCar(const CarId &car) {
+    if (car >= m_carSlots.size()) {
+        return 0;
+    }
+    std::set<int64_t>& slots = m_carSlots[car];
+    const unsigned int removed = slots.size();
+    for (const int64_t& slot : slots) {
+        releaseSlot(slot);
+    }
+    slots.clear();
+    return removed;
+}
+
+/**
+ * @brief ReservationTable::clear removes all reservations, the slot width is kept
+ */
+void ReservationTable::clear() {
+    m_entries.clear();
+    m_occupied.clear();
+    m_firstWord = 0;
+    m_carSlots.clear();
+}
+
+/**
+ * @brief ReservationTable::size
+ * @return number of reserved slots
+ */
+unsigned int ReservationTable::size() const {
+    return m_entries.size();
+}
+
+/**
+ * @brief ReservationTable::getReservationCells returns the reservations ordered by time, e.g. for printing
+ * @return reservations
+ */
+QVector<ReservationCell> ReservationTable::getReservationCells() const {
+    std::vector<int64_t> slots;
+    slots.reserve(m_entries.size());
+    for (const std::pair<const int64_t, Entry>& entry : m_entries) {
+        slots.push_back(entry.first);
+    }
+    std::sort(slots.begin(), slots.end());
+    QVector<ReservationCell> cells;
+    cells.reserve(slots.size());
+    for (const int64_t& slot : slots) {
+        const Entry& entry = m_entries.at(slot);
+        cells.append(ReservationCell(entry.car, entry.time));
+    }
+    return cells;
+}
@@ -0,0 +1,61 @@
+#ifndef RESERVATIONTABLE_H
+#define RESERVATIONTABLE_H
+
+#include "reservationcell.h"
+#include "carid.h"
+
+#include <QtCore/QVector>
+
+#include <cstdint>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief The ReservationTable class stores the reservations of one cell indexed by the discretized time slot
+ * round(time / T). Reserving and querying a slot is O(1), the occupancy of the slots is kept in a bitmap,
+ * so getNextFreeTime skips 64 reserved slots at once. The cars are given by their CarId, for each car the
+ * reserved slots are kept sorted to answer "first reservation of car after t".
+ */
+class ReservationTable
+{
+public:
+    ReservationTable(const double& T);
+    bool isReserved(const double& time) const;
+    bool isReservedByOtherCar(const CarId& car, const double& time) const;
+    CarId getCar(const double& time) const;
+    bool reserve(const CarId& car, const double& time);
+    bool hasReservationFrom(const CarId& car, const double& time) const;
+    double getTimeForCar(const CarId& car, const double& time) const;
+    double getNextFreeTime(const double& start) const;
+    bool removeFirst(const CarId& car);
+    unsigned int removeCar(const CarId& car);
+    void clear();
+    unsigned int size() const;
+    QVector<ReservationCell> getReservationCells() const;
+private:
+    /**
+     * @brief The Entry struct is the owner of a reserved slot with the exact reserved time
+     */
+    struct Entry {
+        CarId car;
+        double time;
+    };
+    int64_t getSlot(const double& time) const;
+    const std::set<int64_t>* getCarSlots(const CarId& car) const;
+    bool isSlotReserved(const int64_t& slot) const;
+    void setSlot(const int64_t& slot, const bool& reserved);
+    void releaseSlot(const int64_t& slot);
+    ///width of a time slot
+    double m_T;
+    ///reserved slots with owner and time
+    std::unordered_map<int64_t, Entry> m_entries;
+    ///occupancy bitmap, bit i of word w describes slot 64 * (m_firstWord + w) + i
+    std::vector<uint64_t> m_occupied;
+    ///index of the first word in the bitmap
+    int64_t m_firstWord;
+    ///sorted reserved slots by car ID
+    std::vector<std::set<int64_t> > m_carSlots;
+};
+
+#endif // RESERVATIONTABLE_H
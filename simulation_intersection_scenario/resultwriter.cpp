@@ -0,0 +1,147 @@
+#include "resultwriter.h"
+
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+
+/**
+ * @brief ResultWriter::ResultWriter creates the output directory, if it does not exist
+ * @param outputDir directory for the result files
+ */
+ResultWriter::ResultWriter(const QString& outputDir) :
+    m_dir(outputDir),
+    m_valid(false)
+{
+    m_valid = m_dir.mkpath(".");
+}
+
+/**
+ * @brief ResultWriter::isValid
+ * @return true, if the output directory exists
+ */
+bool ResultWriter::isValid() const {
+    return m_valid;
+}
+
+/**
+ * @brief ResultWriter::getOutputDir
+ * @return absolute path of the output directory
+ */
+QString ResultWriter::getOutputDir() const {
+    return m_dir.absolutePath();
+}
+
+/**
+ * @brief ResultWriter::addState stores the applied state x of car at time t
+ * @param car
+ * @param t
+ * @param x
+ */
+void ResultWriter::addState(const QString& car, const double& t, const std::vector<double>& x) {
+    m_states.push_back({car, t, x});
+}
+
+/**
+ * @brief ResultWriter::setSummaryValue sets or replaces a value of the summary
+ * @param key
+ * @param value
+ */
+void ResultWriter::setSummaryValue(const QString& key, const QVariant& value) {
+    if (!m_summary.contains(key)) {
+        m_summaryKeys.append(key);
+    }
+    m_summary.insert(key, value);
+}
+
+/**
+ * @brief ResultWriter::getSummaryKeys
+ * @return keys of the summary in insertion order
+ */
+QStringList ResultWriter::getSummaryKeys() const {
+    return m_summaryKeys;
+}
+
+/**
+ * @brief ResultWriter::getSummaryValue
+ * @param key
+ * @return value of the summary, invalid QVariant if not set
+ */
+QVariant ResultWriter::getSummaryValue(const QString& key) const {
+    return m_summary.value(key);
+}
+
+/**
+ * @brief ResultWriter::writeTrajectories writes the applied states as car,t,x0,x1,...
+ * @param fileName
+ * @return true, if the file could be written
+ */
+bool ResultWriter::writeTrajectories(const QString& fileName) const {
+    QFile file(m_dir.filePath(fileName));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return false;
+    }
+    QTextStream out(&file);
+    out << "car,t";
+    size_t dim = m_states.empty() ? 0 : m_states.front().x.size();
+    for (size_t j = 0; j < dim; j++) {
+        out << ",x" << j;
+    }
+    out << endl;
+    for (const TrajectoryEntry& entry : m_states) {
+        out << entry.car << "," << entry.t;
+        for (const double& val : entry.x) {
+            out << "," << val;
+        }
+        out << endl;
+    }
+    return true;
+}
+
+/**
+ * @brief ResultWriter::writeCosts writes the costs of each car and step as car,step,costs
+ * @param costs costs per car for each step
+ * @param fileName
+ * @return true, if the file could be written
+ */
+bool ResultWriter::writeCosts(const std::map<QString, std::vector<double> >& costs, const QString& fileName) const {
+    QFile file(m_dir.filePath(fileName));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return false;
+    }
+    QTextStream out(&file);
+    out << "car,step,costs" << endl;
+    for (auto it = costs.begin(); it != costs.end(); it++) {
+        for (size_t i = 0; i < it->second.size(); i++) {
+            out << it->first << "," << i << "," << it->second.at(i) << endl;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief ResultWriter::writeSummary writes the summary as one header line and one value line
+ * @param fileName
+ * @return true, if the file could be written
+ */
+bool ResultWriter::writeSummary(const QString& fileName) const {
+    QFile file(m_dir.filePath(fileName));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return false;
+    }
+    QTextStream out(&file);
+    QStringList values;
+    for (const QString& key : m_summaryKeys) {
+        values.append(m_summary.value(key).toString());
+    }
+    out << m_summaryKeys.join(",") << endl;
+    out << values.join(",") << endl;
+    return true;
+}
+
+/**
+ * @brief ResultWriter::clear removes the collected states and the summary
+ */
+void ResultWriter::clear() {
+    m_states.clear();
+    m_summaryKeys.clear();
+    m_summary.clear();
+}
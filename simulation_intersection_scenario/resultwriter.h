@@ -0,0 +1,51 @@
+#ifndef RESULTWRITER_H
+#define RESULTWRITER_H
+
+#include <QtCore/QDir>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVariant>
+
+#include <map>
+#include <vector>
+
+/**
+ * @brief The ResultWriter class collects the results of a simulation run, which is started without GUI,
+ * and writes them as CSV-files into an output directory (trajectories, costs per car and step, summary)
+ */
+class ResultWriter
+{
+public:
+    ResultWriter(const QString& outputDir);
+    bool isValid() const;
+    QString getOutputDir() const;
+    void addState(const QString& car, const double& t, const std::vector<double>& x);
+    void setSummaryValue(const QString& key, const QVariant& value);
+    QStringList getSummaryKeys() const;
+    QVariant getSummaryValue(const QString& key) const;
+    bool writeTrajectories(const QString& fileName = "trajectories.csv") const;
+    bool writeCosts(const std::map<QString, std::vector<double> >& costs, const QString& fileName) const;
+    bool writeSummary(const QString& fileName = "summary.csv") const;
+    void clear();
+private:
+    /**
+     * @brief The TrajectoryEntry struct is one applied state of a car
+     */
+    struct TrajectoryEntry {
+        QString car;
+        double t;
+        std::vector<double> x;
+    };
+    ///directory of the result files
+    QDir m_dir;
+    ///directory could be created
+    bool m_valid;
+    ///applied states of all cars in order of the simulation
+    std::vector<TrajectoryEntry> m_states;
+    ///keys of the summary in insertion order
+    QStringList m_summaryKeys;
+    ///summary values (e.g. parameters of the run, cumulated costs)
+    QMap<QString, QVariant> m_summary;
+};
+
+#endif // RESULTWRITER_H
@@ -0,0 +1,174 @@
+#include "shortestpathtable.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+const uint32_t ShortestPathTable::noCell = std::numeric_limits<uint32_t>::max();
+constexpr size_t ShortestPathTable::blockSize;
+
+/**
+ * @brief ShortestPathTable::ShortestPathTable computes the table for a grid with gridWidth x gridHeight cells
+ * @param gridWidth number of cells in k-direction
+ * @param gridHeight number of cells in m-direction
+ */
+ShortestPathTable::ShortestPathTable(const unsigned int& gridWidth, const unsigned int& gridHeight) :
+    m_gridWidth(gridWidth),
+    m_gridHeight(gridHeight),
+    m_numCells((size_t)gridWidth * gridHeight),
+    m_distance(m_numCells * m_numCells, std::numeric_limits<double>::infinity()),
+    m_next(m_numCells * m_numCells, noCell)
+{
+    initializeEdges();
+    computeAllPairs();
+}
+
+/**
+ * @brief ShortestPathTable::getGridWidth
+ * @return
+ */
+unsigned int ShortestPathTable::getGridWidth() const {
+    return m_gridWidth;
+}
+
+/**
+ * @brief ShortestPathTable::getGridHeight
+ * @return
+ */
+unsigned int ShortestPathTable::getGridHeight() const {
+    return m_gridHeight;
+}
+
+/**
+ * @brief ShortestPathTable::getNumberOfCells
+ * @return
+ */
+size_t ShortestPathTable::getNumberOfCells() const {
+    return m_numCells;
+}
+
+/**
+ * @brief ShortestPathTable::getDistance
+ * @param from cell index
+ * @param to cell index
+ * @return length of the shortest path, infinity if there is none
+ */
+double ShortestPathTable::getDistance(const size_t& from, const size_t& to) const {
+    return m_distance[from * m_numCells + to];
+}
+
+/**
+ * @brief ShortestPathTable::getNextHop
+ * @param from cell index
+ * @param to cell index
+ * @return first cell after from on the shortest path, noCell if there is none
+ */
+size_t ShortestPathTable::getNextHop(const size_t& from, const size_t& to) const {
+    const uint32_t next = m_next[from * m_numCells + to];
+    return next == noCell ? std::numeric_limits<size_t>::max() : next;
+}
+
+/**
+ * @brief ShortestPathTable::getPath follows the next hops
+ * @param from cell index
+ * @param to cell index
+ * @return cells of the shortest path without from and with to, empty if from == to or if to is not reachable
+ */
+std::vector<size_t> ShortestPathTable::getPath(const size_t& from, const size_t& to) const {
+    std::vector<size_t> path;
+    if (from >= m_numCells || to >= m_numCells || m_next[from * m_numCells + to] == noCell) {
+        return path;
+    }
+    size_t current = from;
+    while (current != to) {
+        current = m_next[current * m_numCells + to];
+        path.push_back(current);
+    }
+    return path;
+}
+
+/**
+ * @brief ShortestPathTable::initializeEdges sets the distances of each cell to itself and to its neighbours (radius 1)
+ */
+void ShortestPathTable::initializeEdges() {
+    for (unsigned int k = 0; k < m_gridWidth; k++) {
+        for (unsigned int m = 0; m < m_gridHeight; m++) {
+            const size_t from = (size_t)k * m_gridHeight + m;
+            m_distance[from * m_numCells + from] = 0.0;
+            m_next[from * m_numCells + from] = from;
+            for (int dk = -1; dk <= 1; dk++) {
+                for (int dm = -1; dm <= 1; dm++) {
+                    const int nk = (int)k + dk;
+                    const int nm = (int)m + dm;
+                    if ((dk == 0 && dm == 0) || nk < 0 || nm < 0 || nk >= (int)m_gridWidth || nm >= (int)m_gridHeight) {
+                        continue;
+                    }
+                    const size_t to = (size_t)nk * m_gridHeight + nm;
+                    m_distance[from * m_numCells + to] = std::sqrt((double)(dk * dk + dm * dm));
+                    m_next[from * m_numCells + to] = to;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief ShortestPathTable::computeAllPairs blocked Floyd-Warshall: for each diagonal tile kb first the tile itself is relaxed,
+ * then the tiles in row and column kb (depend only on the diagonal tile), then all remaining tiles (depend only on row and column kb).
+ * The tiles of one phase are independent and relaxed in parallel.
+ */
+void ShortestPathTable::computeAllPairs() {
+    const long numBlocks = (long)((m_numCells + blockSize - 1) / blockSize);
+    for (long kb = 0; kb < numBlocks; kb++) {
+        relaxBlock(kb, kb, kb);
+        #pragma omp parallel for schedule(static)
+        for (long b = 0; b < numBlocks; b++) {
+            if (b != kb) {
+                relaxBlock(kb, b, kb);
+                relaxBlock(b, kb, kb);
+            }
+        }
+        #pragma omp parallel for schedule(static)
+        for (long ib = 0; ib < numBlocks; ib++) {
+            if (ib == kb) {
+                continue;
+            }
+            for (long jb = 0; jb < numBlocks; jb++) {
+                if (jb != kb) {
+                    relaxBlock(ib, jb, kb);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief ShortestPathTable::relaxBlock relaxes the tile (iBlock, jBlock) over the intermediate cells of the tile kBlock
+ * @param iBlock tile of the start cells
+ * @param jBlock tile of the end cells
+ * @param kBlock tile of the intermediate cells
+ */
+void ShortestPathTable::relaxBlock(const size_t& iBlock, const size_t& jBlock, const size_t& kBlock) {
+    const size_t iEnd = std::min((iBlock + 1) * blockSize, m_numCells);
+    const size_t jEnd = std::min((jBlock + 1) * blockSize, m_numCells);
+    const size_t kEnd = std::min((kBlock + 1) * blockSize, m_numCells);
+    for (size_t k = kBlock * blockSize; k < kEnd; k++) {
+        const double* distanceK = &m_distance[k * m_numCells];
+        for (size_t i = iBlock * blockSize; i < iEnd; i++) {
+            double* distanceI = &m_distance[i * m_numCells];
+            const double distanceIK = distanceI[k];
+            if (distanceIK == std::numeric_limits<double>::infinity()) {
+                continue;
+            }
+            const uint32_t nextIK = m_next[i * m_numCells + k];
+            uint32_t* nextI = &m_next[i * m_numCells];
+            for (size_t j = jBlock * blockSize; j < jEnd; j++) {
+                const double candidate = distanceIK + distanceK[j];
+                if (candidate < distanceI[j]) {
+                    distanceI[j] = candidate;
+                    nextI[j] = nextIK;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef SHORTESTPATHTABLE_H
+#define SHORTESTPATHTABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The ShortestPathTable class holds the distances and next hops between all pairs of cells of the intersection grid
+ * (8-neighbourhood, euclidian step costs), computed once by a blocked Floyd-Warshall algorithm. The cells are numbered like
+ * InterSection::getCellIndex. The table only depends on the grid dimensions, it is built by the InterSection and shared
+ * read-only by all cars, a path is read by following the next hops in O(path length).
+ * Memory: \f$ V^2 \f$ distances and next hops for V cells.
+ */
+class ShortestPathTable
+{
+public:
+    ///next hop, if there is no path
+    static const uint32_t noCell;
+    ///edge length of the square tiles of the blocked algorithm, a tile of distances fits into the L1 cache
+    static constexpr size_t blockSize = 32;
+
+    ShortestPathTable(const unsigned int& gridWidth, const unsigned int& gridHeight);
+    unsigned int getGridWidth() const;
+    unsigned int getGridHeight() const;
+    size_t getNumberOfCells() const;
+    double getDistance(const size_t& from, const size_t& to) const;
+    size_t getNextHop(const size_t& from, const size_t& to) const;
+    std::vector<size_t> getPath(const size_t& from, const size_t& to) const;
+private:
+    void initializeEdges();
+    void computeAllPairs();
+    void relaxBlock(const size_t& iBlock, const size_t& jBlock, const size_t& kBlock);
+    ///number of cells in k-direction
+    unsigned int m_gridWidth;
+    ///number of cells in m-direction
+    unsigned int m_gridHeight;
+    ///number of cells V
+    size_t m_numCells;
+    ///distances V x V, row-major by the start cell
+    std::vector<double> m_distance;
+    ///first cell after the start cell on the shortest path, V x V
+    std::vector<uint32_t> m_next;
+};
+
+#endif // SHORTESTPATHTABLE_H
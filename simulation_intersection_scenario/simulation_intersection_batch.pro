@@ -0,0 +1,19 @@
+#-------------------------------------------------
+#
+# headless batch runner of the intersection scenario,
+# runs one simulation without GUI and writes the results to files
+#
+#-------------------------------------------------
+
+TARGET = simulation_intersection_batch
+CONFIG   += console
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+include(simulation_intersection_scenario.pri)
+
+#the plots of the evaluation are left out, only QtCore and QtSql are linked
+DEFINES += INTERSECTION_HEADLESS
+
+SOURCES += batchmain.cpp
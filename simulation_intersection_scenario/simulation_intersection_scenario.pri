@@ -0,0 +1,203 @@
+#-------------------------------------------------
+#
+# common sources and settings of the intersection scenario,
+# shared by the GUI application and the headless batch runner
+#
+#-------------------------------------------------
+
+QT       += core sql
+QT       -= gui
+
+QMAKE_CXXFLAGS += -std=gnu++11 -Wall -Wextra -pedantic -g
+#OpenMP for the parallel computation of the shortest path table
+QMAKE_CXXFLAGS += -fopenmp
+QMAKE_LFLAGS += -fopenmp
+
+INCLUDEPATH += $$PWD/../simulation_core/
+INCLUDEPATH += $$PWD/../simulatoren_extern/
+INCLUDEPATH += $$PWD/../simulatoren_extern/optimize/
+INCLUDEPATH += $$PWD/../simulatoren_extern/google/src
+INCLUDEPATH += $$PWD/../simulatoren_extern/optimize/nlopt/api
+INCLUDEPATH += $$PWD/../simulation-core/
+
+DEPENDPATH += ../simulation_core/
+
+#output directory of the simulation core library and the applications,
+#projects in subdirectories (tests) set it before including this file
+isEmpty(CUSTOUTPWD) {
+  CUSTOUTPWD = $$OUT_PWD/../out
+}
+
+#each application keeps its own object files, as both are built from the same sources
+OBJECTS_DIR = obj/$$TARGET
+MOC_DIR = moc/$$TARGET
+
+win32 {
+ CONFIG(debug, debug|release) {
+  message(DEBUG selected)
+  DESTDIR = $$OUT_PWD/debug
+  QMAKE_CXXFLAGS += -g
+ }
+ else {
+  message(RELEASE selected)
+  DESTDIR = $$OUT_PWD/release
+ }
+}
+
+
+SOURCES += \
+    $$PWD/intersection.cpp \
+    $$PWD/intersectioncell.cpp \
+    $$PWD/reservationcell.cpp \
+    $$PWD/reservationtable.cpp \
+    $$PWD/conflictindex.cpp \
+    $$PWD/conflictresolver.cpp \
+    $$PWD/solvercontext.cpp \
+    $$PWD/constraintbox.cpp \
+    $$PWD/constraintstore.cpp \
+    $$PWD/gridsearchstate.cpp \
+    $$PWD/shortestpathtable.cpp \
+    $$PWD/distancefield.cpp \
+    $$PWD/path.cpp \
+    $$PWD/pathitem.cpp \
+    $$PWD/car.cpp \
+    $$PWD/mpccontroller.cpp \
+    $$PWD/pathcalculation.cpp \
+    $$PWD/astarpathcalculation.cpp \
+    $$PWD/costfunction.cpp \
+    $$PWD/systemfunction.cpp \
+    $$PWD/pathcontrolmap.cpp \
+    $$PWD/constraint.cpp \
+    $$PWD/constraintfunction.cpp \
+    $$PWD/evaluation.cpp \
+    $$PWD/simulationthread.cpp \
+    $$PWD/carinformation.cpp \
+    $$PWD/intersectionparameters.cpp \
+    $$PWD/costcriteria.cpp \
+    $$PWD/databasethread.cpp \
+    $$PWD/constraintmin.cpp \
+    $$PWD/constraintmax.cpp \
+    $$PWD/prioritysorter.cpp \
+    $$PWD/constraintdirectional.cpp \
+    $$PWD/arrivalcar.cpp \
+    $$PWD/enterintersectiondist.cpp \
+    $$PWD/distparam.cpp \
+    $$PWD/floydwarshallpathcalculation.cpp \
+    $$PWD/dstarlite.cpp \
+    $$PWD/cargroupqueue.cpp \
+    $$PWD/cargroup.cpp \
+    $$PWD/trajectory.cpp \
+    $$PWD/trajectorycache.cpp \
+    $$PWD/integrator.cpp \
+    $$PWD/resultwriter.cpp \
+    $$PWD/sweepengine.cpp \
+    $$PWD/simulationcontext.cpp
+
+HEADERS += \
+    $$PWD/intersection.h \
+    $$PWD/intersectioncell.h \
+    $$PWD/reservationcell.h \
+    $$PWD/reservationtable.h \
+    $$PWD/conflictindex.h \
+    $$PWD/conflictresolver.h \
+    $$PWD/solvercontext.h \
+    $$PWD/constraintbox.h \
+    $$PWD/constraintstore.h \
+    $$PWD/gridsearchstate.h \
+    $$PWD/shortestpathtable.h \
+    $$PWD/indexedminheap.h \
+    $$PWD/distancefield.h \
+    $$PWD/path.h \
+    $$PWD/pathitem.h \
+    $$PWD/car.h \
+    $$PWD/mpccontroller.h \
+    $$PWD/pathcalculation.h \
+    $$PWD/astarpathcalculation.h \
+    $$PWD/costfunction.h \
+    $$PWD/systemfunction.h \
+    $$PWD/pathcontrolmap.h \
+    $$PWD/constraint.h \
+    $$PWD/constraintfunction.h \
+    $$PWD/evaluation.h \
+    $$PWD/simulationthread.h \
+    $$PWD/intersectionparameters.h \
+    $$PWD/carinformation.h \
+    $$PWD/costcriteria.h \
+    $$PWD/databasethread.h \
+    $$PWD/constraintmin.h \
+    $$PWD/constraintmax.h \
+    $$PWD/prioritysorter.h \
+    $$PWD/constraintdirectional.h \
+    $$PWD/arrivalcar.h \
+    $$PWD/enterintersectiondist.h \
+    $$PWD/distparam.h \
+    $$PWD/floydwarshallpathcalculation.h \
+    $$PWD/dstarlite.h \
+    $$PWD/cargroupqueue.h \
+    $$PWD/cargroup.h \
+    $$PWD/trajectory.h \
+    $$PWD/trajectorycache.h \
+    $$PWD/integrator.h \
+    $$PWD/resultwriter.h \
+    $$PWD/sweepengine.h \
+    $$PWD/simulationcontext.h \
+    $$PWD/carid.h
+
+
+unix {
+LIBS += -L"$$CUSTOUTPWD" -L"$$PWD/../simulatoren_extern/google/src/.libs" -lsimulation_core -lpthread -lnlopt#Core-Library for the basic simulation functions and NLOpt-package and NLOpt-package
+}
+win32 {
+  LIBS += -L"$$CUSTOUTPWD" -L"$$PWD/../simulatoren_extern/google/src/.libs" -lsimulation_core -lnlopt-0 #Core-Library for the basic simulation functions and NLOpt-package
+}
+
+#as there system calls in windows does not accept / in paths,
+#encapsulation with double quotes is necessary
+#but built-in functions of qmake like exists cannot handle double-quote paths
+#therefore CUSTOUTPWDWIN with quotes and CUSTOUTPWD without quotes
+CUSTOUTPWDWIN = \"$$CUSTOUTPWD\"
+unix {
+  mkdirs = $$CUSTOUTPWD
+}
+win32 {
+mkdirs = $$CUSTOUTPWDWIN
+}
+
+unix {
+  QMAKE_EXTRA_TARGETS += createDirs
+  PRE_TARGETDEPS += createDirs
+}
+win32 {
+ #workaround for mkdir -p
+ !exists($$CUSTOUTPWD) {
+  message($$CUSTOUTPWD)
+  QMAKE_EXTRA_TARGETS += createDirs
+  PRE_TARGETDEPS += createDirs
+ }
+ exists($$CUSTOUTPWD) {
+  message(out-dir exists.)
+ }
+}
+
+nlopt.target = libnlopt-0.*
+nlopt.commands = $(COPY) $$shell_path($$PWD/../simulatoren_extern/optimize/nlopt/$$nlopt.target) $$shell_path($$OUT_PWD/../out/)
+#message ($$shell_path($$PWD/../simulatoren_extern/optimize/nlopt/$$nlopt.target))
+
+
+#message($$nlopt.target)
+
+#the tests are not copied to the output directory
+!testcase {
+unix {
+  QMAKE_POST_LINK += $(COPY) -P $$OUT_PWD/$$TARGET $$CUSTOUTPWD
+}
+win32 {
+  SOURCEWINPATH = $$shell_path($$DESTDIR/$${TARGET}.exe)
+  TARGETWINPATH = $$shell_path($$CUSTOUTPWD)
+  QMAKE_POST_LINK += $(COPY) $$SOURCEWINPATH $$TARGETWINPATH
+}
+}
+win32 {
+  QMAKE_EXTRA_TARGETS += nlopt #here the internal qmake target has to be taken (nothing to do with Make!)
+  PRE_TARGETDEPS += $$nlopt.target #here the filename has to be taken as in Makefile
+}
@@ -0,0 +1,76 @@
+#include "astarpathcalculationtest.h"
+#include "../astarpathcalculation.h"
+#include "../intersection.h"
+#include "../intersectionparameters.h"
+#include "../simulationcontext.h"
+
+namespace {
+/**
+ * @brief makeContext creates a simulation with a width x height grid of cells with size 1
+ * @return
+ */
+std::shared_ptr<SimulationContext> makeContext(const unsigned int& width, const unsigned int& height) {
+    std::shared_ptr<InterSection> interSection = std::make_shared<InterSection>(width, height);
+    interSection->buildGrid(width, height, 1.0);
+    return std::make_shared<SimulationContext>(interSection);
+}
+
+/**
+ * @brief calculateWindow plans the decentralized path of car0 from start to target at time 0 with horizon N and sampling interval T
+ * @return
+ */
+Path calculateWindow(const std::shared_ptr<SimulationContext>& context, const PathItem& start, const PathItem& target,
+                     const size_t& N = InterSectionParameters::N, const double& T = InterSectionParameters::T) {
+    std::shared_ptr<InterSection> grid = context->getInterSection();
+    AStarPathCalculation astar("car0", start, target, N, T, PathAlgorithm::ASTARDECENTRALZED, context);
+    return astar.calculatePath(grid, grid->getInterSectionCell(start.getX(), start.getY()),
+                               grid->getInterSectionCell(target.getX(), target.getY()));
+}
+}
+
+AStarPathCalculationTest::AStarPathCalculationTest()
+{
+}
+
+void AStarPathCalculationTest::spaceTimePathAroundReservation() {
+    const double T = InterSectionParameters::T;
+    //corridor: car1 holds the middle cell in the next step, so car0 waits
+    std::shared_ptr<SimulationContext> context = makeContext(3, 1);
+    context->getInterSection()->tryReservePrelimTimeForCar(context->registerCarName("car1"), 1, 0, T);
+    Path window = calculateWindow(context, PathItem(0, 0, 0.0), PathItem(2, 0, 0.0));
+    QCOMPARE(window.size(), (size_t)3);
+    QVERIFY(window.front() == PathItem(0, 0, T));
+    QVERIFY(window.back() == PathItem(2, 0, 3 * T));
+    //with a free row, car0 routes around the reserved cell
+    context = makeContext(3, 3);
+    context->getInterSection()->tryReservePrelimTimeForCar(context->registerCarName("car1"), 1, 0, T);
+    window = calculateWindow(context, PathItem(0, 0, 0.0), PathItem(2, 0, 0.0));
+    QCOMPARE(window.size(), (size_t)2);
+    QVERIFY(window.front() == PathItem(1, 1, T));
+    QVERIFY(window.back() == PathItem(2, 0, 2 * T));
+}
+
+void AStarPathCalculationTest::spaceTimePathWithoutSwap() {
+    const double T = InterSectionParameters::T;
+    //car1 moves from (2,0) to (1,0), car0 in (1,0) must not move to (2,0) at the same time
+    std::shared_ptr<SimulationContext> context = makeContext(4, 1);
+    std::shared_ptr<InterSection> grid = context->getInterSection();
+    grid->tryReservePrelimTimeForCar(context->registerCarName("car0"), 1, 0, 0.0);
+    const CarId car1 = context->registerCarName("car1");
+    grid->tryReservePrelimTimeForCar(car1, 2, 0, 0.0);
+    grid->tryReservePrelimTimeForCar(car1, 1, 0, T);
+    Path window = calculateWindow(context, PathItem(1, 0, 0.0), PathItem(3, 0, 0.0));
+    QVERIFY(window.front() != PathItem(2, 0, T));
+    QVERIFY(window.front() == PathItem(0, 0, T));
+}
+
+void AStarPathCalculationTest::spaceTimeWindowOfHorizon() {
+    //the window ends after N steps of length T, before the target is reached
+    const size_t N = 2;
+    const double T = 0.2;
+    std::shared_ptr<SimulationContext> context = makeContext(6, 1);
+    Path window = calculateWindow(context, PathItem(0, 0, 0.0), PathItem(5, 0, 0.0), N, T);
+    QCOMPARE(window.size(), N);
+    QVERIFY(window.front() == PathItem(1, 0, T));
+    QVERIFY(window.back() == PathItem(2, 0, 2 * T));
+}
@@ -0,0 +1,22 @@
+#ifndef ASTARPATHCALCULATIONTEST_H
+#define ASTARPATHCALCULATIONTEST_H
+
+#include <QtTest/QtTest>
+
+/**
+ * @brief The AStarPathCalculationTest class tests the windowed space-time search of the decentralized A*
+ */
+class AStarPathCalculationTest : public QObject
+{
+    Q_OBJECT
+public:
+    AStarPathCalculationTest();
+private slots:
+    void spaceTimePathAroundReservation();
+    void spaceTimePathWithoutSwap();
+    void spaceTimeWindowOfHorizon();
+private:
+
+};
+
+#endif // ASTARPATHCALCULATIONTEST_H
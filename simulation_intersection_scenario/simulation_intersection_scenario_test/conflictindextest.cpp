@@ -0,0 +1,80 @@
+#include "conflictindextest.h"
+#include "../conflictindex.h"
+#include "../car.h"
+#include "../intersection.h"
+#include "../intersectionparameters.h"
+#include "../simulationcontext.h"
+
+namespace {
+/**
+ * @brief makeCar creates a car planned by A*, its path is given to the index directly
+ * @return
+ */
+std::shared_ptr<Car> makeCar(const QString& name, const std::shared_ptr<SimulationContext>& context) {
+    return std::make_shared<Car>(name, PathItem(0, 0, 0.0), PathItem(3, 3, 0.0), 3, 0.1, PathAlgorithm::ASTARDECENTRALZED,
+                                 InterSectionParameters::T, std::make_pair(-1.0, 1.0), context);
+}
+
+/**
+ * @brief makePath
+ * @param cells (x, y, step) of the cells, the time is step * T
+ * @return
+ */
+Path makePath(const std::vector<std::vector<int> >& cells) {
+    Path path;
+    for (const std::vector<int>& cell : cells) {
+        path.addPathItem(PathItem(cell.at(0), cell.at(1), cell.at(2) * InterSectionParameters::T));
+    }
+    return path;
+}
+}
+
+ConflictIndexTest::ConflictIndexTest()
+{
+}
+
+void ConflictIndexTest::overlappingAndDisjointPaths() {
+    std::shared_ptr<InterSection> interSection = std::make_shared<InterSection>(4, 4);
+    interSection->buildGrid(4, 4, 1.0);
+    std::shared_ptr<SimulationContext> context = std::make_shared<SimulationContext>(interSection);
+    std::shared_ptr<Car> car0 = makeCar("car0", context);
+    std::shared_ptr<Car> car1 = makeCar("car1", context);
+    std::shared_ptr<Car> car2 = makeCar("car2", context);
+    std::shared_ptr<Car> car3 = makeCar("car3", context);
+    std::shared_ptr<Car> car4 = makeCar("car4", context);
+    ConflictIndex index(InterSectionParameters::T);
+    index.insert(car0, makePath({{0, 0, 1}, {1, 0, 2}, {2, 0, 3}}));
+    //car1 enters (1,0) at the same time as car0
+    index.insert(car1, makePath({{1, 1, 1}, {1, 0, 2}, {1, 1, 3}}));
+    //car2 is far away
+    index.insert(car2, makePath({{3, 3, 1}, {3, 2, 2}, {3, 1, 3}}));
+    //car3 uses the cells of car0 at other times
+    index.insert(car3, makePath({{0, 0, 2}, {1, 0, 3}, {2, 0, 4}}));
+    //a car is indexed only once
+    index.insert(car1, makePath({{3, 2, 2}}));
+    QCOMPARE(index.size(), (size_t)4);
+    QVERIFY(index.contains(car3));
+    QVERIFY(!index.contains(car4));
+
+    QVERIFY(index.hasConflict(car0, car1));
+    QVERIFY(index.hasConflict(car1, car0));
+    QVERIFY(!index.hasConflict(car0, car2));
+    QVERIFY(!index.hasConflict(car0, car3));
+    QVERIFY(!index.hasConflict(car1, car2));
+    QVERIFY(!index.hasConflict(car0, car0));
+    QVERIFY(!index.hasConflict(car0, car4));
+
+    std::vector<std::shared_ptr<Car> > conflicts = index.getConflictingCars(car0);
+    QCOMPARE(conflicts.size(), (size_t)1);
+    QVERIFY(conflicts.front() == car1);
+    conflicts = index.getConflictingCars(car1);
+    QCOMPARE(conflicts.size(), (size_t)1);
+    QVERIFY(conflicts.front() == car0);
+    QVERIFY(index.getConflictingCars(car2).empty());
+    QVERIFY(index.getConflictingCars(car3).empty());
+    QVERIFY(index.getConflictingCars(car4).empty());
+
+    index.clear();
+    QCOMPARE(index.size(), (size_t)0);
+    QVERIFY(!index.hasConflict(car0, car1));
+}
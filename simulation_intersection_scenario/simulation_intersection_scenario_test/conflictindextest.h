@@ -0,0 +1,20 @@
+#ifndef CONFLICTINDEXTEST_H
+#define CONFLICTINDEXTEST_H
+
+#include <QtTest/QtTest>
+
+/**
+ * @brief The ConflictIndexTest class tests the lookup of cars sharing a cell at the same time
+ */
+class ConflictIndexTest : public QObject
+{
+    Q_OBJECT
+public:
+    ConflictIndexTest();
+private slots:
+    void overlappingAndDisjointPaths();
+private:
+
+};
+
+#endif // CONFLICTINDEXTEST_H
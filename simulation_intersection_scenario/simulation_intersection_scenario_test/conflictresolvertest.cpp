@@ -0,0 +1,77 @@
+#include "conflictresolvertest.h"
+#include "../conflictresolver.h"
+
+#include <set>
+#include <tuple>
+
+namespace {
+/**
+ * @brief makeReserve reserves each cell and time only once
+ * @param reserved reserved cells with time
+ * @return reserve function for the ConflictResolver
+ */
+ConflictResolver::ReserveFunction makeReserve(std::set<std::tuple<int64_t, int64_t, double> >& reserved) {
+    return [&reserved](const size_t&, const PathItem& solution) {
+        return reserved.insert(std::make_tuple(solution.getX(), solution.getY(), solution.getTime())).second;
+    };
+}
+}
+
+ConflictResolverTest::ConflictResolverTest()
+{
+}
+
+void ConflictResolverTest::competeForOneCell() {
+    //car0 and car1 want to get to (1,0), car2 wants to get to the cell of car1
+    std::vector<ReservationRequest> requests({ReservationRequest{PathItem(0, 0, 0.0), PathItem(1, 0, 1.0)},
+                                              ReservationRequest{PathItem(2, 0, 0.0), PathItem(1, 0, 1.0)},
+                                              ReservationRequest{PathItem(3, 0, 0.0), PathItem(2, 0, 1.0)}});
+    std::set<std::tuple<int64_t, int64_t, double> > reserved;
+    unsigned int reoptimized = 0;
+    //the re-optimized solutions are still in conflict
+    ConflictResolver::ReoptimizeFunction reoptimize = [&reoptimized](std::vector<ReservationRequest>&, const std::vector<size_t>& indices) {
+        QCOMPARE(indices, std::vector<size_t>({1, 2}));
+        reoptimized++;
+    };
+    unsigned int rounds = 0;
+    ConflictResolver resolver(1.0, 2);
+    std::vector<size_t> waiting = resolver.resolve(requests, makeReserve(reserved), reoptimize, rounds);
+    QCOMPARE(rounds, 2u);
+    QCOMPARE(reoptimized, 2u);
+    QCOMPARE(waiting, std::vector<size_t>({1, 2}));
+    //the cars, which lost, wait in their cells and the waits are reserved
+    QVERIFY(requests.at(0).solution == PathItem(1, 0, 1.0));
+    QVERIFY(requests.at(1).solution == PathItem(2, 0, 1.0));
+    QVERIFY(requests.at(2).solution == PathItem(3, 0, 1.0));
+    QCOMPARE(reserved.size(), (size_t)3);
+    QVERIFY(reserved.count(std::make_tuple((int64_t)2, (int64_t)0, 1.0)) > 0);
+    QVERIFY(reserved.count(std::make_tuple((int64_t)3, (int64_t)0, 1.0)) > 0);
+
+    //without re-optimization the cars wait directly
+    requests.at(1).solution = PathItem(1, 0, 1.0);
+    requests.at(2).solution = PathItem(2, 0, 1.0);
+    reserved.clear();
+    reoptimized = 0;
+    waiting = ConflictResolver(1.0, 0).resolve(requests, makeReserve(reserved), reoptimize, rounds);
+    QCOMPARE(rounds, 0u);
+    QCOMPARE(reoptimized, 0u);
+    QCOMPARE(waiting, std::vector<size_t>({1, 2}));
+}
+
+void ConflictResolverTest::followLeavingCar() {
+    //car0 leaves (1,0), so car1 can follow, but car2 cannot enter the cell of car3, which is reserved later
+    std::vector<ReservationRequest> requests({ReservationRequest{PathItem(1, 0, 0.0), PathItem(2, 0, 1.0)},
+                                              ReservationRequest{PathItem(0, 0, 0.0), PathItem(1, 0, 1.0)},
+                                              ReservationRequest{PathItem(0, 2, 0.0), PathItem(1, 2, 1.0)},
+                                              ReservationRequest{PathItem(1, 2, 0.0), PathItem(2, 2, 1.0)}});
+    std::set<std::tuple<int64_t, int64_t, double> > reserved;
+    ConflictResolver resolver(1.0, 0);
+    QCOMPARE(resolver.assign(requests, {0, 1, 2, 3}, makeReserve(reserved)), std::vector<size_t>({2}));
+    QCOMPARE(reserved.size(), (size_t)3);
+    //swap of two cells: none of the cars has left its cell, so both wait
+    requests = {ReservationRequest{PathItem(0, 0, 0.0), PathItem(1, 0, 1.0)},
+                ReservationRequest{PathItem(1, 0, 0.0), PathItem(0, 0, 1.0)}};
+    reserved.clear();
+    QCOMPARE(resolver.assign(requests, {0, 1}, makeReserve(reserved)), std::vector<size_t>({0, 1}));
+    QVERIFY(reserved.empty());
+}
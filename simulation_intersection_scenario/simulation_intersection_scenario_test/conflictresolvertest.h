@@ -0,0 +1,21 @@
+#ifndef CONFLICTRESOLVERTEST_H
+#define CONFLICTRESOLVERTEST_H
+
+#include <QtTest/QtTest>
+
+/**
+ * @brief The ConflictResolverTest class tests the assignment of the cells of one step by priority
+ */
+class ConflictResolverTest : public QObject
+{
+    Q_OBJECT
+public:
+    ConflictResolverTest();
+private slots:
+    void competeForOneCell();
+    void followLeavingCar();
+private:
+
+};
+
+#endif // CONFLICTRESOLVERTEST_H
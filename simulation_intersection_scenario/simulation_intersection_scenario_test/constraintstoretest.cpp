@@ -0,0 +1,31 @@
+#include "constraintstoretest.h"
+#include "../constraintstore.h"
+
+ConstraintStoreTest::ConstraintStoreTest()
+{
+}
+
+void ConstraintStoreTest::insertReplaceAndRemove() {
+    ConstraintStore store;
+    const SystemFunctionUsage usage = SystemFunctionUsage::CONTINUOUS;
+    store.insert(0, Constraint({1.0, 1.0}, 0.5, usage));
+    store.insert(0, Constraint({2.0, 1.0}, 1.0, usage));
+    store.insert(2, Constraint({3.0, 3.0}, 1.0, usage));
+    QCOMPARE(store.size(), (size_t)3);
+    QVERIFY(store.contains(Constraint({3.0, 3.0}, 1.0, usage)));
+    QVERIFY(!store.contains(0, Constraint({3.0, 3.0}, 1.0, usage)));
+    //a new constraint replaces the one of the car with the same time
+    store.replace(0, Constraint({2.5, 1.0}, 1.0, usage));
+    QCOMPARE(store.size(), (size_t)3);
+    QVERIFY(!store.contains(Constraint({2.0, 1.0}, 1.0, usage)));
+    //the receiving car gets only the constraints of the others
+    QCOMPARE(store.getConstraintsExcept(2).size(), (size_t)2);
+    QCOMPARE(store.getConstraintsExcept(1).size(), (size_t)3);
+    QCOMPARE(store.getCars(), std::vector<CarId>({0, 2}));
+    //expiry keeps the constraints from the given time on
+    QCOMPARE(store.removeBefore(1.0), (size_t)1);
+    QCOMPARE(store.getConstraints(0).size(), (size_t)1);
+    QCOMPARE(store.removeCar(2), (size_t)1);
+    QVERIFY(!store.hasConstraints(2));
+    QCOMPARE(store.size(), (size_t)1);
+}
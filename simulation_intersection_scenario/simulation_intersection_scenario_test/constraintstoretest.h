@@ -0,0 +1,20 @@
+#ifndef CONSTRAINTSTORETEST_H
+#define CONSTRAINTSTORETEST_H
+
+#include <QtTest/QtTest>
+
+/**
+ * @brief The ConstraintStoreTest class tests the per-car storage of the communicated constraints
+ */
+class ConstraintStoreTest : public QObject
+{
+    Q_OBJECT
+public:
+    ConstraintStoreTest();
+private slots:
+    void insertReplaceAndRemove();
+private:
+
+};
+
+#endif // CONSTRAINTSTORETEST_H
@@ -0,0 +1,112 @@
+#include "constrainttest.h"
+#include "../constraintbox.h"
+#include "../constraintmin.h"
+#include "../constraintmax.h"
+#include "../systemfunction.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+/**
+ * @brief compareWithCentralDifferences compares the analytic gradient of a scalar constraint with central differences
+ * @param constraint Constraint, ConstraintMin or ConstraintMax
+ * @param u control vector
+ * @return true, if all partial derivatives match
+ */
+template <typename ScalarConstraint>
+bool compareWithCentralDifferences(ScalarConstraint& constraint, const std::vector<double>& u) {
+    std::vector<double> grad(u.size(), 0.0);
+    constraint(u, grad, nullptr);
+    const double h = 1e-6;
+    std::vector<double> noGrad;
+    for (unsigned int i = 0; i < u.size(); i++) {
+        std::vector<double> uPlus(u), uMinus(u);
+        uPlus[i] += h;
+        uMinus[i] -= h;
+        double diffQuot = (constraint(uPlus, noGrad, nullptr) - constraint(uMinus, noGrad, nullptr)) / (2.0 * h);
+        if (std::abs(diffQuot - grad.at(i)) > 1e-5) {
+            return false;
+        }
+    }
+    return true;
+}
+}
+
+ConstraintTest::ConstraintTest()
+{
+}
+
+void ConstraintTest::boxConstraintGradient() {
+    std::vector<double> startPos({1.0, 2.0});
+    std::shared_ptr<SystemFunction> sysFunc = std::make_shared<SystemFunction>("car0", startPos);
+    double t0 = 0.0;
+    double T = 0.5;
+    size_t N = 4;
+    ConstraintBox box({3.0, 1.0}, {4.0, 5.0}, t0, N, T, 0.5, 0.25);
+    box.setActualSystem(sysFunc, t0, T, N);
+    std::vector<double> u({0.3, -0.2, 0.8, 0.1, -0.5, 0.4, 0.6, -0.7});
+    const unsigned int n = u.size();
+    std::vector<double> result(N, 0.0), grad(N * n, 0.0);
+    box(N, result.data(), n, u.data(), grad.data());
+    //first step is the start position
+    QVERIFY(std::abs(result.at(0) - ((-1.0) * box.getSignedDistance(startPos) + box.getCurrentGridSize())) < 1e-12);
+    //compare with central differences
+    const double h = 1e-6;
+    std::vector<double> resultPlus(N, 0.0), resultMinus(N, 0.0);
+    for (unsigned int i = 0; i < n; i++) {
+        std::vector<double> uPlus(u), uMinus(u);
+        uPlus[i] += h;
+        uMinus[i] -= h;
+        box(N, resultPlus.data(), n, uPlus.data(), nullptr);
+        box(N, resultMinus.data(), n, uMinus.data(), nullptr);
+        for (unsigned int p = 0; p < N; p++) {
+            double diffQuot = (resultPlus.at(p) - resultMinus.at(p)) / (2.0 * h);
+            QVERIFY(std::abs(diffQuot - grad.at(p * n + i)) < 1e-5);
+        }
+    }
+}
+
+void ConstraintTest::maxNormConstraintGradient() {
+    std::vector<double> startPos({1.0, 2.0});
+    std::shared_ptr<SystemFunction> sysFunc = std::make_shared<SystemFunction>("car0", startPos);
+    double t0 = 0.0;
+    double T = 0.5;
+    size_t N = 4;
+    //constraint at step 3
+    Constraint constraint({1.5, 2.0}, 3 * T, SystemFunctionUsage::CONTINUOUS, N, T, 1.0, 0.5, 0.25);
+    constraint.setActualSystem(sysFunc, t0, T, N);
+    constraint.setSmoothed(true);
+    QVERIFY(compareWithCentralDifferences(constraint, {0.3, -0.2, 0.8, 0.1, -0.5, 0.4, 0.6, -0.7}));
+    //x_3 = (1.2, 2.3): both components have the same distance to the center, where the max-norm has a kink
+    std::vector<double> u({0.2, 0.2, 0.2, 0.2, 0.0, 0.2, 0.0, 0.0});
+    QVERIFY(compareWithCentralDifferences(constraint, u));
+    //the smoothed constraint is never weaker than the max-norm constraint
+    std::vector<double> noGrad;
+    const Trajectory& x = sysFunc->getCachedHolonomicSystemTrajectory(u, t0, T, N);
+    const double maxNorm = std::max(std::abs(x(3, 0) - 1.5), std::abs(x(3, 1) - 2.0));
+    const double smoothed = constraint(u, noGrad, nullptr);
+    QVERIFY(smoothed >= (-1.0) * maxNorm + constraint.getCurrentGridSize());
+    QVERIFY(smoothed <= (-1.0) * maxNorm + constraint.getCurrentGridSize() + Constraint::getSmoothingGap(2) + 1e-12);
+    //without smoothing, e.g. for COBYLA, the exact max-norm is taken
+    constraint.setSmoothed(false);
+    QVERIFY(std::abs(constraint(u, noGrad, nullptr) - ((-1.0) * maxNorm + constraint.getCurrentGridSize())) < 1e-12);
+}
+
+void ConstraintTest::boundConstraintGradients() {
+    std::vector<double> startPos({1.0, 2.0});
+    std::shared_ptr<SystemFunction> sysFunc = std::make_shared<SystemFunction>("car0", startPos);
+    double t0 = 0.0;
+    double T = 0.5;
+    size_t N = 4;
+    std::vector<double> u({0.3, -0.2, 0.8, 0.1, -0.5, 0.4, 0.6, -0.7});
+    //x-component of step 2 and y-component of step 3
+    for (const unsigned int& pos : {4u, 7u}) {
+        ConstraintMin constraintMin(0.0, pos);
+        constraintMin.setActualSystem(sysFunc, t0, T, N);
+        QVERIFY(compareWithCentralDifferences(constraintMin, u));
+        ConstraintMax constraintMax(5.0, pos);
+        constraintMax.setActualSystem(sysFunc, t0, T, N);
+        QVERIFY(compareWithCentralDifferences(constraintMax, u));
+    }
+}
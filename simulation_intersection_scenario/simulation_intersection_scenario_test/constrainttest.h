@@ -0,0 +1,22 @@
+#ifndef CONSTRAINTTEST_H
+#define CONSTRAINTTEST_H
+
+#include <QtTest/QtTest>
+
+/**
+ * @brief The ConstraintTest class tests the constraints and their gradients
+ */
+class ConstraintTest : public QObject
+{
+    Q_OBJECT
+public:
+    ConstraintTest();
+private slots:
+    void boxConstraintGradient();
+    void maxNormConstraintGradient();
+    void boundConstraintGradients();
+private:
+
+};
+
+#endif // CONSTRAINTTEST_H
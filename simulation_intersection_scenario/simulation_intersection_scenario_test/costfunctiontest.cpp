@@ -0,0 +1,66 @@
+#include "costfunctiontest.h"
+#include "../costfunction.h"
+#include "../systemfunction.h"
+#include "../intersection.h"
+#include "../simulationcontext.h"
+
+#include <cmath>
+
+CostFunctionTest::CostFunctionTest()
+{
+}
+
+void CostFunctionTest::costGradient() {
+    std::vector<double> startPos({1.0, 2.0});
+    std::vector<double> target({8.0, 3.0});
+    std::shared_ptr<SystemFunction> sysFunc = std::make_shared<SystemFunction>("car0", startPos);
+    double t0 = 0.0;
+    double T = 0.5;
+    size_t N = 4;
+    CostFunction costFunction(startPos, target, t0, T, N, InterSectionParameters::lambda, sysFunc);
+    std::vector<double> u({0.3, -0.2, 0.8, 0.1, -0.5, 0.4, 0.6, -0.7});
+    std::vector<double> grad(u.size(), 0.0);
+    costFunction(u, grad);
+    //compare with central differences
+    const double h = 1e-6;
+    std::vector<double> noGrad;
+    for (unsigned int i = 0; i < u.size(); i++) {
+        std::vector<double> uPlus(u), uMinus(u);
+        uPlus[i] += h;
+        uMinus[i] -= h;
+        double diffQuot = (costFunction(uPlus, noGrad) - costFunction(uMinus, noGrad)) / (2.0 * h);
+        QVERIFY(std::abs(diffQuot - grad.at(i)) < 1e-5);
+    }
+}
+
+void CostFunctionTest::terminalCostGradient() {
+    //10 x 5 cells of size 1, the target lies in cell (8,2)
+    std::shared_ptr<InterSection> interSection = std::make_shared<InterSection>(10, 5);
+    interSection->buildGrid(10, 5, 1.0);
+    std::shared_ptr<SimulationContext> context = std::make_shared<SimulationContext>(interSection);
+    std::vector<double> startPos({1.5, 2.5});
+    std::vector<double> target({8.5, 2.5});
+    std::shared_ptr<SystemFunction> sysFunc = std::make_shared<SystemFunction>("car0", startPos, context);
+    std::shared_ptr<SystemFunction> sysFuncWithoutGrid = std::make_shared<SystemFunction>("car0", startPos);
+    double t0 = 0.0;
+    double T = 0.5;
+    size_t N = 4;
+    CostFunction costFunction(startPos, target, t0, T, N, InterSectionParameters::lambda, sysFunc);
+    CostFunction stageCostFunction(startPos, target, t0, T, N, InterSectionParameters::lambda, sysFuncWithoutGrid);
+    std::vector<double> noGrad;
+    //the car stays in the centre of cell (1,2), which is 7 cells away from the target
+    std::vector<double> u(2 * N, 0.0);
+    QVERIFY(std::abs(costFunction(u, noGrad) - stageCostFunction(u, noGrad) - 7.0) < 1e-12);
+    //the last state (2.4, 2.45) lies between the centres, compare with central differences
+    u = {0.3, -0.2, 0.8, 0.1, 0.7, 0.0, 0.6, -0.7};
+    std::vector<double> grad(u.size(), 0.0);
+    costFunction(u, grad);
+    const double h = 1e-6;
+    for (unsigned int i = 0; i < u.size(); i++) {
+        std::vector<double> uPlus(u), uMinus(u);
+        uPlus[i] += h;
+        uMinus[i] -= h;
+        double diffQuot = (costFunction(uPlus, noGrad) - costFunction(uMinus, noGrad)) / (2.0 * h);
+        QVERIFY(std::abs(diffQuot - grad.at(i)) < 1e-5);
+    }
+}
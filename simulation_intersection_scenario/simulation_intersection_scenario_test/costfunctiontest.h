@@ -0,0 +1,21 @@
+#ifndef COSTFUNCTIONTEST_H
+#define COSTFUNCTIONTEST_H
+
+#include <QtTest/QtTest>
+
+/**
+ * @brief The CostFunctionTest class tests the cost function of the continuous setting
+ */
+class CostFunctionTest : public QObject
+{
+    Q_OBJECT
+public:
+    CostFunctionTest();
+private slots:
+    void costGradient();
+    void terminalCostGradient();
+private:
+
+};
+
+#endif // COSTFUNCTIONTEST_H
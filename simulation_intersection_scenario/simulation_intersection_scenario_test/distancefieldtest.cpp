@@ -0,0 +1,29 @@
+#include "distancefieldtest.h"
+#include "../distancefield.h"
+#include "../shortestpathtable.h"
+#include "../intersection.h"
+
+#include <cmath>
+#include <memory>
+
+DistanceFieldTest::DistanceFieldTest()
+{
+}
+
+void DistanceFieldTest::compareWithShortestPathTable() {
+    const unsigned int width = 6;
+    const unsigned int height = 5;
+    ShortestPathTable table(width, height);
+    for (size_t target = 0; target < table.getNumberOfCells(); target++) {
+        DistanceField field(width, height, target);
+        QCOMPARE(field.getTargetIndex(), target);
+        for (size_t cell = 0; cell < table.getNumberOfCells(); cell++) {
+            QVERIFY(std::abs(field.getDistance(cell) - table.getDistance(cell, target)) < 1e-9);
+        }
+    }
+    //the intersection computes each field once and shares it
+    InterSection interSection(width, height);
+    std::shared_ptr<const DistanceField> first = interSection.getDistanceField(3);
+    QCOMPARE(interSection.getDistanceField(3), first);
+    QVERIFY(interSection.getDistanceField(4) != first);
+}
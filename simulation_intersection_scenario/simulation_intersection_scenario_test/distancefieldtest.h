@@ -0,0 +1,20 @@
+#ifndef DISTANCEFIELDTEST_H
+#define DISTANCEFIELDTEST_H
+
+#include <QtTest/QtTest>
+
+/**
+ * @brief The DistanceFieldTest class tests the distance fields of the targets and their cache in the intersection
+ */
+class DistanceFieldTest : public QObject
+{
+    Q_OBJECT
+public:
+    DistanceFieldTest();
+private slots:
+    void compareWithShortestPathTable();
+private:
+
+};
+
+#endif // DISTANCEFIELDTEST_H
@@ -0,0 +1,86 @@
+#include "dstarlitetest.h"
+#include "../dstarlite.h"
+#include "../intersection.h"
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+
+namespace {
+/**
+ * @brief dijkstra reference costs from the source to the target on the 8-neighbourhood, blocked cells are left out
+ * @return costs, infinity if the target is not reachable
+ */
+double dijkstra(const std::shared_ptr<InterSection>& grid, const size_t& source, const size_t& target, const std::vector<bool>& blocked) {
+    const InterSectionGrid& cells = grid->getGrid();
+    std::vector<double> dist(cells.size(), std::numeric_limits<double>::infinity());
+    if (blocked[source] || blocked[target]) {
+        return std::numeric_limits<double>::infinity();
+    }
+    typedef std::pair<double, size_t> QueueItem;
+    std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem> > queue;
+    dist[source] = 0.0;
+    queue.push(QueueItem(0.0, source));
+    while (!queue.empty()) {
+        const QueueItem item = queue.top();
+        queue.pop();
+        if (item.first > dist[item.second]) {
+            continue;
+        }
+        const int x = cells[item.second]->getX();
+        const int y = cells[item.second]->getY();
+        for (int i = x - 1; i <= x + 1; i++) {
+            for (int j = y - 1; j <= y + 1; j++) {
+                if ((i == x && j == y) || !grid->isInsideGrid(i, j)) {
+                    continue;
+                }
+                const size_t next = grid->getCellIndex(i, j);
+                const double costs = item.first + std::sqrt((double)((i - x) * (i - x) + (j - y) * (j - y)));
+                if (!blocked[next] && costs < dist[next]) {
+                    dist[next] = costs;
+                    queue.push(QueueItem(costs, next));
+                }
+            }
+        }
+    }
+    return dist[target];
+}
+}
+
+DstarLiteTest::DstarLiteTest()
+{
+}
+
+void DstarLiteTest::replanMatchesDijkstra() {
+    std::mt19937 generator(3);
+    for (unsigned int trial = 0; trial < 100; trial++) {
+        const unsigned int width = 3 + generator() % 10;
+        const unsigned int height = 3 + generator() % 10;
+        std::shared_ptr<InterSection> grid = std::make_shared<InterSection>(width, height);
+        grid->buildGrid(width, height, 1.0);
+        const InterSectionGrid& cells = grid->getGrid();
+        DstarLite dstar("car0", PathItem(0, 0, 0.0), PathItem(width - 1, height - 1, 0.0), 1.0);
+        const size_t target = grid->getCellIndex(width - 1, height - 1);
+        dstar.calculatePath(grid, cells[grid->getCellIndex(generator() % width, generator() % height)], cells[target]);
+        //the car moves and at each replanning another cell is blocked, the one before is released
+        for (unsigned int step = 0; step < 15; step++) {
+            const size_t start = grid->getCellIndex(generator() % width, generator() % height);
+            const size_t blockedCell = grid->getCellIndex(generator() % width, generator() % height);
+            dstar.replan(grid, PathItem(cells[blockedCell]->getX(), cells[blockedCell]->getY(), 0.0), cells[start]);
+            std::vector<bool> blocked(cells.size(), false);
+            if (blockedCell != start && blockedCell != target) {
+                blocked[blockedCell] = true;
+            }
+            const double reference = dijkstra(grid, start, target, blocked);
+            const double costs = dstar.getCostToTarget(start);
+            if (std::isinf(reference)) {
+                QVERIFY(std::isinf(costs));
+            }
+            else {
+                QVERIFY(std::abs(costs - reference) < 1e-9);
+            }
+        }
+    }
+}
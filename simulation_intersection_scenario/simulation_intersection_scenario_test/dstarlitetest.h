@@ -0,0 +1,20 @@
+#ifndef DSTARLITETEST_H
+#define DSTARLITETEST_H
+
+#include <QtTest/QtTest>
+
+/**
+ * @brief The DstarLiteTest class tests the incremental replanning of D* Lite
+ */
+class DstarLiteTest : public QObject
+{
+    Q_OBJECT
+public:
+    DstarLiteTest();
+private slots:
+    void replanMatchesDijkstra();
+private:
+
+};
+
+#endif // DSTARLITETEST_H
@@ -0,0 +1,30 @@
+#include "gridsearchstatetest.h"
+#include "../gridsearchstate.h"
+
+GridSearchStateTest::GridSearchStateTest()
+{
+}
+
+void GridSearchStateTest::openListOrder() {
+    GridSearchState search;
+    search.reset(4);
+    search.open(0, 0.0, 3.0, GridSearchState::noCell);
+    search.open(1, 1.0, 2.0, 0);
+    search.open(2, 1.0, 4.0, 0);
+    //improving a cell makes its old heap entry outdated
+    search.open(2, 0.5, 1.0, 1);
+    size_t cell;
+    QVERIFY(search.peekMin(cell));
+    QCOMPARE(cell, (size_t)2);
+    QCOMPARE(search.getParent(2), (size_t)1);
+    QVERIFY(search.popMin(cell));
+    search.close(cell);
+    QVERIFY(search.isClosed(2));
+    QVERIFY(search.popMin(cell));
+    QCOMPARE(cell, (size_t)1);
+    QVERIFY(search.popMin(cell));
+    QCOMPARE(cell, (size_t)0);
+    //the outdated entry of cell 2 is skipped
+    QVERIFY(!search.popMin(cell));
+    QVERIFY(!search.isOpen(3));
+}
@@ -0,0 +1,20 @@
+#ifndef GRIDSEARCHSTATETEST_H
+#define GRIDSEARCHSTATETEST_H
+
+#include <QtTest/QtTest>
+
+/**
+ * @brief The GridSearchStateTest class tests the scratch arrays and the open list of the grid search
+ */
+class GridSearchStateTest : public QObject
+{
+    Q_OBJECT
+public:
+    GridSearchStateTest();
+private slots:
+    void openListOrder();
+private:
+
+};
+
+#endif // GRIDSEARCHSTATETEST_H
@@ -0,0 +1,33 @@
+#include "indexedminheaptest.h"
+#include "../indexedminheap.h"
+
+#include <utility>
+#include <vector>
+
+IndexedMinHeapTest::IndexedMinHeapTest()
+{
+}
+
+void IndexedMinHeapTest::changeKeysAndRemove() {
+    IndexedMinHeap<std::pair<double, double> > heap;
+    heap.reset(5);
+    heap.push(0, std::make_pair(3.0, 0.0));
+    heap.push(1, std::make_pair(2.0, 1.0));
+    heap.push(2, std::make_pair(2.0, 0.0));
+    heap.push(3, std::make_pair(5.0, 0.0));
+    //keys are compared lexicographically
+    QCOMPARE(heap.top(), (size_t)2);
+    //decrease and increase key
+    heap.push(3, std::make_pair(1.0, 0.0));
+    heap.push(2, std::make_pair(4.0, 0.0));
+    QCOMPARE(heap.top(), (size_t)3);
+    heap.remove(1);
+    QVERIFY(!heap.contains(1));
+    QCOMPARE(heap.size(), (size_t)3);
+    std::vector<size_t> order;
+    while (!heap.empty()) {
+        order.push_back(heap.top());
+        heap.pop();
+    }
+    QCOMPARE(order, std::vector<size_t>({3, 0, 2}));
+}
@@ -0,0 +1,20 @@
+#ifndef INDEXEDMINHEAPTEST_H
+#define INDEXEDMINHEAPTEST_H
+
+#include <QtTest/QtTest>
+
+/**
+ * @brief The IndexedMinHeapTest class tests the binary heap with changeable keys
+ */
+class IndexedMinHeapTest : public QObject
+{
+    Q_OBJECT
+public:
+    IndexedMinHeapTest();
+private slots:
+    void changeKeysAndRemove();
+private:
+
+};
+
+#endif // INDEXEDMINHEAPTEST_H
@@ -0,0 +1,53 @@
+#include "systemfunctiontest.h"
+#include "costfunctiontest.h"
+#include "constrainttest.h"
+#include "simulationcontexttest.h"
+#include "reservationtabletest.h"
+#include "constraintstoretest.h"
+#include "gridsearchstatetest.h"
+#include "shortestpathtabletest.h"
+#include "indexedminheaptest.h"
+#include "distancefieldtest.h"
+#include "conflictresolvertest.h"
+#include "astarpathcalculationtest.h"
+#include "dstarlitetest.h"
+#include "solvercontexttest.h"
+#include "conflictindextest.h"
+#include "prioritysortertest.h"
+#include "mpccontrollertest.h"
+
+#include <QtCore/QCoreApplication>
+
+/**
+ * @brief runTest runs all slots of one test class
+ * @return 0, if all tests passed
+ */
+template <typename Test>
+int runTest(int argc, char *argv[]) {
+    Test test;
+    return QTest::qExec(&test, argc, argv);
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    int failed = 0;
+    failed += runTest<SystemFunctionTest>(argc, argv);
+    failed += runTest<CostFunctionTest>(argc, argv);
+    failed += runTest<ConstraintTest>(argc, argv);
+    failed += runTest<SimulationContextTest>(argc, argv);
+    failed += runTest<ReservationTableTest>(argc, argv);
+    failed += runTest<ConstraintStoreTest>(argc, argv);
+    failed += runTest<GridSearchStateTest>(argc, argv);
+    failed += runTest<ShortestPathTableTest>(argc, argv);
+    failed += runTest<IndexedMinHeapTest>(argc, argv);
+    failed += runTest<DistanceFieldTest>(argc, argv);
+    failed += runTest<ConflictResolverTest>(argc, argv);
+    failed += runTest<AStarPathCalculationTest>(argc, argv);
+    failed += runTest<DstarLiteTest>(argc, argv);
+    failed += runTest<SolverContextTest>(argc, argv);
+    failed += runTest<ConflictIndexTest>(argc, argv);
+    failed += runTest<PrioritySorterTest>(argc, argv);
+    failed += runTest<MpcControllerTest>(argc, argv);
+    return failed;
+}
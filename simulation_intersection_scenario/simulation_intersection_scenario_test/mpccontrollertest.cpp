@@ -0,0 +1,87 @@
+#include "mpccontrollertest.h"
+#include "../mpccontroller.h"
+
+#include <algorithm>
+
+MpcControllerTest::MpcControllerTest()
+{
+}
+
+void MpcControllerTest::pruneUnreachableConstraints() {
+    const double t0 = 1.0;
+    const double T = 0.5;
+    const size_t N = 4;
+    //x0 = (1,2) and u in [-1,1]: the state after p steps lies in [1 - p/2, 1 + p/2] x [2 - p/2, 2 + p/2]
+    MpcController controller("car0", std::vector<double>({1.0, 2.0}), std::vector<double>({5.0, 5.0}), N, 0.1);
+    auto makeConstraint = [&](const std::vector<double>& center, const int& step) {
+        return Constraint(center, t0 + step * T, SystemFunctionUsage::CONTINUOUS, N, T, 0.1, 0.05, 0.1);
+    };
+    std::vector<Constraint>& constraints = controller.getCurrentConstraints();
+    //inside the reachable box
+    constraints.push_back(makeConstraint({1.4, 2.0}, 1));
+    //outside the box, but closer than the radius of the constraint
+    constraints.push_back(makeConstraint({1.6, 2.0}, 1));
+    //not reachable in one step
+    constraints.push_back(makeConstraint({1.9, 2.0}, 1));
+    //the same center is reachable in three steps
+    constraints.push_back(makeConstraint({1.9, 2.0}, 3));
+    //not reachable in the second component
+    constraints.push_back(makeConstraint({1.0, 3.5}, 2));
+    //outside the horizon
+    constraints.push_back(makeConstraint({1.0, 2.0}, N));
+    constraints.push_back(makeConstraint({1.0, 2.0}, -1));
+    const double radius = constraints.front().getCurrentGridSize();
+    QVERIFY(radius > 0.1 && radius < 0.4);
+
+    QCOMPARE(controller.pruneUnreachableConstraints(t0, T), (size_t)4);
+    QCOMPARE(constraints.size(), (size_t)3);
+    QCOMPARE(constraints.at(0).getCenterPoint(), std::vector<double>({1.4, 2.0}));
+    QCOMPARE(constraints.at(1).getCenterPoint(), std::vector<double>({1.6, 2.0}));
+    QCOMPARE(constraints.at(2).getCenterPoint(), std::vector<double>({1.9, 2.0}));
+    QCOMPARE(constraints.at(2).getConstraintTime(), t0 + 3 * T);
+    //nothing is left to remove
+    QCOMPARE(controller.pruneUnreachableConstraints(t0, T), (size_t)0);
+}
+
+void MpcControllerTest::pruneSmoothedConstraints() {
+    const double t0 = 1.0;
+    const double T = 0.5;
+    const size_t N = 4;
+    const std::vector<double> x0({1.0, 2.0});
+    MpcController controller("car0", x0, std::vector<double>({5.0, 5.0}), N, 0.1);
+    controller.setOptimizationAlgorithm(OptimizationAlgorithm::SLSQP);
+    QVERIFY(controller.isGradientBased());
+    std::vector<Constraint>& constraints = controller.getCurrentConstraints();
+    //the reachable box of the first step is [0.5, 1.5] x [1.5, 2.5], the radius is about 0.22 and the smoothing gap log(4)/20 about 0.07
+    //distance 0.25: outside the exact square, but the smoothed constraint is still violated at (1.5, 2)
+    constraints.push_back(Constraint({1.75, 2.0}, t0 + T, SystemFunctionUsage::CONTINUOUS, N, T, 0.1, 0.05, 0.1));
+    //distance 0.35: outside the enlarged square
+    constraints.push_back(Constraint({1.85, 2.0}, t0 + T, SystemFunctionUsage::CONTINUOUS, N, T, 0.1, 0.05, 0.1));
+    std::vector<Constraint> before = constraints;
+
+    QCOMPARE(controller.pruneUnreachableConstraints(t0, T), (size_t)1);
+    QCOMPARE(constraints.size(), (size_t)1);
+    QCOMPARE(constraints.front().getCenterPoint(), std::vector<double>({1.75, 2.0}));
+
+    //maximum of the smoothed constraints over the reachable box of the first step
+    std::shared_ptr<SystemFunction> sysFunc = std::make_shared<SystemFunction>("car0", x0);
+    std::vector<double> noGrad;
+    std::vector<double> maxValues;
+    for (Constraint& constraint : before) {
+        constraint.setActualSystem(sysFunc, t0, T, N);
+        constraint.setSmoothed(true);
+        double maxValue = -1.0e10;
+        for (unsigned int i = 0; i <= 20; i++) {
+            for (unsigned int j = 0; j <= 20; j++) {
+                std::vector<double> u(2 * N, 0.0);
+                u[0] = -1.0 + 2.0 * i / 20.0;
+                u[1] = -1.0 + 2.0 * j / 20.0;
+                maxValue = std::max(maxValue, constraint(u, noGrad, nullptr));
+            }
+        }
+        maxValues.push_back(maxValue);
+    }
+    //the kept constraint can become active, the pruned one is satisfied everywhere
+    QVERIFY(maxValues.at(0) > 0.0);
+    QVERIFY(maxValues.at(1) <= 0.0);
+}
@@ -0,0 +1,21 @@
+#ifndef MPCCONTROLLERTEST_H
+#define MPCCONTROLLERTEST_H
+
+#include <QtTest/QtTest>
+
+/**
+ * @brief The MpcControllerTest class tests the handling of the constraints in the controller of one car
+ */
+class MpcControllerTest : public QObject
+{
+    Q_OBJECT
+public:
+    MpcControllerTest();
+private slots:
+    void pruneUnreachableConstraints();
+    void pruneSmoothedConstraints();
+private:
+
+};
+
+#endif // MPCCONTROLLERTEST_H
@@ -0,0 +1,63 @@
+#include "prioritysortertest.h"
+#include "../prioritysorter.h"
+#include "../conflictindex.h"
+#include "../intersection.h"
+#include "../intersectionparameters.h"
+#include "../simulationcontext.h"
+
+PrioritySorterTest::PrioritySorterTest()
+{
+}
+
+void PrioritySorterTest::colouringIsProper() {
+    const double T = InterSectionParameters::T;
+    std::shared_ptr<InterSection> interSection = std::make_shared<InterSection>(5, 5);
+    interSection->buildGrid(5, 5, 1.0);
+    std::shared_ptr<SimulationContext> context = std::make_shared<SimulationContext>(interSection);
+    std::vector<std::shared_ptr<Car> > cars;
+    for (unsigned int i = 0; i < 8; i++) {
+        cars.push_back(std::make_shared<Car>(QString("car%1").arg(i), PathItem(0, 0, 0.0), PathItem(4, 4, 0.0), 3, 0.1,
+                                             PathAlgorithm::ASTARDECENTRALZED, T, std::make_pair(-1.0, 1.0), context));
+    }
+    ConflictIndex conflicts(T);
+    //car0..car4 form an odd cycle, car i and car i-1 share the cell (i-1,0) in the first step
+    Path pathCar0;
+    pathCar0.addPathItem(PathItem(0, 0, T));
+    pathCar0.addPathItem(PathItem(4, 0, T));
+    //car0, car5 and car6 form a triangle in the cell (0,0) in the second step
+    pathCar0.addPathItem(PathItem(0, 0, 2 * T));
+    conflicts.insert(cars.at(0), pathCar0);
+    for (unsigned int i = 1; i < 5; i++) {
+        Path path;
+        path.addPathItem(PathItem(i, 0, T));
+        path.addPathItem(PathItem(i - 1, 0, T));
+        conflicts.insert(cars.at(i), path);
+    }
+    conflicts.insert(cars.at(5), Path(PathItem(0, 0, 2 * T)));
+    conflicts.insert(cars.at(6), Path(PathItem(0, 0, 2 * T)));
+    //car7 is not in conflict with anyone
+    conflicts.insert(cars.at(7), Path(PathItem(2, 3, T)));
+    QVERIFY(conflicts.hasConflict(cars.at(4), cars.at(0)));
+    QVERIFY(conflicts.hasConflict(cars.at(5), cars.at(6)));
+
+    PrioritySorter sorter(PriorityCriteria::MINOPENLOOPCOSTSCOLORING);
+    std::vector<std::vector<std::shared_ptr<Car> > > levels = sorter.colourConflictGraph(cars, conflicts);
+    //an odd cycle and a triangle need 3 colours, DSATUR finds them
+    QCOMPARE(levels.size(), (size_t)3);
+    std::map<std::shared_ptr<Car>, size_t> levelOfCar;
+    for (size_t level = 0; level < levels.size(); level++) {
+        QVERIFY(!levels.at(level).empty());
+        for (const std::shared_ptr<Car>& car : levels.at(level)) {
+            QVERIFY(levelOfCar.insert(std::make_pair(car, level)).second);
+        }
+    }
+    QCOMPARE(levelOfCar.size(), cars.size());
+    //no two cars of one level are in conflict
+    for (const std::vector<std::shared_ptr<Car> >& level : levels) {
+        for (size_t i = 0; i < level.size(); i++) {
+            for (size_t j = i + 1; j < level.size(); j++) {
+                QVERIFY(!conflicts.hasConflict(level.at(i), level.at(j)));
+            }
+        }
+    }
+}
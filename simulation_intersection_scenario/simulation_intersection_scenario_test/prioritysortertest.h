@@ -0,0 +1,20 @@
+#ifndef PRIORITYSORTERTEST_H
+#define PRIORITYSORTERTEST_H
+
+#include <QtTest/QtTest>
+
+/**
+ * @brief The PrioritySorterTest class tests the levels of the colouring priority criteria
+ */
+class PrioritySorterTest : public QObject
+{
+    Q_OBJECT
+public:
+    PrioritySorterTest();
+private slots:
+    void colouringIsProper();
+private:
+
+};
+
+#endif // PRIORITYSORTERTEST_H
@@ -0,0 +1,52 @@
+#include "reservationtabletest.h"
+#include "../reservationtable.h"
+#include "../intersection.h"
+
+ReservationTableTest::ReservationTableTest()
+{
+}
+
+void ReservationTableTest::reserveAndFindFreeTime() {
+    const CarId car0 = 0;
+    const CarId car1 = 1;
+    const CarId car2 = 2;
+    ReservationTable table(0.5);
+    QVERIFY(table.reserve(car0, 1.0));
+    QVERIFY(!table.reserve(car1, 1.0));
+    QVERIFY(table.reserve(car1, 1.5));
+    QVERIFY(table.isReserved(1.0));
+    QVERIFY(!table.isReserved(2.0));
+    QCOMPARE(table.getNextFreeTime(1.0), 2.0);
+    QCOMPARE(table.getNextFreeTime(0.0), 0.0);
+    QCOMPARE(table.getTimeForCar(car1, 0.0), 1.5);
+    QCOMPARE(table.getTimeForCar(car0, 1.5), -1.0);
+    //the own reservation does not block
+    QVERIFY(!table.isReservedByOtherCar(car0, 1.0));
+    QVERIFY(table.isReservedByOtherCar(car1, 1.0));
+    QVERIFY(!table.isReservedByOtherCar(car1, 2.0));
+    QCOMPARE(table.getCar(1.5), car1);
+    QCOMPARE(table.getCar(2.0), noCarId);
+    //skip a full word of the bitmap
+    for (unsigned int i = 4; i < 140; i++) {
+        QVERIFY(table.reserve(car2, i * 0.5));
+    }
+    QCOMPARE(table.getNextFreeTime(1.0), 70.0);
+    QCOMPARE(table.removeCar(car2), 136u);
+    QCOMPARE(table.getNextFreeTime(1.0), 2.0);
+    QCOMPARE(table.size(), 2u);
+}
+
+void ReservationTableTest::cellSlotsUseSamplingTime() {
+    //with T = 0.2 the times 0.4 and 0.6 are different slots, with the default slot width 0.5 both round to slot 1
+    const CarId car0 = 0;
+    const CarId car1 = 1;
+    const CarId car2 = 2;
+    InterSection interSection(4, 4, 1.0, 0.2);
+    interSection.buildGrid(4, 4, 1.0);
+    QVERIFY(interSection.reserveTimeForCar(car0, 1, 1, 0.4));
+    QVERIFY(interSection.reserveTimeForCar(car1, 1, 1, 0.6));
+    QVERIFY(!interSection.reserveTimeForCar(car2, 1, 1, 0.6));
+    //the next free time steps by T
+    QCOMPARE(interSection.getPossibleReserveTimeForCar(1, 1, 0.4), 0.8);
+    QCOMPARE(interSection.getPossibleReserveTimeForCar(1, 1, 0.2), 0.2);
+}
@@ -0,0 +1,21 @@
+#ifndef RESERVATIONTABLETEST_H
+#define RESERVATIONTABLETEST_H
+
+#include <QtTest/QtTest>
+
+/**
+ * @brief The ReservationTableTest class tests the time slot reservations of one cell
+ */
+class ReservationTableTest : public QObject
+{
+    Q_OBJECT
+public:
+    ReservationTableTest();
+private slots:
+    void reserveAndFindFreeTime();
+    void cellSlotsUseSamplingTime();
+private:
+
+};
+
+#endif // RESERVATIONTABLETEST_H
@@ -0,0 +1,31 @@
+#include "shortestpathtabletest.h"
+#include "../shortestpathtable.h"
+
+#include <algorithm>
+#include <cmath>
+
+ShortestPathTableTest::ShortestPathTableTest()
+{
+}
+
+void ShortestPathTableTest::distancesAndPaths() {
+    //more cells than one tile, so the blocked phases are all used
+    const unsigned int width = 9;
+    const unsigned int height = 7;
+    ShortestPathTable table(width, height);
+    QCOMPARE(table.getNumberOfCells(), (size_t)(width * height));
+    for (size_t from = 0; from < table.getNumberOfCells(); from += 5) {
+        for (size_t to = 0; to < table.getNumberOfCells(); to++) {
+            const int dk = std::abs((int)(from / height) - (int)(to / height));
+            const int dm = std::abs((int)(from % height) - (int)(to % height));
+            //diagonal steps first, then straight steps
+            const double expected = std::min(dk, dm) * std::sqrt(2.0) + std::abs(dk - dm);
+            QVERIFY(std::abs(table.getDistance(from, to) - expected) < 1e-9);
+            const std::vector<size_t> path = table.getPath(from, to);
+            QCOMPARE(path.size(), (size_t)std::max(dk, dm));
+            if (from != to) {
+                QCOMPARE(path.back(), to);
+            }
+        }
+    }
+}
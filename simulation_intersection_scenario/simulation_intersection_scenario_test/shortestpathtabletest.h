@@ -0,0 +1,20 @@
+#ifndef SHORTESTPATHTABLETEST_H
+#define SHORTESTPATHTABLETEST_H
+
+#include <QtTest/QtTest>
+
+/**
+ * @brief The ShortestPathTableTest class tests the all-pairs shortest paths of the intersection grid
+ */
+class ShortestPathTableTest : public QObject
+{
+    Q_OBJECT
+public:
+    ShortestPathTableTest();
+private slots:
+    void distancesAndPaths();
+private:
+
+};
+
+#endif // SHORTESTPATHTABLETEST_H
@@ -0,0 +1,60 @@
+#-------------------------------------------------
+#
+# unit tests of the intersection scenario,
+# compiled with the common sources of the scenario
+#
+#-------------------------------------------------
+
+QT += testlib
+
+TARGET = simulation_intersection_scenario_test
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+#the simulation core library is in the output directory of the parent project
+CUSTOUTPWD = $$OUT_PWD/../../out
+include(../simulation_intersection_scenario.pri)
+
+INCLUDEPATH += $$PWD/..
+#the tests are built without the GUI sources and plots, as the batch runner
+DEFINES += INTERSECTION_HEADLESS
+
+SOURCES += main.cpp \
+    systemfunctiontest.cpp \
+    costfunctiontest.cpp \
+    constrainttest.cpp \
+    simulationcontexttest.cpp \
+    reservationtabletest.cpp \
+    constraintstoretest.cpp \
+    gridsearchstatetest.cpp \
+    shortestpathtabletest.cpp \
+    indexedminheaptest.cpp \
+    distancefieldtest.cpp \
+    conflictresolvertest.cpp \
+    astarpathcalculationtest.cpp \
+    dstarlitetest.cpp \
+    solvercontexttest.cpp \
+    conflictindextest.cpp \
+    prioritysortertest.cpp \
+    mpccontrollertest.cpp
+
+HEADERS += \
+    systemfunctiontest.h \
+    costfunctiontest.h \
+    constrainttest.h \
+    simulationcontexttest.h \
+    reservationtabletest.h \
+    constraintstoretest.h \
+    gridsearchstatetest.h \
+    shortestpathtabletest.h \
+    indexedminheaptest.h \
+    distancefieldtest.h \
+    conflictresolvertest.h \
+    astarpathcalculationtest.h \
+    dstarlitetest.h \
+    solvercontexttest.h \
+    conflictindextest.h \
+    prioritysortertest.h \
+    mpccontrollertest.h
@@ -0,0 +1,29 @@
+#include "simulationcontexttest.h"
+#include "../simulationcontext.h"
+#include "../carid.h"
+
+SimulationContextTest::SimulationContextTest()
+{
+}
+
+void SimulationContextTest::carIds() {
+    SimulationContext context(nullptr);
+    QCOMPARE(context.registerCarName("car0"), (CarId)0);
+    QCOMPARE(context.registerCarName("car5"), (CarId)1);
+    //a registered name keeps its ID
+    QCOMPARE(context.registerCarName("car0"), (CarId)0);
+    QCOMPARE(context.getNumberOfCarIds(), (size_t)2);
+    QCOMPARE(context.getCarName(1), QString("car5"));
+    QVERIFY(context.getCarName(2).isEmpty());
+    CarControls controls;
+    QVERIFY(controls.empty());
+    controls[1] = {{0.5, 0.5}};
+    QVERIFY(!controls.contains(0));
+    QVERIFY(controls.contains(1));
+    QCOMPARE(controls.at(1).at(0).at(1), 0.5);
+    controls.erase(1);
+    QVERIFY(controls.empty());
+    //IDs start again from 0 for a new run
+    context.clearCars();
+    QCOMPARE(context.registerCarName("car5"), (CarId)0);
+}
@@ -0,0 +1,20 @@
+#ifndef SIMULATIONCONTEXTTEST_H
+#define SIMULATIONCONTEXTTEST_H
+
+#include <QtTest/QtTest>
+
+/**
+ * @brief The SimulationContextTest class tests the car IDs of the simulation context and the per-car data indexed by them
+ */
+class SimulationContextTest : public QObject
+{
+    Q_OBJECT
+public:
+    SimulationContextTest();
+private slots:
+    void carIds();
+private:
+
+};
+
+#endif // SIMULATIONCONTEXTTEST_H
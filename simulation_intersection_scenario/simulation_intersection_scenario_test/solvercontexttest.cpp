@@ -0,0 +1,66 @@
+#include "solvercontexttest.h"
+#include "../solvercontext.h"
+
+SolverContextTest::SolverContextTest()
+{
+}
+
+void SolverContextTest::rebuildOnlyOnChange() {
+    SolverContext context;
+    QCOMPARE(context.getRebuilds(), size_t(0));
+    nlopt::opt& first = context.getOptimizer(nlopt::LN_COBYLA, 4, -1.0, 1.0);
+    nlopt::opt& second = context.getOptimizer(nlopt::LN_COBYLA, 4, -1.0, 1.0);
+    QCOMPARE(&first, &second);
+    QCOMPARE(context.getRebuilds(), size_t(1));
+    //other dimension, bounds or algorithm
+    context.getOptimizer(nlopt::LN_COBYLA, 6, -1.0, 1.0);
+    QCOMPARE(context.getRebuilds(), size_t(2));
+    context.getOptimizer(nlopt::LN_COBYLA, 6, -0.5, 0.5);
+    QCOMPARE(context.getRebuilds(), size_t(3));
+    context.getOptimizer(nlopt::LN_BOBYQA, 6, -0.5, 0.5);
+    QCOMPARE(context.getRebuilds(), size_t(4));
+    context.invalidate();
+    context.getOptimizer(nlopt::LN_BOBYQA, 6, -0.5, 0.5);
+    QCOMPARE(context.getRebuilds(), size_t(5));
+}
+
+void SolverContextTest::warmStart() {
+    SolverContext context;
+    context.getOptimizer(nlopt::LN_COBYLA, 4, -1.0, 1.0);
+    QVERIFY(!context.hasWarmStart());
+    context.storeStep({0.0, 0.0, 0.0, 0.0}, {0.1, -0.3, 0.0, 0.2});
+    QVERIFY(context.hasWarmStart());
+    QCOMPARE(context.getInitialStep(), 0.3);
+    //the step is bounded to [0.01, 0.5] of the control range
+    context.storeStep({0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0});
+    QCOMPARE(context.getInitialStep(), 0.02);
+    context.storeStep({-1.0, -1.0, -1.0, -1.0}, {1.0, 1.0, 1.0, 1.0});
+    QCOMPARE(context.getInitialStep(), 1.0);
+    //a rebuild starts cold
+    context.getOptimizer(nlopt::LN_COBYLA, 6, -1.0, 1.0);
+    QVERIFY(!context.hasWarmStart());
+    context.storeStep({0.0}, {0.1});
+    context.invalidate();
+    QVERIFY(!context.hasWarmStart());
+}
+
+void SolverContextTest::constraintRegistration() {
+    SolverContext context;
+    int first = 0, second = 0;
+    const std::vector<const void*> constraints = {&first, &second};
+    context.getOptimizer(nlopt::LN_COBYLA, 4, -1.0, 1.0);
+    QVERIFY(context.needsConstraintUpdate(constraints));
+    context.setConstraints(constraints);
+    QVERIFY(!context.needsConstraintUpdate(constraints));
+    QCOMPARE(context.getConstraintUpdates(), size_t(1));
+    //same objects in another order or a changed set are registered again
+    QVERIFY(context.needsConstraintUpdate({&second, &first}));
+    QVERIFY(context.needsConstraintUpdate({&first}));
+    //the same parameters keep the registration, a rebuilt optimizer has none
+    context.getOptimizer(nlopt::LN_COBYLA, 4, -1.0, 1.0);
+    QVERIFY(!context.needsConstraintUpdate(constraints));
+    context.getOptimizer(nlopt::LN_COBYLA, 4, -0.5, 0.5);
+    QVERIFY(context.needsConstraintUpdate(constraints));
+    context.setConstraints(constraints);
+    QCOMPARE(context.getConstraintUpdates(), size_t(2));
+}
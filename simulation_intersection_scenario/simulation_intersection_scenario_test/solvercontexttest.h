@@ -0,0 +1,22 @@
+#ifndef SOLVERCONTEXTTEST_H
+#define SOLVERCONTEXTTEST_H
+
+#include <QtTest/QtTest>
+
+/**
+ * @brief The SolverContextTest class tests the reuse of the optimizer across the MPC steps
+ */
+class SolverContextTest : public QObject
+{
+    Q_OBJECT
+public:
+    SolverContextTest();
+private slots:
+    void rebuildOnlyOnChange();
+    void warmStart();
+    void constraintRegistration();
+private:
+
+};
+
+#endif // SOLVERCONTEXTTEST_H
@@ -0,0 +1,67 @@
+#include "systemfunctiontest.h"
+#include "../systemfunction.h"
+#include "../integrator.h"
+
+#include <cmath>
+
+SystemFunctionTest::SystemFunctionTest()
+{
+}
+
+void SystemFunctionTest::calculateTrajectory() {
+    std::vector<double> startPos({0.0, 0.0});
+    SystemFunction sysFunc("car0", startPos);
+    std::vector<std::vector<double> > u;
+    double t0 = 0;
+    unsigned int T = 1;
+    unsigned N = 3;
+    for (unsigned int i = 0; i < N; i++) {
+        u.push_back({1.0, 0.5});
+    }
+
+    std::vector<std::vector<double> > x = sysFunc.getHolonomicSystemTrajectory(sysFunc.getCurrentContinuousState(), u, t0, T, N);
+    std::vector<std::vector<double> > refTrajectory;
+    refTrajectory.push_back(startPos);
+    for (unsigned int i = 0; i < N; i++) {
+        refTrajectory.push_back({refTrajectory.back().at(0) + 1.0, refTrajectory.back().at(1) + 0.5});
+    }
+    QCOMPARE(x, refTrajectory);
+}
+
+void SystemFunctionTest::compareIntegrators() {
+    std::vector<double> x0({1.0, 2.0});
+    std::vector<double> u({0.5, -1.0});
+    double t0 = 3.0;
+    double tEnd = 3.5;
+    std::vector<double> ref = Integrator::create(IntegratorType::EXACT)->integrate(SystemFunction::holonomicDynamics, x0, u, t0, tEnd);
+    QCOMPARE(ref, std::vector<double>({1.25, 1.5}));
+    for (const IntegratorType& type : {IntegratorType::EULER, IntegratorType::RK4, IntegratorType::ADAPTIVE}) {
+        std::vector<double> x = Integrator::create(type)->integrate(SystemFunction::holonomicDynamics, x0, u, t0, tEnd);
+        for (unsigned int j = 0; j < x.size(); j++) {
+            QVERIFY(std::abs(x.at(j) - ref.at(j)) < 1e-9);
+        }
+    }
+}
+
+void SystemFunctionTest::trajectoryStorage() {
+    std::vector<double> startPos({1.0, 2.0});
+    SystemFunction sysFunc("car0", startPos);
+    std::vector<double> u({0.5, -1.0, 1.0, 0.25, -0.5, 0.0});
+    double t0 = 0.0;
+    double T = 0.5;
+    size_t N = 4;
+    Trajectory x;
+    sysFunc.getHolonomicSystemTrajectory(startPos, u.data(), t0, T, N, x);
+    QCOMPARE(x.size(), N);
+    QCOMPARE(x.x(0), 1.0);
+    QCOMPARE(x.x(3), 1.5);
+    QCOMPARE(x.y(3), 1.625);
+    QCOMPARE(x.values(), sysFunc.getCachedHolonomicSystemTrajectory1d(u, t0, T, N));
+    //other integrators are evaluated step by step
+    sysFunc.setIntegrator(Integrator::create(IntegratorType::RK4));
+    Trajectory xRK4;
+    sysFunc.getHolonomicSystemTrajectory(startPos, u.data(), t0, T, N, xRK4);
+    for (unsigned int i = 0; i < x.values().size(); i++) {
+        QVERIFY(std::abs(x.values().at(i) - xRK4.values().at(i)) < 1e-9);
+    }
+}
@@ -13,6 +13,8 @@ public:
     SystemFunctionTest();
 private slots:
     void calculateTrajectory();
+    void compareIntegrators();
+    void trajectoryStorage();
 private:
 
 };
@@ -0,0 +1,90 @@
+#include "simulationcontext.h"
+#include "intersection.h"
+#include "car.h"
+
+/**
+ * @brief SimulationContext::SimulationContext
+ * @param interSection grid of the intersection
+ */
+SimulationContext::SimulationContext(const std::shared_ptr<InterSection>& interSection) :
+    m_interSection(interSection)
+{
+}
+
+/**
+ * @brief SimulationContext::getInterSection
+ * @return grid of the intersection
+ */
+std::shared_ptr<InterSection> SimulationContext::getInterSection() const {
+    return m_interSection;
+}
+
+/**
+ * @brief SimulationContext::setInterSection
+ * @param interSection
+ */
+void SimulationContext::setInterSection(const std::shared_ptr<InterSection>& interSection) {
+    m_interSection = interSection;
+}
+
+/**
+ * @brief SimulationContext::getCars
+ * @return all cars of the simulation
+ */
+const std::list<std::shared_ptr<Car> >& SimulationContext::getCars() const {
+    return m_cars;
+}
+
+/**
+ * @brief SimulationContext::addCar
+ * @param car
+ */
+void SimulationContext::addCar(const std::shared_ptr<Car>& car) {
+    m_cars.push_back(car);
+}
+
+/**
+ * @brief SimulationContext::clearCars removes all cars, e.g. before a new run, the IDs start again from 0
+ */
+void SimulationContext::clearCars() {
+    m_cars.clear();
+    m_carIds.clear();
+    m_carNames.clear();
+}
+
+/**
+ * @brief SimulationContext::registerCarName assigns the next free ID to the name, a name which is already
+ * registered keeps its ID
+ * @param name unique name of the car
+ * @return ID of the car
+ */
+CarId SimulationContext::registerCarName(const QString& name) {
+    auto itId = m_carIds.constFind(name);
+    if (itId != m_carIds.constEnd()) {
+        return itId.value();
+    }
+    const CarId id = static_cast<CarId>(m_carNames.size());
+    m_carIds.insert(name, id);
+    m_carNames.append(name);
+    return id;
+}
+
+/**
+ * @brief SimulationContext::getCarName
+ * @param id
+ * @return name of the car, empty if the ID is not assigned
+ */
+QString SimulationContext::getCarName(const CarId& id) const {
+    if (id >= static_cast<CarId>(m_carNames.size())) {
+        return QString();
+    }
+    return m_carNames.at(static_cast<int>(id));
+}
+
+/**
+ * @brief SimulationContext::getNumberOfCarIds
+ * @return number of assigned IDs, all IDs are smaller
+ */
+size_t SimulationContext::getNumberOfCarIds() const {
+    return static_cast<size_t>(m_carNames.size());
+}
@@ -0,0 +1,45 @@
+#ifndef SIMULATIONCONTEXT_H
+#define SIMULATIONCONTEXT_H
+
+#include "carid.h"
+
+#include <QtCore/QHash>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include <list>
+#include <memory>
+
+class Car;
+class InterSection;
+
+/**
+ * @brief The SimulationContext class owns everything, which is shared inside one simulation (the intersection grid
+ * and all cars). It is created by the SimulationThread and passed down to the cars, the path algorithms
+ * and the system functions, which only hold a weak reference. So several simulations can run concurrently in one process.
+ * The context assigns the dense integer IDs of the cars, the names are only kept for display and output.
+ */
+class SimulationContext
+{
+public:
+    explicit SimulationContext(const std::shared_ptr<InterSection>& interSection);
+    std::shared_ptr<InterSection> getInterSection() const;
+    void setInterSection(const std::shared_ptr<InterSection>& interSection);
+    const std::list<std::shared_ptr<Car> >& getCars() const;
+    void addCar(const std::shared_ptr<Car>& car);
+    void clearCars();
+    CarId registerCarName(const QString& name);
+    QString getCarName(const CarId& id) const;
+    size_t getNumberOfCarIds() const;
+private:
+    ///grid of the intersection
+    std::shared_ptr<InterSection> m_interSection;
+    ///all cars of the simulation (the former global car list)
+    std::list<std::shared_ptr<Car> > m_cars;
+    ///ID of the car names
+    QHash<QString, CarId> m_carIds;
+    ///names of the cars by ID
+    QVector<QString> m_carNames;
+};
+
+#endif // SIMULATIONCONTEXT_H
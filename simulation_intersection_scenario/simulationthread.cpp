@@ -1,13 +1,17 @@
 #include "simulationthread.h"
-#include "globalcarlist.h"
 #include "intersectionparameters.h"
+#include "conflictresolver.h"
 
-#include <QtTest/QTest>
+#include <QtCore/QCoreApplication>
 #include <QtCore/QStringList>
 #include <QtCore/QVariantList>
 #include <QtCore/QMap>
 #include <QtCore/QStringBuilder>
 
+#include <algorithm>
+#include <atomic>
+#include <future>
+
 
 /**
  * @brief SimulationThread::SimulationThread initializes a separate thread to run calculations
@@ -40,7 +44,11 @@ SimulationThread::SimulationThread(const int &width, const int &height, const in
     m_radius(robotDiameter),
     m_priority(priority),
     m_pathAlgorithm(pathAlgorithm),
-    m_numberOfCars(0)
+    m_numberOfCars(0),
+    m_ocpWorkerThreads(InterSectionParameters::ocpWorkerThreads),
+    m_runMode(InterSectionParameters::runMode),
+    m_frameSemaphore(0),
+    m_seed(0)
 
 {
     /*if (priority == PriorityCriteria::FIXED || priority == PriorityCriteria::MAXCLOSEDLOOPCOSTS
@@ -54,7 +62,7 @@ SimulationThread::SimulationThread(const int &width, const int &height, const in
     }*/
     qRegisterMetaType<std::vector<std::vector<double> >>("std::vector<std::vector<double> >");
     qRegisterMetaType<QMap<int,int> >("QMap<int,int>");
-    interSection = std::make_shared<InterSection>(k, m, m_currentGridSize);
+    m_context = std::make_shared<SimulationContext>(std::make_shared<InterSection>(k, m, m_currentGridSize, m_T));
     eval.disableTitle(true);
     debugFile.setFileName("debugOut.txt");
 
@@ -89,13 +97,71 @@ void SimulationThread::resume()
     pauseSimulation.wakeOne();
 }
 
+/**
+ * @brief SimulationThread::frameTick is called by the frame timer of the GUI and releases the next simulation step
+ * in real time mode, at most one frame is stored, so a slow step is not followed by a burst of steps
+ */
+void SimulationThread::frameTick()
+{
+    if (m_frameSemaphore.available() == 0) {
+        m_frameSemaphore.release();
+    }
+}
+
+/**
+ * @brief SimulationThread::setRunMode sets the pacing of the simulation, a waiting step is released when switching to fast forward
+ * @param mode real time (paced by frameTick) or fast forward
+ */
+void SimulationThread::setRunMode(const RunMode &mode)
+{
+    m_runMode = mode;
+    if (mode == RunMode::FASTFORWARD) {
+        frameTick();
+    }
+}
+
+/**
+ * @brief SimulationThread::setSeed sets the seed for the random arrival of the cars, which makes a run reproducible,
+ * has to be set before the simulation is started
+ * @param seed 0 for a non-deterministic seed
+ */
+void SimulationThread::setSeed(const unsigned int &seed)
+{
+    m_seed = seed;
+}
+
+/**
+ * @brief SimulationThread::getRunMode
+ * @return current run mode
+ */
+RunMode SimulationThread::getRunMode() const
+{
+    return m_runMode;
+}
+
+/**
+ * @brief SimulationThread::waitForFrame blocks in real time mode until the GUI frame timer released the next frame,
+ * in fast forward mode it returns immediately
+ */
+void SimulationThread::waitForFrame()
+{
+    if (m_runMode == RunMode::REALTIME) {
+        m_frameSemaphore.acquire();
+    }
+    else {
+        //drop a frame, which was released while switching the mode
+        m_frameSemaphore.tryAcquire();
+    }
+}
+
 /** @brief build intersection and start thread running
  */
 void SimulationThread::startSimulation()
 {
     qDebug() << "horizon length: " << m_N;
-    if (InterSectionParameters::varyCellSize == 0) {
-        //interSection->setCellSize(1.0);
+    //a headless run is one single simulation run, the results are written by the ResultWriter
+    if (InterSectionParameters::varyCellSize == 0 || isHeadless()) {
+        //m_context->getInterSection()->setCellSize(1.0);
         makeCarsAndIntersection();
         //initialize first costs here
         //should only be done in the beginning - countSteps == 0
@@ -149,7 +215,7 @@ void SimulationThread::startMultipleSimRuns() {
     eval.setGridSizeToCosts(eval.getCostsToCellSize(CostType::OPENLOOP), CostType::OPENLOOP);
     //TODO: clean up simulation-runtime-based costs and comm. costs
     //catch up roundoff-limit
-    QApplication::processEvents();
+    QCoreApplication::processEvents();
     if (m_currentGridSize < m_gridSize.second && m_commScheme != CommunicationScheme::CONTINUOUS) {
         if (m_currentGridSize == 2.0) {
             m_currentGridSize += 1.0;
@@ -181,12 +247,15 @@ void SimulationThread::startMultipleSimRuns() {
     }
     //run now the simulation with continuous communcation and without any gridsize
     else if (m_currentGridSize == m_gridSize.second && m_commScheme == CommunicationScheme::DIFFERENTIAL) {
+#ifndef INTERSECTION_HEADLESS
         eval.plotDifferentialCommunicationAndNormalCommunicationToCellSize(true, true);
+#endif
         m_commScheme = CommunicationScheme::CONTINUOUS;
         m_currentGridSize = 0.0;
         makeCarsAndIntersection();
         startSimulation();
     }
+#ifndef INTERSECTION_HEADLESS
     else {
         eval.plotCommEffortCostsInfinity(CostType::CLOSEDLOOP);
         eval.plotCommEffortCostsInfinity(CostType::OPENLOOP);
@@ -200,7 +269,8 @@ void SimulationThread::startMultipleSimRuns() {
         }
         if (m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORY || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORY
                 || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYHIERARCHY
-                || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYTREE || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYTREE) {
+                || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYTREE || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYTREE
+                || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSCOLORING || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSCOLORING) {
             eval.plotMaxPriorityQueueLength(maxCars, m_N, m_priority.getTextForChosenCriteria(m_priority.getPriorityCriteria()));
             eval.plotNumberOfPriorityQueues(maxCars, m_N, m_priority.getTextForChosenCriteria(m_priority.getPriorityCriteria()));
         }
@@ -220,6 +290,7 @@ void SimulationThread::startMultipleSimRuns() {
             }
         }
     }
+#endif
 }
 
 /** @brief demonstrate: calculate one step at a time
@@ -233,17 +304,19 @@ void SimulationThread::run()
     while (!targetReached) {
         outStream << "Step: " << countSteps << endl;
         emit steps(countSteps);
-        interSection->copyCurrentPositionsToPreliminaries();
+        m_context->getInterSection()->copyCurrentPositionsToPreliminaries();
         updateCellReservations();
         //take the first step for solution
-        std::map<QString, PathItem> nextTargets;
-        std::map<QString, std::vector<std::vector<double> > > continTargets = calculateStep(nextTargets);
+        CarIndexed<PathItem> nextTargets;
+        CarControls continTargets = calculateStep(nextTargets);
 
         //DEBUG
         debugFile.flush();
         //--DEBUG
 
         evaluateStep(nextTargets, continTargets);
+        //in real time mode, the next step is started not before the GUI has shown the next frame
+        waitForFrame();
         //if all cars have reached their target, we are done
         if ( (m_cars.size() == 0 && m_waitCars.size() == 0) || (InterSectionParameters::intersectionalScenario == 1 && InterSectionParameters::stochasticArrival == 1 && countSteps > 120)) {
             targetReached = true;
@@ -265,7 +338,11 @@ void SimulationThread::run()
     debugFile.close();
     mutex.unlock();
 
-    if (InterSectionParameters::sysFuncUsage == SystemFunctionUsage::CONTINUOUS) {
+    if (isHeadless()) {
+        writeResults();
+    }
+#ifndef INTERSECTION_HEADLESS
+    else if (InterSectionParameters::sysFuncUsage == SystemFunctionUsage::CONTINUOUS) {
         eval.plotAppliedContControl(m_N, false);
         eval.plotCosts(m_N,CostType::OPENLOOP, true, false);
         eval.plotCosts(m_N,CostType::CLOSEDLOOP, true, false);
@@ -280,6 +357,7 @@ void SimulationThread::run()
             eval.exportPlots("PDF");
         }
     }
+#endif
     emit simFinished();
 
 
@@ -288,24 +366,24 @@ void SimulationThread::run()
 /** @brief calculate the next step each car will take
  * @param nextTargets
  */
-std::map<QString, std::vector<std::vector<double> >> SimulationThread::calculateStep(std::map<QString, PathItem>& nextTargets)
+CarControls SimulationThread::calculateStep(CarIndexed<PathItem>& nextTargets)
 {
     if (m_constraints.empty()) {
         m_constraints = appendConstraintsFromPosition(m_cars);
     }
     else {
-        m_constraints = deleteOldConstraints(m_constraints);
+        deleteOldConstraints(m_constraints);
     }
     //stochastic arrival for cars
     if (InterSectionParameters::stochasticArrival == 1 && InterSectionParameters::intersectionalScenario == 1) {
         createInterArrivalCars();
         m_cars = insertCarsFromWaitingQueue(m_waitCars, m_cars);
     }
-    std::map<QString, std::vector<std::vector<double> >> continSol;
+    CarControls continSol;
     for (std::shared_ptr<Car>& car : m_cars.getOrderSeq()) {
         car->clearAllConstraints();
         car->createGlobalConstraints();
-        continSol[car->getName()] = VectorHelper::reshapeXd(car->getInitialControl(m_t0, m_T));
+        continSol[car->getId()] = VectorHelper::reshapeXd(car->getInitialControl(m_t0, m_T));
     }
     bool firstCar = true;
     if (m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORY
@@ -313,7 +391,9 @@ std::map<QString, std::vector<std::vector<double> >> SimulationThread::calculate
             || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYHIERARCHY
             || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY
             || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYTREE
-            || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYTREE) {
+            || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYTREE
+            || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSCOLORING
+            || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSCOLORING) {
         m_priority.sortAfterPriority(m_cars, continSol, m_constraints, m_t0, m_T, m_N, m_radius);
     }
     else if (m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTS || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTS) {
@@ -322,88 +402,60 @@ std::map<QString, std::vector<std::vector<double> >> SimulationThread::calculate
     size_t rowSize = m_cars.rowSize();
     for (size_t i = 0; i < rowSize; i++) {
         auto carRow = m_cars.getRow(i);
-        std::multimap<QString, Constraint> constraintsForRow;
+        ConstraintStore constraintsForRow;
+        //cars of one row only read the constraints of the previous rows, so their OCPs can be solved concurrently
+        const bool parallelRow = (InterSectionParameters::sysFuncUsage == SystemFunctionUsage::CONTINUOUS
+                                  && m_ocpWorkerThreads != 1 && carRow.size() > 1 && isRowIndependent());
+        if (parallelRow) {
+            for (std::shared_ptr<Car>& rowCar : carRow) {
+                setConstraintsForCar(rowCar, firstCar);
+            }
+            solveRowConcurrently(carRow, continSol);
+        }
         auto car = carRow.begin();
         while (car != carRow.end()) {
             if (InterSectionParameters::sysFuncUsage == SystemFunctionUsage::DISCRETE) {
-                nextTargets[(*car)->getName()] = (*car)->calcOcpObjective((*car)->getCurrentState());
+                nextTargets[(*car)->getId()] = (*car)->calcOcpObjective((*car)->getCurrentState());
                 (*car)->setCurrentConstraints(m_constraints, m_t0, m_T);
 
-                //currentConstr = car->formulateConstraintsForNextCar(nextTargets[car->getName()], getGlobalTime(), m_T, m_N, firstCar,
+                //currentConstr = car->formulateConstraintsForNextCar(nextTargets[car->getId()], getGlobalTime(), m_T, m_N, firstCar,
                 //        this->m_currentGridSize, this->m_radius, m_commScheme);
                 //firstCar = false;
                 //m_constraints = insertFormulatedConstraints(car->getName(), m_constraints, currentConstr);
             }
             else if (InterSectionParameters::sysFuncUsage == SystemFunctionUsage::CONTINUOUS) {
-                //for each row (cluster) the constraints are deleted
-                if ((m_commScheme != CommunicationScheme::DIFFERENTIAL) && (m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYHIERARCHY
-                    || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY
-                    || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYTREE
-                    || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYTREE)) {
-                    if (firstCar) {
-                        m_constraints.clear();
-                    }
-                }
-                //remove predictions from own car, because new prediction will be calculated
-                //TODO: has to be done later, because for difference communication purpose
-                //m_constraints = car->removeOldPredictions(m_constraints);
-                //set current constraints from other cars except own
-                if (m_commScheme == CommunicationScheme::MINMAXINTERVAL || m_commScheme == CommunicationScheme::MINMAXINTERVALMOVING) {
-                    (*car)->constructConstraintFromMinMaxConstraints(m_constraints, m_t0, m_T, m_N, this->m_currentGridSize, this->m_radius, this->m_commScheme);
-                }
-                else {
-                    if (m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYTREE
-                            || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYTREE) {
-                        std::list<std::shared_ptr<Car> > predList;
-                        m_cars.computeRecursivePredecessors((*car), predList);
-                        (*car)->setConstraintsFromPredecessors(m_constraints, predList, m_t0, m_T);
-                    }
-                    else if (m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTS
-                             ||m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTS ) {
-                        (*car)->setCurrentConstraints(m_constraints,m_t0, m_T);
-                    }
-                    else {
-                        if (m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY
-                                || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYHIERARCHY) {
-                            std::list<std::shared_ptr<Car> > predList;
-                            m_cars.computeRecursivePredecessors((*car), predList);
-                            (*car)->setConstraintsFromPredecessors(m_constraints, predList, m_t0, m_T);
-                        }
-                        else {
-                            //if (!firstCar) {
-                                (*car)->setCurrentConstraints(m_constraints,m_t0, m_T);
-                            //}
-                        }
-
-                    }
+                if (!parallelRow) {
+                    setConstraintsForCar((*car), firstCar);
+                    continSol[(*car)->getId()] = (*car)->calcOcpObjectiveContinuous(VectorHelper::reshapeXdTo1d(continSol.at((*car)->getId())), getGlobalTime(), m_T);
                 }
-                continSol[(*car)->getName()] = (*car)->calcOcpObjectiveContinuous(VectorHelper::reshapeXdTo1d(continSol.at((*car)->getName())), getGlobalTime(), m_T);
 
                 emit updateCarGUIReservationsClear((*car)->getName());
                 //formulate own constraints
 
                 std::vector<Constraint> currentConstr;
                 if (m_commScheme == CommunicationScheme::FULL || m_commScheme == CommunicationScheme::DIFFERENTIAL) {
-                    currentConstr = (*car)->formulateConstraintsForNextCar(continSol[(*car)->getName()], getGlobalTime(), m_T, m_N, firstCar, this->m_currentGridSize, this->m_radius, m_commScheme);
+                    currentConstr = (*car)->formulateConstraintsForNextCar(continSol[(*car)->getId()], getGlobalTime(), m_T, m_N, firstCar, this->m_currentGridSize, this->m_radius, m_commScheme);
                 }
                 else if (m_commScheme == CommunicationScheme::MINMAXINTERVAL || m_commScheme == CommunicationScheme::MINMAXINTERVALMOVING) {
-                    currentConstr = (*car)->calculateMinMaxConstraintForNextCar(continSol[(*car)->getName()], getGlobalTime(), m_T, m_N, firstCar, this->m_currentGridSize, this->m_radius, m_commScheme);
+                    currentConstr = (*car)->calculateMinMaxConstraintForNextCar(continSol[(*car)->getId()], getGlobalTime(), m_T, m_N, firstCar, this->m_currentGridSize, this->m_radius, m_commScheme);
                 }
                 else if (m_commScheme == CommunicationScheme::CONTINUOUS) {
                     //we do not use a grid here, therefore avoid grid size
-                    currentConstr = (*car)->formulateConstraintsForNextCar(continSol[(*car)->getName()], getGlobalTime(), m_T, m_N, firstCar, 0.0, this->m_radius, m_commScheme);
+                    currentConstr = (*car)->formulateConstraintsForNextCar(continSol[(*car)->getId()], getGlobalTime(), m_T, m_N, firstCar, 0.0, this->m_radius, m_commScheme);
                 }
                 firstCar = false;
                 if ( m_priority.getPriorityCriteria() != PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY
                         && m_priority.getPriorityCriteria() != PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYHIERARCHY
                         && m_priority.getPriorityCriteria() != PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYTREE
                         && m_priority.getPriorityCriteria() != PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYTREE
+                        && m_priority.getPriorityCriteria() != PriorityCriteria::MINOPENLOOPCOSTSCOLORING
+                        && m_priority.getPriorityCriteria() != PriorityCriteria::MINCLOSEDLOOPCOSTSCOLORING
                         /*&& m_priority.getPriorityCriteria() != PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORY
                         && m_priority.getPriorityCriteria() != PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORY*/) {
-                    m_constraints = insertFormulatedConstraints((*car)->getName(), m_constraints, currentConstr);
+                    insertFormulatedConstraints((*car)->getId(), m_constraints, currentConstr);
                 }
                 else {
-                    constraintsForRow = insertFormulatedConstraints((*car)->getName(), constraintsForRow, currentConstr);
+                    insertFormulatedConstraints((*car)->getId(), constraintsForRow, currentConstr);
                 }
             }
 
@@ -429,7 +481,6 @@ std::map<QString, std::vector<std::vector<double> >> SimulationThread::calculate
                 //qDebug() << "emitted position for car "<< car->getName() <<  ": " << car->getCurrentStateContinuous().at(0) << "," << car->getCurrentStateContinuous().at(1);
                 //--DEBUG
             }
-            msleep(100);
             car++;
         }//--car for carRow
         //when one row in the prioriy queue is solved, for the next independent row the former constraint do not matter
@@ -439,21 +490,24 @@ std::map<QString, std::vector<std::vector<double> >> SimulationThread::calculate
         else if (m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYHIERARCHY
                  || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY
                  || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYTREE
-                 || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYTREE) {
+                 || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYTREE
+                 || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSCOLORING
+                 || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSCOLORING) {
             //remove constraints from cars, which are shifted to the later hierarchy
-            QStringList removedCars = m_priority.testCurrentCarsForCurrentRow(m_cars, continSol, carRow, this->m_radius, m_t0, m_T, m_N);
+            std::vector<CarId> removedCars = m_priority.testCurrentCarsForCurrentRow(m_cars, continSol, carRow, this->m_radius, m_t0, m_T, m_N);
             if (!removedCars.empty()) {
-                for (auto carName : removedCars) {
-                    constraintsForRow = removeConstraintsOfMovedCars(carName, constraintsForRow);
+                for (const CarId& carId : removedCars) {
+                    removeConstraintsOfMovedCars(carId, constraintsForRow);
                     //clear the prediction, as this is invalid
-                    if (m_cars.getCarById(carName)) {
-                        m_cars.getCarById(carName)->clearPrediction(continSol.at(carName));
+                    std::shared_ptr<Car> movedCar = m_cars.getCarById(carId);
+                    if (movedCar) {
+                        movedCar->clearPrediction(continSol.at(carId));
                     }
                 }
                 //update row size
                 rowSize = m_cars.rowSize();
             }
-            m_constraints.insert(constraintsForRow.begin(), constraintsForRow.end());
+            m_constraints.merge(constraintsForRow);
             constraintsForRow.clear();
         }
     }
@@ -476,48 +530,201 @@ std::map<QString, std::vector<std::vector<double> >> SimulationThread::calculate
     return continSol;
 }
 
+/**
+ * @brief SimulationThread::setConstraintsForCar sets the constraints of the other cars for car according to the priority criteria
+ * and the communication scheme (continuous setting)
+ * @param car
+ * @param firstCar true, if no car has formulated its constraints in this step
+ */
+void SimulationThread::setConstraintsForCar(const std::shared_ptr<Car>& car, const bool& firstCar) {
+    //for each row (cluster) the constraints are deleted
+    if ((m_commScheme != CommunicationScheme::DIFFERENTIAL) && (m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYHIERARCHY
+        || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY
+        || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYTREE
+        || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYTREE
+        || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSCOLORING
+        || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSCOLORING)) {
+        if (firstCar) {
+            m_constraints.clear();
+        }
+    }
+    //remove predictions from own car, because new prediction will be calculated
+    //TODO: has to be done later, because for difference communication purpose
+    //m_constraints = car->removeOldPredictions(m_constraints);
+    //set current constraints from other cars except own
+    if (m_commScheme == CommunicationScheme::MINMAXINTERVAL || m_commScheme == CommunicationScheme::MINMAXINTERVALMOVING) {
+        car->constructConstraintFromMinMaxConstraints(m_constraints, m_t0, m_T, m_N, this->m_currentGridSize, this->m_radius, this->m_commScheme);
+    }
+    else {
+        if (m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYTREE
+                || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYTREE) {
+            std::list<std::shared_ptr<Car> > predList;
+            m_cars.computeRecursivePredecessors(car, predList);
+            car->setConstraintsFromPredecessors(m_constraints, predList, m_t0, m_T);
+        }
+        else if (m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTS
+                 ||m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTS ) {
+            car->setCurrentConstraints(m_constraints,m_t0, m_T);
+        }
+        else {
+            if (m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY
+                    || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYHIERARCHY) {
+                std::list<std::shared_ptr<Car> > predList;
+                m_cars.computeRecursivePredecessors(car, predList);
+                car->setConstraintsFromPredecessors(m_constraints, predList, m_t0, m_T);
+            }
+            else {
+                //if (!firstCar) {
+                    car->setCurrentConstraints(m_constraints,m_t0, m_T);
+                //}
+            }
+
+        }
+    }
+}
+
+/**
+ * @brief SimulationThread::isRowIndependent tests, if the cars inside one row do not depend on each other, this holds for the
+ * hierarchical, tree-based and colouring criteria, where the formulated constraints of a row are only given to the next rows
+ * @return true, if the OCPs of a row can be solved concurrently
+ */
+bool SimulationThread::isRowIndependent() const {
+    return (m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYHIERARCHY
+            || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYHIERARCHY
+            || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSWITHMEMORYTREE
+            || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSWITHMEMORYTREE
+            || m_priority.getPriorityCriteria() == PriorityCriteria::MINOPENLOOPCOSTSCOLORING
+            || m_priority.getPriorityCriteria() == PriorityCriteria::MINCLOSEDLOOPCOSTSCOLORING);
+}
+
+/**
+ * @brief SimulationThread::solveRowConcurrently solves the OCPs of all cars in carRow with a pool of worker threads,
+ * the constraints have to be set before. Each worker takes the next unsolved car, the solutions are written
+ * to continSol in the order of the row, therefore the result does not depend on the scheduling
+ * @param carRow cars of one row
+ * @param continSol initial controls, replaced by the optimal controls
+ */
+void SimulationThread::solveRowConcurrently(const std::vector<std::shared_ptr<Car> >& carRow, CarControls& continSol) {
+    std::vector<std::vector<double> > initialControls;
+    initialControls.reserve(carRow.size());
+    for (const std::shared_ptr<Car>& car : carRow) {
+        initialControls.push_back(VectorHelper::reshapeXdTo1d(continSol.at(car->getId())));
+    }
+    std::vector<std::vector<std::vector<double> > > solutions(carRow.size());
+    const double t0 = getGlobalTime();
+    const double T = m_T;
+    std::atomic<size_t> nextCar(0);
+    auto worker = [&]() {
+        for (size_t i = nextCar++; i < carRow.size(); i = nextCar++) {
+            solutions[i] = carRow.at(i)->calcOcpObjectiveContinuous(initialControls.at(i), t0, T);
+        }
+    };
+    unsigned int workerThreads = m_ocpWorkerThreads;
+    if (workerThreads == 0) {
+        workerThreads = std::max(1, QThread::idealThreadCount());
+    }
+    workerThreads = std::min<unsigned int>(workerThreads, carRow.size());
+    std::vector<std::future<void> > workers;
+    for (unsigned int i = 1; i < workerThreads; i++) {
+        workers.push_back(std::async(std::launch::async, worker));
+    }
+    //the simulation thread works as well
+    worker();
+    for (std::future<void>& w : workers) {
+        w.get();
+    }
+    for (size_t i = 0; i < carRow.size(); i++) {
+        continSol[carRow.at(i)->getId()] = solutions.at(i);
+    }
+}
+
+/**
+ * @brief SimulationThread::setOcpWorkerThreads sets the number of threads to solve the OCPs of independent cars,
+ * 1 solves sequentially, 0 uses QThread::idealThreadCount()
+ * @param threads
+ */
+void SimulationThread::setOcpWorkerThreads(const unsigned int& threads) {
+    m_ocpWorkerThreads = threads;
+}
+
+/**
+ * @brief SimulationThread::setResultWriter sets the writer for the results, with a writer the simulation runs headless:
+ * one single run without plots, the results are written to files instead
+ * @param writer
+ */
+void SimulationThread::setResultWriter(const std::shared_ptr<ResultWriter>& writer) {
+    m_resultWriter = writer;
+}
+
+/**
+ * @brief SimulationThread::isHeadless
+ * @return true, if the results are written by a ResultWriter instead of plotted
+ */
+bool SimulationThread::isHeadless() const {
+    return (m_resultWriter != nullptr);
+}
+
+/**
+ * @brief SimulationThread::writeResults writes the trajectories, the costs per car and step and a summary of the run
+ */
+void SimulationThread::writeResults() {
+    std::map<QString, std::vector<double> > closedLoopCosts = eval.getCostsContinuous(CostType::CLOSEDLOOP);
+    std::map<QString, std::vector<double> > openLoopCosts = eval.getCostsContinuous(CostType::OPENLOOP);
+    double closedLoopSum = 0.0;
+    for (const auto& carCosts : eval.sumCostsOfCarToInfinity(closedLoopCosts)) {
+        closedLoopSum += carCosts.second;
+    }
+    double openLoopSum = 0.0;
+    for (const auto& carCosts : eval.sumCostsOfCarToInfinity(openLoopCosts)) {
+        openLoopSum += carCosts.second;
+    }
+    unsigned int maxConflictRounds = 0;
+    for (const auto& stepRounds : eval.getConflictRoundsPerStep()) {
+        maxConflictRounds = std::max(maxConflictRounds, stepRounds.second);
+    }
+    qulonglong unresolvedConflicts = 0;
+    for (const auto& stepCars : eval.getUnresolvedConflictsPerStep()) {
+        unresolvedConflicts += stepCars.second;
+    }
+    m_resultWriter->setSummaryValue("width", getGridWidth());
+    m_resultWriter->setSummaryValue("height", getGridHeight());
+    m_resultWriter->setSummaryValue("cars", m_numberOfCars);
+    m_resultWriter->setSummaryValue("N", m_N);
+    m_resultWriter->setSummaryValue("T", m_T);
+    m_resultWriter->setSummaryValue("cellSize", m_currentGridSize);
+    m_resultWriter->setSummaryValue("commScheme", (int)m_commScheme);
+    m_resultWriter->setSummaryValue("priority", PrioritySorter::getTextForChosenCriteria(m_priority.getPriorityCriteria()));
+    m_resultWriter->setSummaryValue("seed", m_seed);
+    m_resultWriter->setSummaryValue("steps", countSteps);
+    m_resultWriter->setSummaryValue("closedLoopCosts", closedLoopSum);
+    m_resultWriter->setSummaryValue("openLoopCosts", openLoopSum);
+    m_resultWriter->setSummaryValue("commEffort", eval.getCommConstraintsForWholeSim(eval.getCommConstraintsPerStep()).second);
+    m_resultWriter->setSummaryValue("maxConflictRounds", maxConflictRounds);
+    m_resultWriter->setSummaryValue("unresolvedConflicts", unresolvedConflicts);
+    m_resultWriter->writeTrajectories();
+    m_resultWriter->writeCosts(closedLoopCosts, "costs_closedloop.csv");
+    m_resultWriter->writeCosts(openLoopCosts, "costs_openloop.csv");
+    m_resultWriter->writeSummary();
+}
+
 /** @brief evaluate the intersection after step is taken
  * @param nextTargets
  */
-void SimulationThread::evaluateStep(std::map<QString, PathItem> &nextTargets, const std::map<QString, std::vector<std::vector<double> > > &continSol)
+void SimulationThread::evaluateStep(CarIndexed<PathItem> &nextTargets, const CarControls &continSol)
 {
     if (InterSectionParameters::sysFuncUsage == SystemFunctionUsage::DISCRETE) {
-        //try to reserve all preliminary solutions
-        std::vector<std::shared_ptr<Car> > carsWithInvalidSolution;
-        //interSection->printReservations();
-        for (std::shared_ptr<Car>& car : m_cars.getOrderSeq()) {
-            bool isValid = car->reservePrelimSolution();
-            if (!isValid) {
-                carsWithInvalidSolution.push_back(car);
-            }
-        }
-        //for invalid solution, which cannot be reserved, reoptimize
-        //at first, recopy the reserved positions
-        if (carsWithInvalidSolution.size() > 0) {
-            while (carsWithInvalidSolution.size() > 0) {
-                interSection->copyCurrentPositionsToPreliminaries();
-                for (std::shared_ptr<Car>& car : carsWithInvalidSolution) {
-                    nextTargets[car->getName()] = car->calcOcpObjective(car->getCurrentState());
-                }
-                //apply again the optimized solution and remove cars with valid solutions
-                std::vector<std::shared_ptr<Car> >::iterator it = carsWithInvalidSolution.begin();
-                while ( it != carsWithInvalidSolution.end()) {
-                    bool isValid = (*it)->reservePrelimSolution();
-                    if (isValid) {
-                        carsWithInvalidSolution.erase(it);
-                    }
-                    else {
-                        it++;
-                    }
-                }
-
-            }//--while - invalid solutions
-        }//-- invalid solutions
+        //reserve all preliminary solutions, conflicts are resolved by priority in batches
+        unsigned int rounds = 0;
+        std::vector<std::shared_ptr<Car> > unresolvedCars = resolveReservationConflicts(nextTargets, rounds);
+        eval.saveConflictResolution(countSteps, rounds, unresolvedCars.size());
     }//--discrete steps
     else if (InterSectionParameters::sysFuncUsage == SystemFunctionUsage::CONTINUOUS) {
         for (std::shared_ptr<Car>& car : m_cars.getOrderSeq()) {
             //apply solution (u(0)) for continuous purpose
-            car->applyNextState(continSol.at(car->getName()).at(0), getGlobalTime(), getGlobalTime() + m_T);
+            car->applyNextState(continSol.at(car->getId()).at(0), getGlobalTime(), getGlobalTime() + m_T);
+            if (m_resultWriter) {
+                m_resultWriter->addState(car->getName(), getGlobalTime() + m_T, car->getCurrentStateContinuous());
+            }
         }
     }
 
@@ -527,8 +734,8 @@ void SimulationThread::evaluateStep(std::map<QString, PathItem> &nextTargets, co
         //DEBUG
         /*if (car->getName() == "car0") {
             QString str = "";
-            std::cout << "PathItemNext: " << nextTargets.at(car->getName()).getTime() << "," << nextTargets.at(car->getName()).getX()
-                         << nextTargets.at(car->getName()).getY();
+            std::cout << "PathItemNext: " << nextTargets.at(car->getId()).getTime() << "," << nextTargets.at(car->getId()).getX()
+                         << nextTargets.at(car->getId()).getY();
         }*/
         //--DEBUG
         //TODO: Ausgabe für contin. Simulation
@@ -537,8 +744,8 @@ void SimulationThread::evaluateStep(std::map<QString, PathItem> &nextTargets, co
                       << car->getCurrentState().getTime() << "," << car->getCurrentState().getX() << ","
                       << car->getCurrentState().getY()
                       << " PathItem: "
-                      << nextTargets.at(car->getName()).getTime() << "," << nextTargets.at(car->getName()).getX() << ","
-                      << nextTargets.at(car->getName()).getY()
+                      << nextTargets.at(car->getId()).getTime() << "," << nextTargets.at(car->getId()).getX() << ","
+                      << nextTargets.at(car->getId()).getY()
                       << " Target: "
                       << car->getTarget().getTime() << "," << car->getTarget().getX() << ","
                       << car->getTarget().getY() << endl;
@@ -563,9 +770,13 @@ void SimulationThread::evaluateStep(std::map<QString, PathItem> &nextTargets, co
             //store nextTargets pathitem of cars
             d_carName.push_back(car->getName());
             d_state.push_back(2); //state =2, which means the pathitem represents next target
-            d_time.push_back((qint64)nextTargets.at(car->getName()).getTime());
-            d_x.push_back((qint64)nextTargets.at(car->getName()).getX());
-            d_y.push_back((qint64)nextTargets.at(car->getName()).getY());
+            d_time.push_back((qint64)nextTargets.at(car->getId()).getTime());
+            d_x.push_back((qint64)nextTargets.at(car->getId()).getX());
+            d_y.push_back((qint64)nextTargets.at(car->getId()).getY());
+            if (m_resultWriter) {
+                m_resultWriter->addState(car->getName(), getGlobalTime() + m_T,
+                                         {(double)nextTargets.at(car->getId()).getX(), (double)nextTargets.at(car->getId()).getY()});
+            }
 
             //get the car to the next discrete state
             car->applyNextState();
@@ -621,16 +832,57 @@ void SimulationThread::evaluateStep(std::map<QString, PathItem> &nextTargets, co
         }
 }
 
+/**
+ * @brief SimulationThread::resolveReservationConflicts reserves the preliminary solutions of all cars in the discrete setting.
+ * In each round the solutions of the remaining cars are reserved as one batch by the ConflictResolver, the cars
+ * which lost a conflict are re-optimized together against the reservations of the round before. After
+ * InterSectionParameters::maxConflictRounds rounds the remaining cars reserve a wait in their cell for this step.
+ * @param nextTargets solutions of the cars, replaced by the re-optimized solutions or the waits
+ * @param rounds number of re-optimization rounds, 0 if the first solutions were free of conflicts
+ * @return cars, which wait in their cell
+ */
+std::vector<std::shared_ptr<Car> > SimulationThread::resolveReservationConflicts(CarIndexed<PathItem> &nextTargets, unsigned int& rounds) {
+    //the order sequence is the priority order
+    const std::vector<std::shared_ptr<Car> > cars = m_cars.getOrderSeq();
+    std::vector<ReservationRequest> requests;
+    requests.reserve(cars.size());
+    for (const std::shared_ptr<Car>& car : cars) {
+        car->rejectPrelimSolution();
+        requests.push_back(ReservationRequest{car->getCurrentState(), car->getCurrentPrelimSolution()});
+    }
+    ConflictResolver resolver(m_T, InterSectionParameters::maxConflictRounds);
+    std::vector<size_t> waiting = resolver.resolve(requests,
+        [&cars](const size_t& index, const PathItem& solution) {
+            return cars.at(index)->reserveSolution(solution);
+        },
+        [this, &cars, &nextTargets](std::vector<ReservationRequest>& currentRequests, const std::vector<size_t>& indices) {
+            //once per round: the preliminary reservations are replaced by the reserved positions of all cars
+            m_context->getInterSection()->copyCurrentPositionsToPreliminaries();
+            for (const size_t& index : indices) {
+                const std::shared_ptr<Car>& car = cars.at(index);
+                nextTargets[car->getId()] = car->calcOcpObjective(car->getCurrentState());
+                currentRequests.at(index).solution = car->getCurrentPrelimSolution();
+            }
+        },
+        rounds);
+    std::vector<std::shared_ptr<Car> > waitingCars;
+    for (const size_t& index : waiting) {
+        nextTargets[cars.at(index)->getId()] = requests.at(index).solution;
+        waitingCars.push_back(cars.at(index));
+    }
+    return waitingCars;
+}
+
 /** @brief Tells GUI to update cell with new number of reservations
  */
 void SimulationThread::updateCellReservations()
 {
     if (m_commScheme == CommunicationScheme::FULL || m_commScheme == CommunicationScheme::DIFFERENTIAL || m_commScheme == CommunicationScheme::MINMAXINTERVAL  || m_commScheme == CommunicationScheme::MINMAXINTERVALMOVING) {
-        for (unsigned int i = 0; i < interSection->getGridWidth(); i++)
+        for (unsigned int i = 0; i < m_context->getInterSection()->getGridWidth(); i++)
         {
-            for (unsigned int j = 0; j < interSection->getGridHeight(); j++)
+            for (unsigned int j = 0; j < m_context->getInterSection()->getGridHeight(); j++)
             {
-                unsigned int reserved = interSection->getNumberOfReservations(i, j);
+                unsigned int reserved = m_context->getInterSection()->getNumberOfReservations(i, j);
                 if (Pause) //if pause loop is set
                 {
                     pauseSimulation.wait(&mutex);
@@ -647,7 +899,7 @@ void SimulationThread::updateCellReservations()
 void SimulationThread::makeCarsAndIntersection()
 {
     if (m_commScheme == CommunicationScheme::FULL || m_commScheme == CommunicationScheme::DIFFERENTIAL || m_commScheme == CommunicationScheme::MINMAXINTERVAL  || m_commScheme == CommunicationScheme::MINMAXINTERVALMOVING) {
-        interSection->buildGrid(interSection->getHeight(), interSection->getWidth(), m_currentGridSize);
+        m_context->getInterSection()->buildGrid(m_context->getInterSection()->getHeight(), m_context->getInterSection()->getWidth(), m_currentGridSize);
     }
     mutex.lock();
     //clean up
@@ -656,6 +908,7 @@ void SimulationThread::makeCarsAndIntersection()
     countSteps = 0;
     m_t0 = 0;
     m_constraints.clear();
+    m_context->clearCars();
     eval.clearStatisticsAfterOneRun();
     //--clean up
     double startPos = 0.5;
@@ -670,33 +923,33 @@ void SimulationThread::makeCarsAndIntersection()
         if (InterSectionParameters::sysFuncUsage == SystemFunctionUsage::DISCRETE) {
             if (i % 4 == 0) {
                 //leftside
-                double reserveTime = interSection->reserveNextFreeTimeForCar(nameCar, 0, 0, 0.0);
+                double reserveTime = m_context->getInterSection()->reserveNextFreeTimeForCar(m_context->registerCarName(nameCar), 0, 0, 0.0);
                 pathItem.setCoordinates(0, 0, reserveTime);
                 //target rightside
                 pathCarTarget.setCoordinates(k, 0, 0);
             }
             else if (i % 4 == 1) {
                 //rightside
-                double reserveTime = interSection->reserveNextFreeTimeForCar(nameCar, k, m, 0.0);
+                double reserveTime = m_context->getInterSection()->reserveNextFreeTimeForCar(m_context->registerCarName(nameCar), k, m, 0.0);
                 pathItem.setCoordinates(0, m, reserveTime);
                 //target leftside
                 pathCarTarget.setCoordinates(0, 0, 0);
             }
             else if (i % 4 == 2) {
                 //upside
-                double reserveTime = interSection->reserveNextFreeTimeForCar(nameCar, 0, m, 0.0);
+                double reserveTime = m_context->getInterSection()->reserveNextFreeTimeForCar(m_context->registerCarName(nameCar), 0, m, 0.0);
                 pathItem.setCoordinates(k, 0, reserveTime);
                 //target downside
                 pathCarTarget.setCoordinates(k, m, 0);
             }
             else {
                 //downside
-                double reserveTime = interSection->reserveNextFreeTimeForCar(nameCar, k, 0, 0.0);
+                double reserveTime = m_context->getInterSection()->reserveNextFreeTimeForCar(m_context->registerCarName(nameCar), k, 0, 0.0);
                 pathItem.setCoordinates(k, m, reserveTime);
                 //target upside
                 pathCarTarget.setCoordinates(0, m, 0);
             }
-            car = std::make_shared<Car>(nameCar, pathItem, pathCarTarget, m_N, lambda, m_pathAlgorithm, m_T, m_controlBounds);
+            car = std::make_shared<Car>(nameCar, pathItem, pathCarTarget, m_N, lambda, m_pathAlgorithm, m_T, m_controlBounds, m_context);
             m_numberOfCars++;
 
         }
@@ -739,12 +992,12 @@ void SimulationThread::makeCarsAndIntersection()
                     start = {(double)k - 0.5 - 1.0, startPos + 1.0};
                     target = {0.5 + 1.0, (double)m - startPos - 1.0};
                 }
-                car = std::make_shared<Car>(nameCar, start, target, m_N, lambda, m_pathAlgorithm, m_T, m_controlBounds);
+                car = std::make_shared<Car>(nameCar, start, target, m_N, lambda, m_pathAlgorithm, m_T, m_controlBounds, m_context);
                 m_numberOfCars++;
                 if (m_commScheme != CommunicationScheme::CONTINUOUS) {
-                    std::shared_ptr<InterSectionCell> cell = interSection->getCellFromCoordinates(start);
+                    std::shared_ptr<InterSectionCell> cell = m_context->getInterSection()->getCellFromCoordinates(start);
                     if (cell) {
-                        cell->reserveTimeForCar(car->getName(), 0);
+                        cell->reserveTimeForCar(car->getId(), 0);
                     }
                 }
                 //take here the standard constraints
@@ -788,14 +1041,14 @@ void SimulationThread::makeCarsAndIntersection()
                         target.at(1) -= (double)countDivisor * constraintDistance;
                     }
                 }
-                car = std::make_shared<Car>(nameCar, start, target, m_N, lambda, m_pathAlgorithm, m_T, m_controlBounds);
+                car = std::make_shared<Car>(nameCar, start, target, m_N, lambda, m_pathAlgorithm, m_T, m_controlBounds, m_context);
 m_numberOfCars++;
-                std::shared_ptr<InterSectionCell> cell = interSection->getCellFromCoordinates(start);
-                cell->reserveTimeForCar(car->getName(), 0);
+                std::shared_ptr<InterSectionCell> cell = m_context->getInterSection()->getCellFromCoordinates(start);
+                cell->reserveTimeForCar(car->getId(), 0);
                 //take here the standard constraints
                 car->createGlobalConstraints();
                 //for intersection scenario add directional constraints
-                car->createDirectionalConstraints(interSection->getWidth(), interSection->getHeight(),
+                car->createDirectionalConstraints(m_context->getInterSection()->getWidth(), m_context->getInterSection()->getHeight(),
                                                   m_currentGridSize, m_t0, m_N, m_T, m_radius, m_controlBounds.second);
             }
             if (i % 4 == 3) {
@@ -808,7 +1061,7 @@ m_numberOfCars++;
             //upside
             if (m_commScheme == CommunicationScheme::FULL || m_commScheme == CommunicationScheme::DIFFERENTIAL
                     || m_commScheme == CommunicationScheme::MINMAXINTERVAL || m_commScheme == CommunicationScheme::MINMAXINTERVALMOVING) {
-                double reserveTime = interSection->reserveNextFreeTimeForCar(nameCar, 0, m, 0.0);
+                double reserveTime = m_context->getInterSection()->reserveNextFreeTimeForCar(m_context->registerCarName(nameCar), 0, m, 0.0);
                 pathItem.setCoordinates(0, m, reserveTime);
                 //target downside
                 pathCarTarget.setCoordinates(0, 0, 0);
@@ -818,14 +1071,14 @@ m_numberOfCars++;
             //downside
             if (m_commScheme == CommunicationScheme::FULL || m_commScheme == CommunicationScheme::DIFFERENTIAL
                     || m_commScheme == CommunicationScheme::MINMAXINTERVAL || m_commScheme == CommunicationScheme::MINMAXINTERVALMOVING) {
-                double reserveTime = interSection->reserveNextFreeTimeForCar(nameCar, k, 0, 0.0);
+                double reserveTime = m_context->getInterSection()->reserveNextFreeTimeForCar(m_context->registerCarName(nameCar), k, 0, 0.0);
                 pathItem.setCoordinates(k, 0, reserveTime);
                 //target upside
                 pathCarTarget.setCoordinates(k, m, 0.0);
             }
         }
         m_cars.push_back(car);
-        GlobalCarList::getInstance().push_back(car);
+        m_context->addCar(car);
         if (Pause) //if pause loop is set
         {
             pauseSimulation.wait(&mutex);
@@ -842,21 +1095,21 @@ m_numberOfCars++;
         //tell gui window to add intersection cells
         if (m_commScheme == CommunicationScheme::FULL || m_commScheme == CommunicationScheme::DIFFERENTIAL
                 || m_commScheme == CommunicationScheme::MINMAXINTERVAL || m_commScheme == CommunicationScheme::MINMAXINTERVALMOVING) {
-            for (unsigned int i = 0; i < interSection->getGridWidth(); i++)
+            for (unsigned int i = 0; i < m_context->getInterSection()->getGridWidth(); i++)
             {
-                for (unsigned int j = 0; j < interSection->getGridHeight(); j++)
+                for (unsigned int j = 0; j < m_context->getInterSection()->getGridHeight(); j++)
                 {
                     if (Pause) //if Pause loop is set
                     {
                         pauseSimulation.wait(&mutex);
                     }
-                    emit addCellGUI(i, j, interSection->getNumberOfReservations(i,j));
+                    emit addCellGUI(i, j, m_context->getInterSection()->getNumberOfReservations(i,j));
                 }
             }
         }
     }
     if (InterSectionParameters::intersectionalScenario == 1 && InterSectionParameters::stochasticArrival == 1) {
-        if (interSection) {
+        if (m_context->getInterSection()) {
 
             /*DistParam distParam;
             distParam.distribFunc = DistributionFunction::POISSON;
@@ -864,20 +1117,26 @@ m_numberOfCars++;
             distParam.metric = TimeMetric::SECONDS;
             distParam.samplingTime = m_T;*/
             m_distParams = {
-                {DistributionFunction::POISSON, 60.0, TimeMetric::SECONDS, m_T},
-                {DistributionFunction::POISSON, 60.0, TimeMetric::SECONDS, m_T},
-                {DistributionFunction::POISSON, 60.0, TimeMetric::SECONDS, m_T},
-                {DistributionFunction::POISSON, 30.0, TimeMetric::SECONDS, m_T},
-                {DistributionFunction::POISSON, 30.0, TimeMetric::SECONDS, m_T},
-                {DistributionFunction::POISSON, 30.0, TimeMetric::SECONDS, m_T},
-                {DistributionFunction::POISSON, 120.0, TimeMetric::SECONDS, m_T},
-                {DistributionFunction::POISSON, 120.0, TimeMetric::SECONDS, m_T},
-                {DistributionFunction::POISSON, 120.0, TimeMetric::SECONDS, m_T},
-                {DistributionFunction::POISSON, 60.0, TimeMetric::SECONDS, m_T},
-                {DistributionFunction::POISSON, 60.0, TimeMetric::SECONDS, m_T},
-                {DistributionFunction::POISSON, 60.0, TimeMetric::SECONDS, m_T}
+                {DistributionFunction::POISSON, 60.0, TimeMetric::SECONDS, m_T, 0},
+                {DistributionFunction::POISSON, 60.0, TimeMetric::SECONDS, m_T, 0},
+                {DistributionFunction::POISSON, 60.0, TimeMetric::SECONDS, m_T, 0},
+                {DistributionFunction::POISSON, 30.0, TimeMetric::SECONDS, m_T, 0},
+                {DistributionFunction::POISSON, 30.0, TimeMetric::SECONDS, m_T, 0},
+                {DistributionFunction::POISSON, 30.0, TimeMetric::SECONDS, m_T, 0},
+                {DistributionFunction::POISSON, 120.0, TimeMetric::SECONDS, m_T, 0},
+                {DistributionFunction::POISSON, 120.0, TimeMetric::SECONDS, m_T, 0},
+                {DistributionFunction::POISSON, 120.0, TimeMetric::SECONDS, m_T, 0},
+                {DistributionFunction::POISSON, 60.0, TimeMetric::SECONDS, m_T, 0},
+                {DistributionFunction::POISSON, 60.0, TimeMetric::SECONDS, m_T, 0},
+                {DistributionFunction::POISSON, 60.0, TimeMetric::SECONDS, m_T, 0}
             };
-            interSection->setEntryPointsStandardLanes(m_distParams);
+            //every entry point gets its own stream, reproducible if a seed is set
+            if (m_seed != 0) {
+                for (size_t i = 0; i < m_distParams.size(); i++) {
+                    m_distParams.at(i).seed = m_seed + (unsigned int)i;
+                }
+            }
+            m_context->getInterSection()->setEntryPointsStandardLanes(m_distParams);
         }
     }
     mutex.unlock();
@@ -890,7 +1149,7 @@ m_numberOfCars++;
  * @param startMargin margin from the boundary
  */
 void SimulationThread::placeCarInStartPosition(const unsigned int& entryPoint, const double& startMargin) {
-    std::shared_ptr<InterSectionCell> entryCell = interSection->getEntryPoint(entryPoint);
+    std::shared_ptr<InterSectionCell> entryCell = m_context->getInterSection()->getEntryPoint(entryPoint);
     //start/target vectors
     std::vector<double> start, target;
     //top left
@@ -915,7 +1174,7 @@ void SimulationThread::placeCarInStartPosition(const unsigned int& entryPoint, c
         target = {k - 0.5, entryCell->getY()};
     }
     QString carId = QString("car") + QString::number(maxCars++);
-    std::shared_ptr<Car> car = std::make_shared<Car>(carId, start, target, m_N, lambda, m_pathAlgorithm, m_T, m_controlBounds);
+    std::shared_ptr<Car> car = std::make_shared<Car>(carId, start, target, m_N, lambda, m_pathAlgorithm, m_T, m_controlBounds, m_context);
     m_numberOfCars++;
     //add car to GUI
     if (InterSectionParameters::sysFuncUsage == SystemFunctionUsage::CONTINUOUS) {
@@ -936,7 +1195,7 @@ void SimulationThread::placeCarInStartPosition(const unsigned int& entryPoint, c
         }
         else {
             //for intersection scenario add directional constraints
-            car->createDirectionalConstraints(interSection->getWidth(), interSection->getHeight(),
+            car->createDirectionalConstraints(m_context->getInterSection()->getWidth(), m_context->getInterSection()->getHeight(),
                                               m_currentGridSize, getGlobalTime(), m_N, m_T, m_radius,
                                               m_controlBounds.second);
 
@@ -944,7 +1203,7 @@ void SimulationThread::placeCarInStartPosition(const unsigned int& entryPoint, c
                         VectorHelper::reshapeXd(car->getInitialControl(getGlobalTime(), m_T)),
                         getGlobalTime(), m_T, m_N, false, m_currentGridSize,
                         m_radius, m_commScheme);
-            m_constraints = insertFormulatedConstraints(car->getName(), m_constraints, constraints);
+            insertFormulatedConstraints(car->getId(), m_constraints, constraints);
             m_cars.push_back(car);
         }
     }
@@ -956,43 +1215,43 @@ void SimulationThread::placeCarInStartPosition(const unsigned int& entryPoint, c
   * @param cars
   * @return
   */
- std::multimap<QString, Constraint> SimulationThread::appendConstraintsFromPosition(const CarGroupQueue& cars) {
-     std::multimap<QString, Constraint> posConstraints;
+ ConstraintStore SimulationThread::appendConstraintsFromPosition(const CarGroupQueue& cars) {
+     ConstraintStore posConstraints;
      //here it will always be n0, as the position here is the initial condition (should be addded for the full horizon)
      for (const std::shared_ptr<Car>& car : cars.getOrderSeq()) {
-       // std::shared_ptr<InterSectionCell> curCell = InterSection::getInstance()->getCellFromCoordinates(car->getCurrentStateContinuous());
+       // std::shared_ptr<InterSectionCell> curCell = m_context->getInterSection()->getCellFromCoordinates(car->getCurrentStateContinuous());
          std::shared_ptr<InterSectionCell> curCell ;
          if(InterSectionParameters::sysFuncUsage == SystemFunctionUsage::CONTINUOUS) {
-            curCell  = InterSection::getInstance()->getCellFromCoordinates(car->getCurrentStateContinuous());
+            curCell  = m_context->getInterSection()->getCellFromCoordinates(car->getCurrentStateContinuous());
          } else {
             PathItem as =  car->getCurrentState();
-             curCell = InterSection::getInstance()->getInterSectionCell(as.getX(),as.getY());
+             curCell = m_context->getInterSection()->getInterSectionCell(as.getX(),as.getY());
          }
 
          double currentTime = m_t0;
          if (m_commScheme == CommunicationScheme::DIFFERENTIAL || m_commScheme == CommunicationScheme::FULL) {
              for (unsigned int i = 0; i < m_N ; i++) {
              posConstraints.insert(
-                     std::pair<QString, Constraint>(car->getName(), Constraint({InterSection::getInstance()->getCellSize() * ((double)curCell->getX() + 0.5),
-                                                                                 InterSection::getInstance()->getCellSize() * ((double)curCell->getY() + 0.5)},
+                     car->getId(), Constraint({m_context->getInterSection()->getCellSize() * ((double)curCell->getX() + 0.5),
+                                                                                 m_context->getInterSection()->getCellSize() * ((double)curCell->getY() + 0.5)},
                                                                                  currentTime, SystemFunctionUsage::CONTINUOUS, m_N, m_T, this->m_currentGridSize,
-                                                                               this->m_radius, m_radius + 0.5) ) );//TODO: investigate current radius!!!
+                                                                               this->m_radius, m_radius + 0.5) );//TODO: investigate current radius!!!
              currentTime += m_T;
              }
          }
          else if (m_commScheme == CommunicationScheme::MINMAXINTERVAL || m_commScheme == CommunicationScheme::MINMAXINTERVALMOVING) { //need only one constraint
              posConstraints.insert(
-                     std::pair<QString, Constraint>(car->getName(), Constraint({InterSection::getInstance()->getCellSize() * ((double)curCell->getX() + 0.5),
-                                                                                 InterSection::getInstance()->getCellSize() * ((double)curCell->getY() + 0.5)},
+                     car->getId(), Constraint({m_context->getInterSection()->getCellSize() * ((double)curCell->getX() + 0.5),
+                                                                                 m_context->getInterSection()->getCellSize() * ((double)curCell->getY() + 0.5)},
                                                                                  m_t0, SystemFunctionUsage::CONTINUOUS, m_N, m_T, this->m_currentGridSize,
-                                                                               this->m_radius, m_radius + 0.5) ) );//TODO: investigate current radius!!!
+                                                                               this->m_radius, m_radius + 0.5) );//TODO: investigate current radius!!!
          }
          else if (m_commScheme == CommunicationScheme::CONTINUOUS) {
              for (unsigned int i = 0; i < m_N ; i++) {
              posConstraints.insert(
-                     std::pair<QString, Constraint>(car->getName(), Constraint({car->getCurrentStateContinuous().at(0), car->getCurrentStateContinuous().at(1)},
+                     car->getId(), Constraint({car->getCurrentStateContinuous().at(0), car->getCurrentStateContinuous().at(1)},
                                                                                  currentTime, SystemFunctionUsage::CONTINUOUS, m_N, m_T, this->m_currentGridSize,
-                                                                               this->m_radius, m_radius + 0.5) ) );//TODO: investigate current radius!!!
+                                                                               this->m_radius, m_radius + 0.5) );//TODO: investigate current radius!!!
              currentTime += m_T;
              }
          }
@@ -1018,99 +1277,55 @@ void SimulationThread::placeCarInStartPosition(const unsigned int& entryPoint, c
 
  /**
   * @brief SimulationThread::deleteOldConstraints delete the constraints which has a smaller timestamp than the global one
-  * @param constraintMap
-  * @return
+  * @param constraints store, the old constraints are removed in place
   */
- std::multimap<QString, Constraint> SimulationThread::deleteOldConstraints(const std::multimap<QString, Constraint>& constraintMap) const {
-     std::multimap<QString, Constraint> constraints = constraintMap;
-     for (auto it = constraints.begin(); it != constraints.end(); ) {
-         if (it->second.getConstraintTime() < getGlobalTime()) {
-             it = constraints.erase(it);
-         }
-         else {
-             ++it;
-         }
-     }
-     //DEBUG
-     /*for (auto it = constraints.begin(); it != constraints.end(); it++) {
-         qDebug() << "Car: " << it->first << it->second.getConstraintTime() << " (" << it->second.getCenterPoint().at(0) << "," << it->second.getCenterPoint().at(1) << ")";
-     }*/
-     //--DEBUG
+ void SimulationThread::deleteOldConstraints(ConstraintStore& constraints) const {
+     constraints.removeBefore(getGlobalTime());
      qDebug() << "globalTime: " << getGlobalTime();
-     return constraints;
  }
 
  /**
-  * @brief SimulationThread::findEqualConstraint returns true, if the given constraint is already in m_constraints
+  * @brief SimulationThread::findEqualConstraint returns true, if the given constraint is already in the store
+  * @param constraintList store to look in
   * @param constraint constraints to look for
-  * @return true, if constraint is already in m_constraints, false, otherwise
+  * @return true, if constraint is already in the store, false, otherwise
   */
- bool SimulationThread::findEqualConstraint(const std::multimap<QString, Constraint>& constraintList, const Constraint& constraint) const {
-     bool isIncluded = false;
-     for (auto it = constraintList.begin(); it != constraintList.end(); it++) {
-         if (it->second == constraint) {
-             isIncluded = true;
-             break;
-         }
-     }
-     return isIncluded;
+ bool SimulationThread::findEqualConstraint(const ConstraintStore& constraintList, const Constraint& constraint) const {
+     return constraintList.contains(constraint);
  }
 
  /**
-  * @brief SimulationThread::removeConstraintWithEqualTimeStamp
-  * @param car
+  * @brief SimulationThread::removeConstraintWithEqualTimeStamp removes the constraints of the car with the time of the constraint
   * @param constraintList
+  * @param car
   * @param constraint
-  * @return
+  * @return true, if constraints were removed
   */
- bool SimulationThread::removeConstraintWithEqualTimeStamp(std::multimap<QString, Constraint>& constraintList, const QString& car, const Constraint& constraint) const {
-     bool removedConstraint;
-
-     for (auto it = constraintList.begin(); it != constraintList.end(); ) {
-         if (car ==  it->first && constraint.getConstraintTime() == it->second.getConstraintTime()) {
-             it = constraintList.erase(it);
-             removedConstraint = true;
-         }
-         else {
-             ++it;
-         }
-     }
-     return removedConstraint;
+ bool SimulationThread::removeConstraintWithEqualTimeStamp(ConstraintStore& constraintList, const CarId& car, const Constraint& constraint) const {
+     return constraintList.removeTimeSlot(car, constraint.getConstraintTime());
  }
 
  /**
   * @brief SimulationThread::insertFormulatedConstraints
   * @param car
-  * @param constaintList list with constraints
+  * @param constaintList store with constraints, the new constraints are inserted in place
   * @param constraints new constraints
-  * @return
   */
- std::multimap<QString, Constraint> SimulationThread::insertFormulatedConstraints(const QString& car, const std::multimap<QString, Constraint>& constraintList,
-                                                                                  const std::vector<Constraint> &constraints) const {
+ void SimulationThread::insertFormulatedConstraints(const CarId& car, ConstraintStore& constraintList,
+                                                    const std::vector<Constraint> &constraints) const {
      //with the interval scheme, all previous constraints can be deleted, as the interval is always newly set
-     std::multimap<QString, Constraint> newConstraintsList = constraintList;
      if (m_commScheme == CommunicationScheme::MINMAXINTERVAL || m_commScheme == CommunicationScheme::MINMAXINTERVALMOVING) {
-         for (auto it = newConstraintsList.begin(); it != newConstraintsList.end(); ) {
-             if (it->first == car) {
-                 it = newConstraintsList.erase(it);
-             }
-             else {
-                 ++it;
-             }
-         }
+         constraintList.removeCar(car);
      }
      for (auto it = constraints.begin(); it != constraints.end(); it++) {
          if (m_commScheme != CommunicationScheme::MINMAXINTERVAL && m_commScheme != CommunicationScheme::MINMAXINTERVALMOVING) {
-             removeConstraintWithEqualTimeStamp(newConstraintsList, car, *it);
+             //a new constraint replaces the one of the car with the same time stamp
+             constraintList.replace(car, *it);
+         }
+         else {
+             constraintList.insert(car, *it);
          }
-         newConstraintsList.insert( std::pair<QString, Constraint>(car, *it) );
      }
-     //DEBUG
-     /*for (auto it = m_constraints.begin(); it != m_constraints.end(); it++) {
-         qDebug() << "Car: " << it->first << "Constraint: (" << it->second.getCenterPoint().at(0) << "," << it->second.getCenterPoint().at(1) << ")";
-     }*/
-     //--DEBUG
-     return newConstraintsList;
  }
 
  /**
@@ -1118,7 +1333,7 @@ void SimulationThread::placeCarInStartPosition(const unsigned int& entryPoint, c
   * @return
   */
  int SimulationThread::getGridWidth() const {
-     return interSection->getGridWidth();
+     return m_context->getInterSection()->getGridWidth();
  }
 
  /**
@@ -1126,7 +1341,7 @@ void SimulationThread::placeCarInStartPosition(const unsigned int& entryPoint, c
   * @return
   */
  int SimulationThread::getGridHeight() const {
-     return interSection->getGridHeight();
+     return m_context->getInterSection()->getGridHeight();
  }
 
  /**
@@ -1134,8 +1349,8 @@ void SimulationThread::placeCarInStartPosition(const unsigned int& entryPoint, c
   * @return
   */
  double SimulationThread::getOverallConstraintMargin() const {
-     Constraint constraint ({InterSection::getInstance()->getCellSize() + 0.5,
-                 InterSection::getInstance()->getCellSize() + 0.5},
+     Constraint constraint ({m_context->getInterSection()->getCellSize() + 0.5,
+                 m_context->getInterSection()->getCellSize() + 0.5},
                  m_t0, SystemFunctionUsage::CONTINUOUS, m_N, m_T, this->m_currentGridSize,
                  this->m_radius, m_radius + 0.5);
      return constraint.getOverallMargin();
@@ -1155,11 +1370,11 @@ void SimulationThread::placeCarInStartPosition(const unsigned int& entryPoint, c
  * @param numberCreateCars number of cars to be created
  */
 void SimulationThread::createInterArrivalCars() {
-    if (interSection) {
+    if (m_context->getInterSection()) {
         //get vector for new arriving cars for all entry points of the intersection
         std::vector<unsigned int> newArrivedCars;
-        for (unsigned int i = 0; i < interSection->numberEntryPoints(); i++) {
-            newArrivedCars.push_back(interSection->getAmountOfCarsForNextTime(i));
+        for (unsigned int i = 0; i < m_context->getInterSection()->numberEntryPoints(); i++) {
+            newArrivedCars.push_back(m_context->getInterSection()->getAmountOfCarsForNextTime(i));
         }
         //iterate over the vector of entry points
         for (unsigned int i = 0; i < newArrivedCars.size(); i++) {
@@ -1196,7 +1411,7 @@ CarGroupQueue SimulationThread::insertCarsFromWaitingQueue(std::map<std::shared_
             if (valid) {
                 oldCars.push_back(it->first);
                 //for intersection scenario add directional constraints
-                it->first->createDirectionalConstraints(interSection->getWidth(), interSection->getHeight(),
+                it->first->createDirectionalConstraints(m_context->getInterSection()->getWidth(), m_context->getInterSection()->getHeight(),
                                                   m_currentGridSize, getGlobalTime(), m_N, m_T, m_radius,
                                                   m_controlBounds.second);
 
@@ -1204,7 +1419,7 @@ CarGroupQueue SimulationThread::insertCarsFromWaitingQueue(std::map<std::shared_
                             VectorHelper::reshapeXd(it->first->getInitialControl(getGlobalTime(), m_T)),
                             getGlobalTime(), m_T, m_N, false, m_currentGridSize,
                             m_radius, m_commScheme);
-                m_constraints = insertFormulatedConstraints(it->first->getName(), m_constraints, constraints);
+                insertFormulatedConstraints(it->first->getId(), m_constraints, constraints);
                 it = waitCars.erase(it);
             }
             else {
@@ -1221,16 +1436,9 @@ CarGroupQueue SimulationThread::insertCarsFromWaitingQueue(std::map<std::shared_
 
 /**
  * @brief SimulationThread::removeConstraintsOfMovedCars removes constraints from cars, which are not there anymore
- * @param carName car which has been removed
- * @param constraintMap constraint map
- * @return cleared constraint map
+ * @param car car which has been removed
+ * @param constraints store, the constraints of the car are removed in place
  */
-std::multimap<QString, Constraint> SimulationThread::removeConstraintsOfMovedCars(const QString& carName, const std::multimap<QString, Constraint> &constraintMap) {
-    std::multimap<QString, Constraint> reducedConstraints;
-    for (auto itConstraint = constraintMap.begin(); itConstraint != constraintMap.end(); itConstraint++) {
-        if (itConstraint->first != carName) {
-            reducedConstraints.insert((*itConstraint));
-        }
-    }
-    return reducedConstraints;
+void SimulationThread::removeConstraintsOfMovedCars(const CarId& car, ConstraintStore& constraints) {
+    constraints.removeCar(car);
 }
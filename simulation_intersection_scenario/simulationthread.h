@@ -6,6 +6,7 @@
 #include <QtCore/QString>
 #include <QtCore/QWaitCondition>
 #include <QtCore/QMutex>
+#include <QtCore/QSemaphore>
 
 #include <QtCore/QFile>
 #include <QtCore/QTextStream>
@@ -14,13 +15,15 @@
 #include "intersection.h"
 #include "car.h"
 #include "evaluation.h"
-#include "globalcarlist.h"
+#include "simulationcontext.h"
 #include "../simulation-core/databasecore.h"
 #include "prioritysorter.h"
 #include "arrivalcar.h"
 #include "enterintersectiondist.h"
 #include "cargroupqueue.h"
+#include "resultwriter.h"
 
+#include <atomic>
 #include <map>
 #include <memory>
 
@@ -42,6 +45,12 @@ public:
     int getGridHeight() const;
     double getOverallConstraintMargin() const;
     double getCurrentCellSize() const;
+    void setOcpWorkerThreads(const unsigned int& threads);
+    void setResultWriter(const std::shared_ptr<ResultWriter>& writer);
+    bool isHeadless() const;
+    void setRunMode(const RunMode& mode);
+    RunMode getRunMode() const;
+    void setSeed(const unsigned int& seed);
 
 
 signals:
@@ -68,6 +77,7 @@ public slots:
     void startSimulation();
     void pause();
     void resume();
+    void frameTick();
 
 private slots:
     void startMultipleSimRuns();
@@ -76,7 +86,8 @@ private:
     unsigned int k, m, m_N, maxCars, m_numberOfCars;
     double lambda;
     bool Pause;
-    std::shared_ptr<InterSection> interSection;
+    ///intersection, cars and parameters of this simulation
+    std::shared_ptr<SimulationContext> m_context;
     //std::vector<std::vector<std::shared_ptr<Car> > > cars;
     CarGroupQueue m_cars;
     std::map<std::shared_ptr<Car>, double> m_waitCars;
@@ -102,7 +113,7 @@ private:
     ///sampling parameter
     double m_T;
     ///constraints that are obtained by each car
-    std::multimap<QString, Constraint> m_constraints;
+    ConstraintStore m_constraints;
     ///control bounds inserted by each car
     std::pair<double, double> m_controlBounds;
     ///bounds for gridsizes (from..to)
@@ -123,21 +134,37 @@ private:
 
     ///distribution parameters
     std::vector<DistParam> m_distParams;
+    ///threads to solve the OCPs of independent cars (1: sequential, 0: ideal thread count)
+    unsigned int m_ocpWorkerThreads;
+    ///writes the results without GUI (headless run), nullptr for the GUI application
+    std::shared_ptr<ResultWriter> m_resultWriter;
+    ///real time pacing by the GUI frame timer or fast forward
+    std::atomic<RunMode> m_runMode;
+    ///frames released by the GUI frame timer, the simulation thread takes one frame per step in real time mode
+    QSemaphore m_frameSemaphore;
+    ///seed for the arrival processes, 0 for a non-deterministic seed
+    unsigned int m_seed;
 
     //simulation methods
-    std::map<QString, std::vector<std::vector<double> >> calculateStep(std::map<QString, PathItem> &nextTargets);
-    void evaluateStep(std::map<QString, PathItem> &nextTargets, const std::map<QString, std::vector<std::vector<double> >> &continSol = std::map<QString, std::vector<std::vector<double> >>());
+    CarControls calculateStep(CarIndexed<PathItem> &nextTargets);
+    void setConstraintsForCar(const std::shared_ptr<Car>& car, const bool& firstCar);
+    bool isRowIndependent() const;
+    void solveRowConcurrently(const std::vector<std::shared_ptr<Car> >& carRow, CarControls& continSol);
+    void evaluateStep(CarIndexed<PathItem> &nextTargets, const CarControls &continSol = CarControls());
+    std::vector<std::shared_ptr<Car> > resolveReservationConflicts(CarIndexed<PathItem> &nextTargets, unsigned int& rounds);
     void updateCellReservations();
+    void writeResults();
+    void waitForFrame();
     void makeCarsAndIntersection();
     void placeCarInStartPosition(const unsigned int &entryPoint, const double& startMargin);
     void createInterArrivalCars();
     CarGroupQueue insertCarsFromWaitingQueue(std::map<std::shared_ptr<Car>, double> &waitCars, const CarGroupQueue &cars);
-    std::multimap<QString, Constraint> appendConstraintsFromPosition(const CarGroupQueue &cars);
-    std::multimap<QString, Constraint> deleteOldConstraints(const std::multimap<QString, Constraint> &constraintMap) const;
-    std::multimap<QString, Constraint> insertFormulatedConstraints(const QString &car, const std::multimap<QString, Constraint>& constraintList, const std::vector<Constraint> &constraints) const;
-    bool findEqualConstraint(const std::multimap<QString, Constraint> &constraintList, const Constraint &constraint) const;
-    bool removeConstraintWithEqualTimeStamp(std::multimap<QString, Constraint> &constraintList, const QString& car, const Constraint& constraint) const;
-    std::multimap<QString, Constraint> removeConstraintsOfMovedCars(const QString &carName, const std::multimap<QString, Constraint> &constraintMap);
+    ConstraintStore appendConstraintsFromPosition(const CarGroupQueue &cars);
+    void deleteOldConstraints(ConstraintStore &constraints) const;
+    void insertFormulatedConstraints(const CarId &car, ConstraintStore& constraintList, const std::vector<Constraint> &constraints) const;
+    bool findEqualConstraint(const ConstraintStore &constraintList, const Constraint &constraint) const;
+    bool removeConstraintWithEqualTimeStamp(ConstraintStore &constraintList, const CarId& car, const Constraint& constraint) const;
+    void removeConstraintsOfMovedCars(const CarId &car, ConstraintStore &constraints);
 };
 
 Q_DECLARE_METATYPE(std::vector<std::vector<double> >)
@@ -0,0 +1,117 @@
+#include "solvercontext.h"
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief SolverContext::SolverContext
+ */
+SolverContext::SolverContext() :
+    m_algorithm(nlopt::LN_COBYLA),
+    m_lb(0.0),
+    m_ub(0.0),
+    m_lastStep(-1.0),
+    m_rebuilds(0),
+    m_constraintUpdates(0)
+{
+}
+
+/**
+ * @brief SolverContext::getOptimizer returns the persistent optimizer, it is rebuilt without constraints and warm start
+ * if algorithm, dimension or bounds have changed or the context was invalidated
+ * @param algorithm NLopt algorithm
+ * @param dimension dimension of the control vector
+ * @param lb lower control bound
+ * @param ub upper control bound
+ * @return optimizer
+ */
+nlopt::opt& SolverContext::getOptimizer(const nlopt::algorithm& algorithm, const unsigned int& dimension, const double& lb, const double& ub) {
+    if (!m_opt || m_algorithm != algorithm || m_opt->get_dimension() != dimension || m_lb != lb || m_ub != ub) {
+        m_opt.reset(new nlopt::opt(algorithm, dimension));
+        m_opt->set_lower_bounds(lb);
+        m_opt->set_upper_bounds(ub);
+        m_opt->set_ftol_abs(0.1);
+        m_opt->set_xtol_rel(0.001);
+        m_opt->set_maxeval(10000);
+        m_algorithm = algorithm;
+        m_lb = lb;
+        m_ub = ub;
+        m_constraints.clear();
+        m_lastStep = -1.0;
+        m_rebuilds++;
+    }
+    return *m_opt;
+}
+
+/**
+ * @brief SolverContext::needsConstraintUpdate
+ * @param constraints constraint objects in the order of registration
+ * @return true, if other constraint objects are registered at the optimizer
+ */
+bool SolverContext::needsConstraintUpdate(const std::vector<const void*>& constraints) const {
+    return constraints != m_constraints;
+}
+
+/**
+ * @brief SolverContext::setConstraints stores the constraint objects after they were registered at the optimizer
+ * @param constraints
+ */
+void SolverContext::setConstraints(const std::vector<const void*>& constraints) {
+    m_constraints = constraints;
+    m_constraintUpdates++;
+}
+
+/**
+ * @brief SolverContext::hasWarmStart
+ * @return true, if the last solution of the optimizer can be used to set the initial step
+ */
+bool SolverContext::hasWarmStart() const {
+    return m_opt && m_lastStep >= 0.0;
+}
+
+/**
+ * @brief SolverContext::getInitialStep
+ * @return step of the last solution, bounded to [0.01, 0.5] of the control range
+ */
+double SolverContext::getInitialStep() const {
+    const double range = m_ub - m_lb;
+    return std::min(std::max(m_lastStep, 0.01 * range), 0.5 * range);
+}
+
+/**
+ * @brief SolverContext::storeStep stores the step from the start to the solution of the last optimization
+ * @param start initial control
+ * @param solution optimal control
+ */
+void SolverContext::storeStep(const std::vector<double>& start, const std::vector<double>& solution) {
+    double step = 0.0;
+    for (size_t i = 0; i < start.size() && i < solution.size(); i++) {
+        step = std::max(step, std::abs(solution.at(i) - start.at(i)));
+    }
+    m_lastStep = step;
+}
+
+/**
+ * @brief SolverContext::invalidate forces a cold start, the optimizer is rebuilt with the next call of getOptimizer
+ */
+void SolverContext::invalidate() {
+    m_opt.reset();
+    m_constraints.clear();
+    m_lastStep = -1.0;
+}
+
+/**
+ * @brief SolverContext::getRebuilds
+ * @return number of optimizer constructions
+ */
+size_t SolverContext::getRebuilds() const {
+    return m_rebuilds;
+}
+
+/**
+ * @brief SolverContext::getConstraintUpdates
+ * @return number of constraint registrations
+ */
+size_t SolverContext::getConstraintUpdates() const {
+    return m_constraintUpdates;
+}
@@ -0,0 +1,46 @@
+#ifndef SOLVERCONTEXT_H
+#define SOLVERCONTEXT_H
+
+#include <nlopt.hpp>
+
+#include <memory>
+#include <vector>
+
+/**
+ * @brief The SolverContext class keeps the NLopt optimizer of one car across the MPC steps.
+ * The optimizer is only rebuilt if the algorithm, the dimension or the control bounds change,
+ * the constraints are only registered again if the set of constraint objects has changed.
+ * The step taken by the last solution is used as initial step (trust region radius) of the next,
+ * shifted problem instead of the default initial step of a cold start.
+ */
+class SolverContext
+{
+public:
+    SolverContext();
+    nlopt::opt& getOptimizer(const nlopt::algorithm& algorithm, const unsigned int& dimension, const double& lb, const double& ub);
+    bool needsConstraintUpdate(const std::vector<const void*>& constraints) const;
+    void setConstraints(const std::vector<const void*>& constraints);
+    bool hasWarmStart() const;
+    double getInitialStep() const;
+    void storeStep(const std::vector<double>& start, const std::vector<double>& solution);
+    void invalidate();
+    size_t getRebuilds() const;
+    size_t getConstraintUpdates() const;
+private:
+    ///persistent optimizer
+    std::unique_ptr<nlopt::opt> m_opt;
+    ///algorithm of the optimizer
+    nlopt::algorithm m_algorithm;
+    ///control bounds of the optimizer
+    double m_lb, m_ub;
+    ///constraint objects registered at the optimizer in the order of registration
+    std::vector<const void*> m_constraints;
+    ///infinity norm of the step of the last solution, negative if there is no warm start
+    double m_lastStep;
+    ///number of optimizer constructions
+    size_t m_rebuilds;
+    ///number of constraint registrations
+    size_t m_constraintUpdates;
+};
+
+#endif // SOLVERCONTEXT_H
@@ -0,0 +1,361 @@
+#include "sweepengine.h"
+
+#include <QtCore/QFile>
+#include <QtCore/QSettings>
+#include <QtCore/QTextStream>
+#include <QtCore/QThread>
+
+#include <algorithm>
+#include <iostream>
+
+/**
+ * @brief SweepEngine::SweepEngine creates a sweep with one job (default parameters)
+ * @param program batch runner, which is started for every job
+ * @param outputDir output directory of the sweep
+ * @param parent
+ */
+SweepEngine::SweepEngine(const QString& program, const QString& outputDir, QObject* parent) :
+    QObject(parent),
+    m_program(program),
+    m_outputDir(outputDir),
+    m_cellSizes({0.5}),
+    m_commSchemes({CommunicationScheme::CONTINUOUS}),
+    m_priorities({PriorityCriteria::FIXED}),
+    m_horizons({InterSectionParameters::N}),
+    m_cars({InterSectionParameters::maxCars}),
+    m_seeds({0}),
+    m_maxProcesses(std::max(1, QThread::idealThreadCount())),
+    m_nextJob(0)
+{
+}
+
+/**
+ * @brief SweepEngine::loadGrid reads the grid from the section [sweep] of an ini-file, every key holds a comma separated list
+ * (cellsize, comm, priority, N, cars, seed), missing keys keep their current values
+ * @param fileName
+ * @return false, if the file does not exist or a value could not be parsed
+ */
+bool SweepEngine::loadGrid(const QString& fileName) {
+    if (!QFile::exists(fileName)) {
+        return false;
+    }
+    QSettings settings(fileName, QSettings::IniFormat);
+    settings.beginGroup("sweep");
+    bool ok = true;
+    if (settings.contains("cellsize")) {
+        m_cellSizes.clear();
+        for (const QString& value : settings.value("cellsize").toStringList()) {
+            bool okValue = false;
+            m_cellSizes.push_back(value.trimmed().toDouble(&okValue));
+            ok = ok && okValue;
+        }
+    }
+    if (settings.contains("comm")) {
+        m_commSchemes.clear();
+        for (const QString& value : settings.value("comm").toStringList()) {
+            bool okValue = false;
+            m_commSchemes.push_back(communicationSchemeFromText(value.trimmed(), &okValue));
+            ok = ok && okValue;
+        }
+    }
+    if (settings.contains("priority")) {
+        m_priorities.clear();
+        for (const QString& value : settings.value("priority").toStringList()) {
+            bool okValue = false;
+            m_priorities.push_back(PrioritySorter::getCriteriaForText(value.trimmed(), &okValue));
+            ok = ok && okValue;
+        }
+    }
+    if (settings.contains("N")) {
+        m_horizons.clear();
+        for (const QString& value : settings.value("N").toStringList()) {
+            bool okValue = false;
+            m_horizons.push_back(value.trimmed().toUInt(&okValue));
+            ok = ok && okValue;
+        }
+    }
+    if (settings.contains("cars")) {
+        m_cars.clear();
+        for (const QString& value : settings.value("cars").toStringList()) {
+            bool okValue = false;
+            m_cars.push_back(value.trimmed().toUInt(&okValue));
+            ok = ok && okValue;
+        }
+    }
+    if (settings.contains("seed")) {
+        m_seeds.clear();
+        for (const QString& value : settings.value("seed").toStringList()) {
+            bool okValue = false;
+            m_seeds.push_back(value.trimmed().toUInt(&okValue));
+            ok = ok && okValue;
+        }
+    }
+    settings.endGroup();
+    return ok;
+}
+
+void SweepEngine::setCellSizes(const std::vector<double>& cellSizes) {
+    m_cellSizes = cellSizes;
+}
+
+void SweepEngine::setCommunicationSchemes(const std::vector<CommunicationScheme>& schemes) {
+    m_commSchemes = schemes;
+}
+
+void SweepEngine::setPriorityCriterias(const std::vector<PriorityCriteria>& criterias) {
+    m_priorities = criterias;
+}
+
+void SweepEngine::setHorizons(const std::vector<size_t>& horizons) {
+    m_horizons = horizons;
+}
+
+void SweepEngine::setCarCounts(const std::vector<unsigned int>& cars) {
+    m_cars = cars;
+}
+
+void SweepEngine::setSeeds(const std::vector<unsigned int>& seeds) {
+    m_seeds = seeds;
+}
+
+/**
+ * @brief SweepEngine::setFixedArguments sets the arguments, which are passed to every job additionally
+ * @param arguments
+ */
+void SweepEngine::setFixedArguments(const QStringList& arguments) {
+    m_fixedArguments = arguments;
+}
+
+/**
+ * @brief SweepEngine::setMaxProcesses
+ * @param processes number of jobs running in parallel, 0 for the ideal thread count
+ */
+void SweepEngine::setMaxProcesses(const unsigned int& processes) {
+    m_maxProcesses = (processes == 0) ? std::max(1, QThread::idealThreadCount()) : processes;
+}
+
+/**
+ * @brief SweepEngine::expand creates the cartesian product of all grid dimensions
+ * @return jobs, numbered consecutively
+ */
+std::vector<SweepJob> SweepEngine::expand() const {
+    std::vector<SweepJob> jobs;
+    unsigned int id = 0;
+    for (const double& cellSize : m_cellSizes) {
+        for (const CommunicationScheme& scheme : m_commSchemes) {
+            for (const PriorityCriteria& priority : m_priorities) {
+                for (const size_t& N : m_horizons) {
+                    for (const unsigned int& cars : m_cars) {
+                        for (const unsigned int& seed : m_seeds) {
+                            jobs.push_back({id++, cellSize, scheme, priority, N, cars, seed});
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return jobs;
+}
+
+/**
+ * @brief SweepEngine::getJobDir
+ * @param job
+ * @return output directory of the job
+ */
+QString SweepEngine::getJobDir(const SweepJob& job) const {
+    return m_outputDir.absoluteFilePath(QString("job_%1").arg(job.id, 4, 10, QChar('0')));
+}
+
+/**
+ * @brief SweepEngine::getArguments returns the command line of the batch runner for one job,
+ * each job solves its OCPs sequentially, as the parallelism is given by the processes
+ * @param job
+ * @return
+ */
+QStringList SweepEngine::getArguments(const SweepJob& job) const {
+    QStringList arguments = m_fixedArguments;
+    arguments << "--cellsize" << QString::number(job.cellSize)
+              << "--comm" << communicationSchemeToText(job.commScheme)
+              << "--priority" << PrioritySorter::getTextForChosenCriteria(job.priority).toUpper()
+              << "--N" << QString::number(job.N)
+              << "--cars" << QString::number(job.cars)
+              << "--seed" << QString::number(job.seed)
+              << "--workers" << "1"
+              << "--output" << getJobDir(job);
+    return arguments;
+}
+
+/**
+ * @brief SweepEngine::start expands the grid and starts the first jobs, finished() is emitted after the last job
+ */
+void SweepEngine::start() {
+    m_jobs = expand();
+    m_nextJob = 0;
+    m_success.clear();
+    m_outputDir.mkpath(".");
+    std::cout << "sweep with " << m_jobs.size() << " jobs on " << m_maxProcesses << " processes" << std::endl;
+    while (m_running.size() < m_maxProcesses && m_nextJob < m_jobs.size()) {
+        startNextJob();
+    }
+    if (m_running.empty()) {
+        writeTable();
+        emit finished();
+    }
+}
+
+/**
+ * @brief SweepEngine::startNextJob starts the process for the next job, the output of the process is written
+ * into log.txt of the job directory
+ */
+void SweepEngine::startNextJob() {
+    const SweepJob& job = m_jobs.at(m_nextJob);
+    QDir().mkpath(getJobDir(job));
+    QProcess* process = new QProcess(this);
+    process->setProcessChannelMode(QProcess::MergedChannels);
+    process->setStandardOutputFile(QDir(getJobDir(job)).absoluteFilePath("log.txt"));
+    connect(process, SIGNAL(finished(int,QProcess::ExitStatus)), this, SLOT(processFinished(int,QProcess::ExitStatus)));
+    m_running.insert({process, m_nextJob});
+    m_nextJob++;
+    process->start(m_program, getArguments(job));
+    if (!process->waitForStarted()) {
+        std::cerr << "job " << job.id << " could not be started" << std::endl;
+        m_running.erase(process);
+        process->deleteLater();
+        m_success[job.id] = false;
+        emit jobFinished(job.id, false);
+    }
+}
+
+/**
+ * @brief SweepEngine::processFinished stores the result of the job and starts the next one
+ * @param exitCode
+ * @param exitStatus
+ */
+void SweepEngine::processFinished(int exitCode, QProcess::ExitStatus exitStatus) {
+    QProcess* process = qobject_cast<QProcess*>(sender());
+    auto it = m_running.find(process);
+    if (it == m_running.end()) {
+        return;
+    }
+    const SweepJob& job = m_jobs.at(it->second);
+    bool success = (exitStatus == QProcess::NormalExit && exitCode == 0);
+    m_success[job.id] = success;
+    m_running.erase(it);
+    process->deleteLater();
+    std::cout << "job " << job.id << (success ? " finished" : " failed") << " (" << m_success.size() << "/" << m_jobs.size() << ")" << std::endl;
+    emit jobFinished(job.id, success);
+
+    while (m_running.size() < m_maxProcesses && m_nextJob < m_jobs.size()) {
+        startNextJob();
+    }
+    if (m_running.empty() && m_nextJob == m_jobs.size()) {
+        writeTable();
+        emit finished();
+    }
+}
+
+/**
+ * @brief SweepEngine::getFailedJobs
+ * @return number of jobs, which could not be started or returned with an error
+ */
+unsigned int SweepEngine::getFailedJobs() const {
+    unsigned int failed = 0;
+    for (const auto& success : m_success) {
+        if (!success.second) {
+            failed++;
+        }
+    }
+    return failed;
+}
+
+/**
+ * @brief SweepEngine::writeTable collects the summaries of all jobs into one table, one line per job:
+ * the grid parameters of the job, success and the values of its summary.csv (empty for failed jobs)
+ * @param fileName relative to the output directory
+ * @return false, if the file could not be written
+ */
+bool SweepEngine::writeTable(const QString& fileName) const {
+    const QStringList jobColumns({"job", "cellSize", "commScheme", "priority", "N", "cars", "seed", "success"});
+    QStringList summaryColumns;
+    std::vector<QMap<QString, QString> > summaries;
+    for (const SweepJob& job : m_jobs) {
+        QMap<QString, QString> summary;
+        QFile file(QDir(getJobDir(job)).absoluteFilePath("summary.csv"));
+        if (file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            QTextStream in(&file);
+            QStringList keys = in.readLine().split(',');
+            QStringList values = in.readLine().split(',');
+            for (int i = 0; i < keys.size() && i < values.size(); i++) {
+                //the parameters of the job are already in the first columns
+                if (!jobColumns.contains(keys.at(i)) && !summaryColumns.contains(keys.at(i))) {
+                    summaryColumns.append(keys.at(i));
+                }
+                summary.insert(keys.at(i), values.at(i));
+            }
+        }
+        summaries.push_back(summary);
+    }
+
+    QFile table(m_outputDir.absoluteFilePath(fileName));
+    if (!table.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return false;
+    }
+    QTextStream out(&table);
+    out << (jobColumns + summaryColumns).join(',') << endl;
+    for (size_t i = 0; i < m_jobs.size(); i++) {
+        const SweepJob& job = m_jobs.at(i);
+        auto success = m_success.find(job.id);
+        QStringList line;
+        line << QString::number(job.id) << QString::number(job.cellSize) << communicationSchemeToText(job.commScheme)
+             << PrioritySorter::getTextForChosenCriteria(job.priority) << QString::number(job.N) << QString::number(job.cars)
+             << QString::number(job.seed) << QString::number((success != m_success.end() && success->second) ? 1 : 0);
+        for (const QString& column : summaryColumns) {
+            line << summaries.at(i).value(column);
+        }
+        out << line.join(',') << endl;
+    }
+    return true;
+}
+
+/**
+ * @brief SweepEngine::communicationSchemeToText
+ * @param scheme
+ * @return literal description of the communication scheme
+ */
+QString SweepEngine::communicationSchemeToText(const CommunicationScheme& scheme) {
+    switch (scheme) {
+    case CommunicationScheme::FULL:
+        return "FULL";
+    case CommunicationScheme::DIFFERENTIAL:
+        return "DIFFERENTIAL";
+    case CommunicationScheme::MINMAXINTERVAL:
+        return "MINMAXINTERVAL";
+    case CommunicationScheme::MINMAXINTERVALMOVING:
+        return "MINMAXINTERVALMOVING";
+    case CommunicationScheme::CONTINUOUS:
+        return "CONTINUOUS";
+    }
+    return QString();
+}
+
+/**
+ * @brief SweepEngine::communicationSchemeFromText maps the literal description (case insensitive) to the communication scheme
+ * @param text
+ * @param ok is set to false, if the text is unknown
+ * @return communication scheme, CONTINUOUS if the text is unknown
+ */
+CommunicationScheme SweepEngine::communicationSchemeFromText(const QString& text, bool* ok) {
+    for (CommunicationScheme scheme : {CommunicationScheme::FULL, CommunicationScheme::DIFFERENTIAL, CommunicationScheme::MINMAXINTERVAL,
+                                       CommunicationScheme::MINMAXINTERVALMOVING, CommunicationScheme::CONTINUOUS}) {
+        if (text.toUpper() == communicationSchemeToText(scheme)) {
+            if (ok) {
+                *ok = true;
+            }
+            return scheme;
+        }
+    }
+    if (ok) {
+        *ok = false;
+    }
+    return CommunicationScheme::CONTINUOUS;
+}
@@ -0,0 +1,90 @@
+#ifndef SWEEPENGINE_H
+#define SWEEPENGINE_H
+
+#include "intersectionparameters.h"
+#include "prioritysorter.h"
+
+#include <QtCore/QObject>
+#include <QtCore/QProcess>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QDir>
+
+#include <map>
+#include <vector>
+
+/**
+ * @brief The SweepJob struct is one independent simulation run of a parameter sweep
+ */
+struct SweepJob {
+    unsigned int id;
+    double cellSize;
+    CommunicationScheme commScheme;
+    PriorityCriteria priority;
+    size_t N;
+    unsigned int cars;
+    unsigned int seed;
+};
+
+/**
+ * @brief The SweepEngine class expands a declarative parameter grid (cell size x communication scheme x priority criteria
+ * x horizon x number of cars x seed) into independent jobs and runs each job as a separate process of the batch runner.
+ * The processes do not share any state (e.g. the intersection), so up to maxProcesses jobs run in parallel.
+ * When all jobs are finished, the summaries of the jobs are collected into one table.
+ */
+class SweepEngine : public QObject
+{
+    Q_OBJECT
+public:
+    SweepEngine(const QString& program, const QString& outputDir, QObject* parent = nullptr);
+    bool loadGrid(const QString& fileName);
+    void setCellSizes(const std::vector<double>& cellSizes);
+    void setCommunicationSchemes(const std::vector<CommunicationScheme>& schemes);
+    void setPriorityCriterias(const std::vector<PriorityCriteria>& criterias);
+    void setHorizons(const std::vector<size_t>& horizons);
+    void setCarCounts(const std::vector<unsigned int>& cars);
+    void setSeeds(const std::vector<unsigned int>& seeds);
+    void setFixedArguments(const QStringList& arguments);
+    void setMaxProcesses(const unsigned int& processes);
+    std::vector<SweepJob> expand() const;
+    QString getJobDir(const SweepJob& job) const;
+    QStringList getArguments(const SweepJob& job) const;
+    unsigned int getFailedJobs() const;
+    bool writeTable(const QString& fileName = "sweep.csv") const;
+    static QString communicationSchemeToText(const CommunicationScheme& scheme);
+    static CommunicationScheme communicationSchemeFromText(const QString& text, bool* ok = nullptr);
+public slots:
+    void start();
+signals:
+    void jobFinished(unsigned int id, bool success);
+    void finished();
+private slots:
+    void processFinished(int exitCode, QProcess::ExitStatus exitStatus);
+private:
+    void startNextJob();
+    ///batch runner, which is started for every job
+    QString m_program;
+    ///output directory of the sweep, every job writes into its own sub directory
+    QDir m_outputDir;
+    ///arguments, which are the same for every job (e.g. width, height)
+    QStringList m_fixedArguments;
+    ///grid dimensions
+    std::vector<double> m_cellSizes;
+    std::vector<CommunicationScheme> m_commSchemes;
+    std::vector<PriorityCriteria> m_priorities;
+    std::vector<size_t> m_horizons;
+    std::vector<unsigned int> m_cars;
+    std::vector<unsigned int> m_seeds;
+    ///number of processes running in parallel
+    unsigned int m_maxProcesses;
+    ///expanded jobs of the current sweep
+    std::vector<SweepJob> m_jobs;
+    ///index of the next job to start
+    size_t m_nextJob;
+    ///running processes and the index of their job
+    std::map<QProcess*, size_t> m_running;
+    ///success of every finished job
+    std::map<unsigned int, bool> m_success;
+};
+
+#endif // SWEEPENGINE_H
@@ -4,15 +4,19 @@
 
 #include <QtCore/QDebug>
 
+#include <algorithm>
+
 constexpr double SystemFunction::boundaryTol;
 
 /**
  * @brief SystemFunction::SystemFunction
  * @param path given start point
+ * @param context simulation, the car belongs to
  */
-SystemFunction::SystemFunction(const QString& car, const Path &path) :
+SystemFunction::SystemFunction(const QString& car, const Path &path, const std::weak_ptr<SimulationContext> &context) :
     m_path(path),
     m_car(car),
+    m_carId(noCarId),
     m_globalLiveTime(0),
     m_globalWaitTime(0),
     m_reservationRequests(0),
@@ -20,8 +24,11 @@ SystemFunction::SystemFunction(const QString& car, const Path &path) :
     m_externalReservationRequests(0),
     m_systemFuncType(SystemFunctionUsage::DISCRETE),
     m_startPos({0,0}),
-    m_globalTime(0.0)
+    m_globalTime(0.0),
+    m_integrator(Integrator::create(InterSectionParameters::integratorType)),
+    m_context(context)
 {
+    registerCarId();
 }
 
 /**
@@ -29,10 +36,12 @@ SystemFunction::SystemFunction(const QString& car, const Path &path) :
  * start
  * @param car
  * @param startPos given start vector
+ * @param context simulation, the car belongs to
  */
-SystemFunction::SystemFunction(const QString &car, const std::vector<double> startPos) :
+SystemFunction::SystemFunction(const QString &car, const std::vector<double> startPos, const std::weak_ptr<SimulationContext> &context) :
   //m_path(path),
   m_car(car),
+  m_carId(noCarId),
   m_globalLiveTime(0),
   m_globalWaitTime(0),
   m_reservationRequests(0),
@@ -40,9 +49,31 @@ SystemFunction::SystemFunction(const QString &car, const std::vector<double> sta
   m_externalReservationRequests(0),
   m_systemFuncType(SystemFunctionUsage::CONTINUOUS),
   m_startPos(startPos),
-  m_globalTime(0.0)
+  m_globalTime(0.0),
+  m_integrator(Integrator::create(InterSectionParameters::integratorType)),
+  m_context(context)
 {
     m_currentPos.push_back(m_startPos);
+    registerCarId();
+}
+
+/**
+ * @brief SystemFunction::registerCarId looks up the ID of the car in the simulation context, the reservations
+ * of the cells are stored by the ID. Without a context the car cannot reserve cells and keeps noCarId
+ */
+void SystemFunction::registerCarId() {
+    std::shared_ptr<SimulationContext> context = m_context.lock();
+    if (context) {
+        m_carId = context->registerCarName(m_car);
+    }
+}
+
+/**
+ * @brief SystemFunction::getCarId
+ * @return ID of the car in the simulation context, noCarId if the system function has no context
+ */
+CarId SystemFunction::getCarId() const {
+    return m_carId;
 }
 
 /**
@@ -62,24 +93,44 @@ std::vector<double> SystemFunction::getStartContinuous() const {
 }
 
 /**
- * @brief SystemFunction::getHolonomicSystemState integrates the equation dx = u with explicit Euler-method and gives back dx for a given delta x
+ * @brief SystemFunction::getHolonomicSystemState integrates the equation dx = u with the set integrator (closed form by default)
+ * and gives back x(tEnd)
  * @param x0 start value
  * @param u control
  * @param t0 start interval
  * @param tEnd end interval
- * @return dx as vector
+ * @return x(tEnd) as vector
  */
 std::vector<double> SystemFunction::getHolonomicSystem(const std::vector<double> x0, const std::vector<double> &u, const double &t0, const double &tEnd) const {
-    //use Euler-Form to approximate this for a given interval
-    std::vector<double> x = x0;
-    double deltaT = (tEnd - t0) / m_intervalSplit;
-    for (double i = t0; i < tEnd; i+= deltaT) {
-        for (unsigned int j = 0; j < x0.size(); j++) {
-            //x.at(j) = x.at(j) + deltaT * x.at(j) * u.at(j);
-            x.at(j) += deltaT * u.at(j);
-        }
-    }
-    return x;
+    return m_integrator->integrate(SystemFunction::holonomicDynamics, x0, u, t0, tEnd);
+}
+
+/**
+ * @brief SystemFunction::holonomicDynamics right hand side of the holonomic model \f$\dot{x} = u\f$
+ * @param x state
+ * @param u control
+ * @param t time
+ * @return dx
+ */
+std::vector<double> SystemFunction::holonomicDynamics(const std::vector<double>& /*x*/, const std::vector<double>& u, const double& /*t*/) {
+    return u;
+}
+
+/**
+ * @brief SystemFunction::setIntegrator sets the integration scheme for the dynamics
+ * @param integrator
+ */
+void SystemFunction::setIntegrator(const std::shared_ptr<Integrator>& integrator) {
+    m_integrator = integrator;
+    m_trajectoryCache.invalidate();
+}
+
+/**
+ * @brief SystemFunction::getIntegrator
+ * @return current integration scheme
+ */
+std::shared_ptr<Integrator> SystemFunction::getIntegrator() const {
+    return m_integrator;
 }
 
 /**
@@ -95,15 +146,139 @@ std::vector<double> SystemFunction::getHolonomicSystem(const std::vector<double>
 std::vector<std::vector<double> > SystemFunction::getHolonomicSystemTrajectory(const std::vector<double> x0,
                                                                                const std::vector<std::vector<double> > &u, const double &t0,
                                                                                const double &T, const size_t &N) const {
+    return getHolonomicSystemTrajectory(x0, Trajectory::fromXd(u), t0, T, N).toXd();
+}
 
-    std::vector<std::vector<double> > x;
-    x.push_back(x0);
-    for (size_t i = 0; i < N - 1; i++) {
-        x.push_back(getHolonomicSystem(x.at(i), u.at(i), t0 + (double)i*T, t0 + (double)(i+1)*T));
-    }
+/**
+ * @brief SystemFunction::getHolonomicSystemTrajectory same as above with control and states in contiguous storage
+ * @param x0 start value
+ * @param u control (at least N-1 steps)
+ * @param t0 start time
+ * @param T sampling step
+ * @param N horizon
+ * @return x : N states
+ */
+Trajectory SystemFunction::getHolonomicSystemTrajectory(const std::vector<double>& x0, const Trajectory &u, const double &t0,
+                                                        const double &T, const size_t &N) const {
+    Q_ASSERT_X(N == 0 || (u.dimension() == x0.size() && u.size() >= N - 1), typeid(this).name(), "control shorter than the horizon");
+    Trajectory x(N, x0.size());
+    getHolonomicSystemTrajectory(x0, u.data(), t0, T, N, x);
     return x;
 }
 
+/**
+ * @brief SystemFunction::getHolonomicSystemTrajectory calculates the trajectory into the given storage, for the exact integrator
+ * the closed form \f$x_{i+1} = x_i + Tu_i\f$ is evaluated in place without any allocation
+ * @param x0 start value
+ * @param u control as 1d-array (at least (N-1)*dim values)
+ * @param t0 start time
+ * @param T sampling step
+ * @param N horizon
+ * @param x N states, resized if necessary
+ */
+void SystemFunction::getHolonomicSystemTrajectory(const std::vector<double>& x0, const double* u, const double &t0,
+                                                  const double &T, const size_t &N, Trajectory& x) const {
+    const size_t dim = x.dimension();
+    x.resize(N);
+    if (N == 0) {
+        return;
+    }
+    std::copy(x0.begin(), x0.begin() + std::min(x0.size(), dim), x.at(0));
+    if (m_integrator->getType() == IntegratorType::EXACT) {
+        VectorHelper::cumulativeSum(x.at(0), u, T, N, dim, x.data());
+    }
+    else {
+        std::vector<double> xi(dim, 0.0), ui(dim, 0.0);
+        for (size_t i = 0; i < N - 1; i++) {
+            xi.assign(x.at(i), x.at(i) + dim);
+            ui.assign(u + i * dim, u + (i + 1) * dim);
+            const std::vector<double> xNext = getHolonomicSystem(xi, ui, t0 + (double)i*T, t0 + (double)(i+1)*T);
+            std::copy(xNext.begin(), xNext.begin() + dim, x.at(i + 1));
+        }
+    }
+}
+
+/**
+ * @brief SystemFunction::getCachedHolonomicSystemTrajectory returns the trajectory from the current continuous state with control u.
+ * The trajectory is only integrated, if u, t0, T, N or the current state differ from the last call, so the cost function
+ * and all constraints evaluated by the optimizer for the same control share one integration
+ * @param u control as 1d-vector
+ * @param t0 start time
+ * @param T sampling step
+ * @param N horizon
+ * @return x : states (valid until the next call with different arguments)
+ */
+const Trajectory& SystemFunction::getCachedHolonomicSystemTrajectory(const std::vector<double>& u, const double &t0,
+                                                                                             const double &T, const size_t &N) const {
+    updateTrajectoryCache(u, t0, T, N);
+    return m_trajectoryCache.getTrajectory();
+}
+
+/**
+ * @brief SystemFunction::getCachedHolonomicSystemTrajectory1d same as getCachedHolonomicSystemTrajectory, but the states are
+ * returned as 1d-vector
+ * @param u control as 1d-vector
+ * @param t0 start time
+ * @param T sampling step
+ * @param N horizon
+ * @return x : states as 1d-vector
+ */
+const std::vector<double>& SystemFunction::getCachedHolonomicSystemTrajectory1d(const std::vector<double>& u, const double &t0,
+                                                                                 const double &T, const size_t &N) const {
+    updateTrajectoryCache(u, t0, T, N);
+    return m_trajectoryCache.getTrajectory1d();
+}
+
+/**
+ * @brief SystemFunction::updateTrajectoryCache integrates the trajectory, if the cache does not hold it already
+ * @param u control as 1d-vector
+ * @param t0 start time
+ * @param T sampling step
+ * @param N horizon
+ */
+void SystemFunction::updateTrajectoryCache(const std::vector<double>& u, const double &t0, const double &T, const size_t &N) const {
+    const std::vector<double>& x0 = m_currentPos.back();
+    if (m_trajectoryCache.isValid(x0, u, t0, T, N)) {
+        m_trajectoryCache.addHit();
+    }
+    else {
+        //integrate directly into the storage of the cache
+        getHolonomicSystemTrajectory(x0, u.data(), t0, T, N, m_trajectoryCache.store(x0, u, t0, T, N));
+    }
+}
+
+/**
+ * @brief SystemFunction::propagateStateGradientToControl adds the gradient of a function g(x_0,...,x_{N-1}) of the trajectory to
+ * the gradient with respect to the control vector. For the holonomic model with piecewise constant control
+ * \f$x_{i} = x_0 + T\sum_{k<i}u_k\f$, therefore \f$\frac{\partial g}{\partial u_k} = T\sum_{i>k}\frac{\partial g}{\partial x_i}\f$,
+ * which is calculated backwards as cumulative sum
+ * @param dStates partial derivatives of g with respect to each state x_i (N x dim)
+ * @param T sampling step
+ * @param grad gradient with respect to the control as 1d-vector (N*dim), the values are added
+ */
+void SystemFunction::propagateStateGradientToControl(const Trajectory& dStates, const double &T, std::vector<double>& grad) const {
+    if (dStates.empty()) {
+        return;
+    }
+    //u_{i-1} influences all states from x_i
+    VectorHelper::reverseCumulativeSum(dStates.data(), T, dStates.size(), dStates.dimension(), grad.data());
+}
+
+/**
+ * @brief SystemFunction::invalidateTrajectoryCache
+ */
+void SystemFunction::invalidateTrajectoryCache() {
+    m_trajectoryCache.invalidate();
+}
+
+/**
+ * @brief SystemFunction::getTrajectoryCache
+ * @return cache of the last evaluated trajectory
+ */
+const TrajectoryCache& SystemFunction::getTrajectoryCache() const {
+    return m_trajectoryCache;
+}
+
 /**
  * @brief SystemFunction::getCurrentState get the last item, current position
  * @return PathItem of current position
@@ -128,7 +303,7 @@ std::vector<double> SystemFunction::getCurrentContinuousState() const {
  * @return
  */
 PathItem SystemFunction::prelimReserveCell(const PathItem &control) {
-    std::shared_ptr<InterSection> interSect = InterSection::getInstance();
+    std::shared_ptr<InterSection> interSect = getInterSection();
     PathItem reservedCell = control;
     //count how often it is tried to reserve the next same cell (m_waitTimeNextCell)
     //and how often it is tried to get to another position (m_reservationRequests)
@@ -140,7 +315,7 @@ PathItem SystemFunction::prelimReserveCell(const PathItem &control) {
     }
     m_reservationRequests++;
     if (interSect) {
-        reservedCell.setTime(interSect->tryReservePrelimTimeForCar(m_car, control.getX(), control.getY(), control.getTime()));
+        reservedCell.setTime(interSect->tryReservePrelimTimeForCar(m_carId, control.getX(), control.getY(), control.getTime()));
         m_prelimPath.push_back(reservedCell);
     }
     return reservedCell;
@@ -151,9 +326,9 @@ PathItem SystemFunction::prelimReserveCell(const PathItem &control) {
  * the own preliminary path items
  */
 void SystemFunction::clearPrelimPath() {
-    std::shared_ptr<InterSection> interSect = InterSection::getInstance();
+    std::shared_ptr<InterSection> interSect = getInterSection();
     if (interSect) {
-        interSect->clearPrelimPathOfCar(m_car, m_prelimPath);
+        interSect->clearPrelimPathOfCar(m_carId, m_prelimPath);
     }
     m_prelimPath.clear();
 }
@@ -165,10 +340,10 @@ void SystemFunction::clearPrelimPath() {
  * @return
  */
 bool SystemFunction::reservePrelimSolution(const PathItem& pathItem) {
-    std::shared_ptr<InterSection> interSect = InterSection::getInstance();
+    std::shared_ptr<InterSection> interSect = getInterSection();
     m_reserved = false;
     if (interSect) {
-        m_reserved = interSect->reserveTimeForCar(this->m_car, pathItem.getX(), pathItem.getY(), pathItem.getTime());
+        m_reserved = interSect->reserveTimeForCar(this->m_carId, pathItem.getX(), pathItem.getY(), pathItem.getTime());
     }
     return m_reserved;
 }
@@ -205,12 +380,14 @@ void SystemFunction::applyNextState(const PathItem& pathItem) {
  */
 void SystemFunction::applyNextState(const std::vector<double> &umin, const double &t0, const double &T) {
     m_currentPos.push_back(getHolonomicSystem(m_currentPos.back(), umin, t0, T));
+    m_trajectoryCache.invalidate();
     //DEBUG
     //qDebug() << "apply state: " << this->m_car << " " << t0 << "(" << m_currentPos.back().at(0) << ","
     //         << m_currentPos.back().at(1) << ")";
     //--DEBUG
     //apply the cell mapped for the current position
-    std::shared_ptr<InterSectionCell> cell = InterSection::getInstance()->getCellFromCoordinates(m_currentPos.back());
+    std::shared_ptr<InterSection> interSect = getInterSection();
+    InterSectionCell* cell = interSect ? interSect->getCellHandleFromCoordinates(m_currentPos.back().at(0), m_currentPos.back().at(1)) : nullptr;
     if (cell) {
         reservePrelimSolution(PathItem(cell->getX(), cell->getY(), m_globalTime));
     }
@@ -232,7 +409,7 @@ void SystemFunction::applyNextState(const std::vector<double> &umin, const doubl
  * @return
  */
 double SystemFunction::getPossibleTimeForPrelimReservation(const PathItem& item) const {
-    std::shared_ptr<InterSection> interSect = InterSection::getInstance();
+    std::shared_ptr<InterSection> interSect = getInterSection();
     double prelimPossibleTime = -1.0;
     if (interSect) {
         prelimPossibleTime = interSect->getPossiblePrelimReserveTimeForCar(item.getX(), item.getY(), item.getTime());
@@ -435,18 +612,22 @@ const CarInformation& SystemFunction::getCarInfoEnd() const {
  * @brief SystemFunction::predictionToCells will map the predictions to the cells which should be reserved.
  * These are given back as a path containing the path items which define the cells to be blocked for a certain time
  * TODO: also reserve intermediate cells in case of cellsize < control
- * @param x vector of states
+ * @param x states
  * @param t0 start time for reservation
  * @param radius optional parameter radius, if diameter of robot should be considered
  * @return path with the cells which should be reserved
  */
-Path SystemFunction::mapPredictionToCells(const std::vector<std::vector<double> > &x, const double& t0, const double& T, const double &radius) const {
+Path SystemFunction::mapPredictionToCells(const Trajectory &x, const double& t0, const double& T, const double &radius) const {
     Path path;
-    std::shared_ptr<InterSection> interSect = InterSection::getInstance();
+    std::shared_ptr<InterSection> interSect = getInterSection();
+    if (!interSect) {
+        return path;
+    }
     double tInterval = t0;
     for (unsigned int i = 0; i < x.size(); i++) {
-        std::vector<double> curState = x.at(i);
-        std::shared_ptr<InterSectionCell> iCell = interSect->getCellFromCoordinates(curState);
+        const std::vector<double> curState = x.getState(i);
+        //non-owning handle, the cell lookup is index arithmetic on the dense grid
+        InterSectionCell* iCell = interSect->getCellHandleFromCoordinates(curState.at(0), curState.at(1));
         if (iCell) {
             path.addPathItem(PathItem(iCell->getX(), iCell->getY(), tInterval));
             //look up, if one of the coordinate is at one boundary
@@ -484,45 +665,42 @@ Path SystemFunction::mapPredictionToCells(const std::vector<std::vector<double>
             }
             if (radius > 0.0) {
                 //(x+r, y+r)
-                std::vector<double> xRad = {x.at(i).at(0) + radius, x.at(i).at(1) + radius};
-                std::shared_ptr<InterSectionCell> rCell = interSect->getCellFromCoordinates(xRad);
+                InterSectionCell* rCell = interSect->getCellHandleFromCoordinates(curState.at(0) + radius, curState.at(1) + radius);
                 if (iCell != rCell && rCell != nullptr) {
                     path.addPathItem(PathItem(rCell->getX(), rCell->getY(), tInterval));
                 }
                 //(x+r, y-r)
-                xRad = {x.at(i).at(0) + radius, x.at(i).at(1) - radius};
-                rCell = interSect->getCellFromCoordinates(xRad);
+                rCell = interSect->getCellHandleFromCoordinates(curState.at(0) + radius, curState.at(1) - radius);
                 if (iCell != rCell && rCell != nullptr) {
                     path.addPathItem(PathItem(rCell->getX(), rCell->getY(), tInterval));
                 }
-                //(x+r, y-r)
-                xRad = {x.at(i).at(0) - radius, x.at(i).at(1) - radius};
-                rCell = interSect->getCellFromCoordinates(xRad);
+                //(x-r, y-r)
+                rCell = interSect->getCellHandleFromCoordinates(curState.at(0) - radius, curState.at(1) - radius);
                 if (iCell != rCell && rCell != nullptr) {
                     path.addPathItem(PathItem(rCell->getX(), rCell->getY(), tInterval));
                 }
-                xRad = {x.at(i).at(0) - radius, x.at(i).at(1) + radius};
-                rCell = interSect->getCellFromCoordinates(xRad);
+                //(x-r, y+r)
+                rCell = interSect->getCellHandleFromCoordinates(curState.at(0) - radius, curState.at(1) + radius);
                 if (iCell != rCell && rCell != nullptr) {
                     path.addPathItem(PathItem(rCell->getX(), rCell->getY(), tInterval));
                 }
             }
             //dynamic is greater than cell size, therefore we have to reserve the intermediate cells
-            /*if (InterSection::getInstance()->getCellSize() < m_intervalControlDynamic.at(0) || InterSection::getInstance()->getCellSize()< m_intervalControlDynamic.at(1)) {
+            /*if (interSect->getCellSize() < m_intervalControlDynamic.at(0) || interSect->getCellSize()< m_intervalControlDynamic.at(1)) {
                 if (i < x.size() - 1) {
                     std::vector<double> gradient = VectorHelper::sub(x.at(i+1), curState);
                     std::vector<double> lastState = curState;
                     std::vector<bool> direction = VectorHelper::direction(gradient);
-                    for (double j = 0; j * InterSection::getInstance()->getCellSize() < m_intervalControlDynamic.at(1); j+= InterSection::getInstance()->getCellSize()) {
-                        lastState = VectorHelper::add(lastState, VectorHelper::mult(gradient, InterSection::getInstance()->getCellSize()));
+                    for (double j = 0; j * interSect->getCellSize() < m_intervalControlDynamic.at(1); j+= interSect->getCellSize()) {
+                        lastState = VectorHelper::add(lastState, VectorHelper::mult(gradient, interSect->getCellSize()));
                         if (VectorHelper::stepSizeInInterval(x.at(i+1), lastState, direction)) { //stepsize not too large
                             std::shared_ptr<InterSectionCell> intermediateCell = interSect->getCellFromCoordinates(lastState);
-                            intermediateCell->reserveTimeForCar(this->m_car, t0 + tInterval);
+                            intermediateCell->reserveTimeForCar(this->m_carId, t0 + tInterval);
                             path.addPathItem(PathItem(intermediateCell->getX(), intermediateCell->getY(), t0 + tInterval));
                         }
                         else {//stepsize too large, reserve last step
                             std::shared_ptr<InterSectionCell> intermediateCell = interSect->getCellFromCoordinates(x.at(i+1));
-                            intermediateCell->reserveTimeForCar(this->m_car, t0 + tInterval);
+                            intermediateCell->reserveTimeForCar(this->m_carId, t0 + tInterval);
                             path.addPathItem(PathItem(intermediateCell->getX(), intermediateCell->getY(), t0 + tInterval));
                         }
                     }
@@ -530,8 +708,7 @@ Path SystemFunction::mapPredictionToCells(const std::vector<std::vector<double>
             }
             else {*/
                 //TODO: should be done in a separate step
-                iCell = interSect->getCellFromCoordinates(x.at(i));
-                iCell->reserveTimeForCar(this->m_car, t0+tInterval);
+                iCell->reserveTimeForCar(this->m_carId, t0+tInterval);
             //}
         }
 
@@ -558,3 +735,12 @@ void SystemFunction::setIntervalControlDynamic(const std::vector<double>& vec) {
 std::vector<double> SystemFunction::getPos(const size_t& N) const {
     return m_currentPos.at(N);
 }
+
+/**
+ * @brief SystemFunction::getInterSection
+ * @return intersection of the simulation context, nullptr if the system function is used without a simulation
+ */
+std::shared_ptr<InterSection> SystemFunction::getInterSection() const {
+    std::shared_ptr<SimulationContext> context = m_context.lock();
+    return context ? context->getInterSection() : nullptr;
+}
@@ -4,6 +4,10 @@
 #include "path.h"
 #include "carinformation.h"
 #include "intersectionparameters.h"
+#include "trajectory.h"
+#include "trajectorycache.h"
+#include "integrator.h"
+#include "simulationcontext.h"
 
 #include <QtCore/QString>
 
@@ -17,8 +21,8 @@
 class SystemFunction
 {
 public:
-    SystemFunction(const QString &car, const Path& path);
-    SystemFunction(const QString &car, const std::vector<double> startPos);
+    SystemFunction(const QString &car, const Path& path, const std::weak_ptr<SimulationContext>& context = std::weak_ptr<SimulationContext>());
+    SystemFunction(const QString &car, const std::vector<double> startPos, const std::weak_ptr<SimulationContext>& context = std::weak_ptr<SimulationContext>());
     PathItem prelimReserveCell(const PathItem& control);
     double getPossibleTimeForPrelimReservation(const PathItem& item) const;
     void clearPrelimPath();
@@ -30,7 +34,14 @@ public:
     std::vector<double> getHolonomicSystem(const std::vector<double> x0, const std::vector<double> &u, const double &t0, const double &tEnd) const;
     std::vector<std::vector <double> > getHolonomicSystemTrajectory(const std::vector<double> x0,
                                                                     const std::vector<std::vector<double> > &u, const double &t0, const double &T, const size_t &N) const;
-    Path mapPredictionToCells(const std::vector<std::vector<double> > &x, const double &t0, const double& T, const double& radius = 0.0) const;
+    Trajectory getHolonomicSystemTrajectory(const std::vector<double>& x0, const Trajectory& u, const double &t0, const double &T, const size_t &N) const;
+    void getHolonomicSystemTrajectory(const std::vector<double>& x0, const double* u, const double &t0, const double &T, const size_t &N, Trajectory& x) const;
+    const Trajectory& getCachedHolonomicSystemTrajectory(const std::vector<double>& u, const double &t0, const double &T, const size_t &N) const;
+    const std::vector<double>& getCachedHolonomicSystemTrajectory1d(const std::vector<double>& u, const double &t0, const double &T, const size_t &N) const;
+    void invalidateTrajectoryCache();
+    void propagateStateGradientToControl(const Trajectory& dStates, const double &T, std::vector<double>& grad) const;
+    const TrajectoryCache& getTrajectoryCache() const;
+    Path mapPredictionToCells(const Trajectory &x, const double &t0, const double& T, const double& radius = 0.0) const;
     SystemFunctionUsage getSystemFunctionType() const;
     bool reservePrelimSolution(const PathItem& pathItem);
     Path setPossiblePrelimTimeForPath(const Path& path) const;
@@ -63,6 +74,11 @@ public:
     void setGlobalTime(const double &t);
     int64_t getGlobalTime() const;
     void setIntervalControlDynamic(const std::vector<double>& vec);
+    void setIntegrator(const std::shared_ptr<Integrator>& integrator);
+    std::shared_ptr<Integrator> getIntegrator() const;
+    std::shared_ptr<InterSection> getInterSection() const;
+    CarId getCarId() const;
+    static std::vector<double> holonomicDynamics(const std::vector<double>& x, const std::vector<double>& u, const double& t);
 private:
     ///preliminary path (clear it for each optimization step of one car)
     Path m_prelimPath;
@@ -70,6 +86,8 @@ private:
     Path m_path;
     ///ID of the car of the given system function
     QString m_car;
+    ///ID of the car in the simulation context, the cells store the reservations by it
+    CarId m_carId;
     ///criterias for coupled cost function
     /// global life time for the car
     double m_globalLiveTime;
@@ -92,13 +110,20 @@ private:
     ///start position for the continuous system
     std::vector<double> m_startPos;
     std::vector<std::vector<double> > m_currentPos;
-    static constexpr double m_intervalSplit = 100.0;
     ///global time of the simulation
     double m_globalTime;
     ///boundary for reserve next cell
     static constexpr double boundaryTol = 0.01;
     ///interval of control of dynamic
     std::vector<double> m_intervalControlDynamic;
+    ///integration scheme for the system dynamics
+    std::shared_ptr<Integrator> m_integrator;
+    ///simulation, the car belongs to (intersection grid)
+    std::weak_ptr<SimulationContext> m_context;
+    ///trajectory of the last evaluated control, shared by the cost function and the constraints
+    mutable TrajectoryCache m_trajectoryCache;
+    void updateTrajectoryCache(const std::vector<double>& u, const double &t0, const double &T, const size_t &N) const;
+    void registerCarId();
 
 };
 
@@ -0,0 +1,78 @@
+#include "trajectory.h"
+
+#include <QtCore/QtGlobal>
+
+#include <algorithm>
+
+/**
+ * @brief Trajectory::Trajectory
+ * @param steps number of steps
+ * @param dimension dimension of one step
+ */
+Trajectory::Trajectory(const size_t &steps, const size_t &dimension) :
+    m_steps(steps),
+    m_dim(dimension),
+    m_values(steps * dimension, 0.0)
+{
+}
+
+/**
+ * @brief Trajectory::fromXd converts a trajectory given as vector of states
+ * @param x states, all of the same dimension
+ * @return
+ */
+Trajectory Trajectory::fromXd(const std::vector<std::vector<double> > &x) {
+    Trajectory traject(x.size(), x.empty() ? InterSectionParameters::vectorDimension : x.front().size());
+    for (size_t i = 0; i < x.size(); i++) {
+        Q_ASSERT_X(x[i].size() == traject.m_dim, "Trajectory::fromXd", "states of different dimension");
+        std::copy(x[i].begin(), x[i].begin() + std::min(x[i].size(), traject.m_dim), traject.at(i));
+    }
+    return traject;
+}
+
+/**
+ * @brief Trajectory::resize sets the number of steps, the buffer is only reallocated if it grows over its capacity
+ * @param steps
+ */
+void Trajectory::resize(const size_t &steps) {
+    m_steps = steps;
+    m_values.resize(steps * m_dim, 0.0);
+}
+
+/**
+ * @brief Trajectory::setZero sets all components to 0
+ */
+void Trajectory::setZero() {
+    std::fill(m_values.begin(), m_values.end(), 0.0);
+}
+
+/**
+ * @brief Trajectory::assign takes the steps from a 1d-vector, e.g. the control of the optimizer
+ * @param values [x_0(0), x_1(0), x_0(1), ...]
+ */
+void Trajectory::assign(const std::vector<double> &values) {
+    m_steps = values.size() / m_dim;
+    m_values.assign(values.begin(), values.begin() + m_steps * m_dim);
+}
+
+/**
+ * @brief Trajectory::getState
+ * @param step
+ * @return copy of the step as vector
+ */
+std::vector<double> Trajectory::getState(const size_t &step) const {
+    return std::vector<double>(at(step), at(step) + m_dim);
+}
+
+/**
+ * @brief Trajectory::toXd converts to a vector of states, e.g. for the GUI
+ * @return
+ */
+std::vector<std::vector<double> > Trajectory::toXd() const {
+    std::vector<std::vector<double> > x;
+    x.reserve(m_steps);
+    for (size_t i = 0; i < m_steps; i++) {
+        x.push_back(getState(i));
+    }
+    return x;
+}
@@ -0,0 +1,60 @@
+#ifndef TRAJECTORY_H
+#define TRAJECTORY_H
+
+#include "intersectionparameters.h"
+#include "../simulation-core/fixedvector.h"
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief The Trajectory class stores N states (or controls) of fixed dimension in one contiguous buffer
+ * [x_0(0), x_1(0), x_0(1), x_1(1), ...], which is the same layout as the 1d control vector of the optimizer.
+ * A step is accessed as pointer to its first component, so no vector has to be allocated for each step.
+ * Resizing to the same or a smaller length keeps the buffer, so a trajectory can be reused for every evaluation.
+ */
+class Trajectory
+{
+public:
+    ///one state of the scenario as stack value, e.g. for differences of positions in inner loops
+    typedef FixedVector<InterSectionParameters::vectorDimension> StateVector;
+public:
+    Trajectory(const size_t& steps = 0, const size_t& dimension = InterSectionParameters::vectorDimension);
+    static Trajectory fromXd(const std::vector<std::vector<double> >& x);
+    void resize(const size_t& steps);
+    void setZero();
+    void assign(const std::vector<double>& values);
+    std::vector<double> getState(const size_t& step) const;
+    std::vector<std::vector<double> > toXd() const;
+    StateVector getStateVector(const size_t& step) const { return StateVector::fromPointer(at(step)); }
+    ///number of steps
+    size_t size() const { return m_steps; }
+    ///dimension of one step
+    size_t dimension() const { return m_dim; }
+    bool empty() const { return m_steps == 0; }
+    ///first component of the step
+    double* at(const size_t& step) { return m_values.data() + step * m_dim; }
+    const double* at(const size_t& step) const { return m_values.data() + step * m_dim; }
+    ///component j of the step
+    double& operator()(const size_t& step, const size_t& j) { return m_values[step * m_dim + j]; }
+    const double& operator()(const size_t& step, const size_t& j) const { return m_values[step * m_dim + j]; }
+    ///x-coordinate of the step
+    double x(const size_t& step) const { return m_values[step * m_dim]; }
+    ///y-coordinate of the step
+    double y(const size_t& step) const { return m_values[step * m_dim + 1]; }
+    const double* front() const { return at(0); }
+    const double* back() const { return at(m_steps - 1); }
+    ///all steps as 1d-vector
+    const std::vector<double>& values() const { return m_values; }
+    double* data() { return m_values.data(); }
+    const double* data() const { return m_values.data(); }
+private:
+    ///number of steps
+    size_t m_steps;
+    ///dimension of one step
+    size_t m_dim;
+    ///steps one after another
+    std::vector<double> m_values;
+};
+
+#endif // TRAJECTORY_H
@@ -0,0 +1,94 @@
+#include "trajectorycache.h"
+
+/**
+ * @brief TrajectoryCache::TrajectoryCache constructs an empty (invalid) cache
+ */
+TrajectoryCache::TrajectoryCache() :
+    m_t0(0.0),
+    m_T(0.0),
+    m_N(0),
+    m_valid(false),
+    m_hits(0),
+    m_misses(0)
+{
+
+}
+
+/**
+ * @brief TrajectoryCache::isValid tests, if the cached trajectory was calculated for the given arguments
+ * @param x0 start state
+ * @param u control vector (1d)
+ * @param t0 start time
+ * @param T sampling step
+ * @param N horizon length
+ * @return true, if the cached trajectory can be used
+ */
+bool TrajectoryCache::isValid(const std::vector<double>& x0, const std::vector<double>& u, const double& t0, const double& T, const size_t& N) const {
+    return (m_valid && m_N == N && m_t0 == t0 && m_T == T && m_u == u && m_x0 == x0);
+}
+
+/**
+ * @brief TrajectoryCache::store sets the arguments of the cached trajectory, the keys are copied into the existing buffers
+ * @param x0 start state
+ * @param u control vector (1d)
+ * @param t0 start time
+ * @param T sampling step
+ * @param N horizon length
+ * @return storage for the trajectory, which has to be calculated by the caller
+ */
+Trajectory& TrajectoryCache::store(const std::vector<double>& x0, const std::vector<double>& u, const double& t0, const double& T, const size_t& N) {
+    m_x0.assign(x0.begin(), x0.end());
+    m_u.assign(u.begin(), u.end());
+    m_t0 = t0;
+    m_T = T;
+    m_N = N;
+    m_valid = true;
+    m_misses++;
+    return m_x;
+}
+
+/**
+ * @brief TrajectoryCache::getTrajectory
+ * @return cached trajectory
+ */
+const Trajectory& TrajectoryCache::getTrajectory() const {
+    return m_x;
+}
+
+/**
+ * @brief TrajectoryCache::getTrajectory1d
+ * @return cached trajectory as 1d-vector [x_0(0), x_1(0), x_0(1), ...]
+ */
+const std::vector<double>& TrajectoryCache::getTrajectory1d() const {
+    return m_x.values();
+}
+
+/**
+ * @brief TrajectoryCache::invalidate marks the cache as invalid, e.g. if the state of the system is changed
+ */
+void TrajectoryCache::invalidate() {
+    m_valid = false;
+}
+
+/**
+ * @brief TrajectoryCache::getHits
+ * @return number of evaluations served from the cache
+ */
+size_t TrajectoryCache::getHits() const {
+    return m_hits;
+}
+
+/**
+ * @brief TrajectoryCache::getMisses
+ * @return number of evaluations which needed an integration
+ */
+size_t TrajectoryCache::getMisses() const {
+    return m_misses;
+}
+
+/**
+ * @brief TrajectoryCache::addHit counts an evaluation served from the cache
+ */
+void TrajectoryCache::addHit() {
+    m_hits++;
+}
@@ -0,0 +1,48 @@
+#ifndef TRAJECTORYCACHE_H
+#define TRAJECTORYCACHE_H
+
+#include "trajectory.h"
+
+#include <vector>
+#include <cstddef>
+
+/**
+ * @brief The TrajectoryCache class stores the last state trajectory calculated for a control vector.
+ * During one evaluation of the optimizer the cost function and every constraint ask for the trajectory
+ * of the same control vector, so the trajectory is integrated once and read by all callbacks.
+ * The cache is keyed on the start state, the control vector, t0, T and N, the trajectory is integrated into the storage of the cache.
+ */
+class TrajectoryCache
+{
+public:
+    TrajectoryCache();
+    bool isValid(const std::vector<double>& x0, const std::vector<double>& u, const double& t0, const double& T, const size_t& N) const;
+    Trajectory& store(const std::vector<double>& x0, const std::vector<double>& u, const double& t0, const double& T, const size_t& N);
+    const Trajectory& getTrajectory() const;
+    const std::vector<double>& getTrajectory1d() const;
+    void invalidate();
+    size_t getHits() const;
+    size_t getMisses() const;
+    void addHit();
+private:
+    ///start state of the cached trajectory
+    std::vector<double> m_x0;
+    ///control vector (1d) of the cached trajectory
+    std::vector<double> m_u;
+    ///start time
+    double m_t0;
+    ///sampling step
+    double m_T;
+    ///horizon length
+    size_t m_N;
+    ///cached state trajectory
+    Trajectory m_x;
+    ///cache holds a valid trajectory
+    bool m_valid;
+    ///number of evaluations served from the cache
+    size_t m_hits;
+    ///number of evaluations which needed an integration
+    size_t m_misses;
+};
+
+#endif // TRAJECTORYCACHE_H